@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::all_hits configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief A strong type representing local_maxima_only of the seqan3::align_cfg::all_hits.
+ * \ingroup alignment_configuration
+ */
+struct local_maxima_only : public seqan3::detail::strong_type<bool, local_maxima_only>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<bool, local_maxima_only>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief Reports every end position of the semi-global edit distance whose score is not below the
+ *        seqan3::align_cfg::min_score.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default, the semi-global edit distance only reports the single best end position of the second sequence within
+ * the first sequence. When verifying approximate matches in a long reference, every occurrence is of interest.
+ * With this configuration one alignment result is produced for every column of the last row whose score is greater
+ * than or equal to the seqan3::align_cfg::min_score, in increasing order of the end position in the first sequence.
+ * The results are produced while the matrix is computed, i.e. they can be consumed as soon as they are found via
+ * seqan3::align_cfg::on_result, and no part of the matrix is recomputed per hit.
+ *
+ * Since a good hit is usually surrounded by slightly worse hits that end one or two positions before or after it,
+ * the reported hits can be restricted to the local maxima of the score with seqan3::align_cfg::local_maxima_only.
+ * Then a hit is only reported if its score is greater than or equal to the score of its left neighbour and strictly
+ * greater than the score of its right neighbour, where end positions that are no hits count as minus infinity.
+ * Of several neighbouring hits with the same score, only the last one is reported.
+ *
+ * This configuration requires the edit distance (seqan3::align_cfg::edit_scheme) with free end gaps in the first
+ * sequence and the seqan3::align_cfg::min_score configuration. It can only be combined with the output of the
+ * score, the end positions and the sequence ids. Otherwise a seqan3::invalid_alignment_configuration exception is
+ * thrown.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * auto cfg = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+ *                                             seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+ *                                             seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+ *                                             seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+ *            seqan3::align_cfg::edit_scheme |
+ *            seqan3::align_cfg::min_score{-2} |
+ *            seqan3::align_cfg::all_hits{seqan3::align_cfg::local_maxima_only{true}} |
+ *            seqan3::align_cfg::output_score{} |
+ *            seqan3::align_cfg::output_end_position{} |
+ *            seqan3::align_cfg::on_result{[] (auto && hit) { seqan3::debug_stream << hit << '\n'; }};
+ * ```
+ */
+class all_hits : public pipeable_config_element<all_hits>
+{
+public:
+    //!\brief Whether only the local maxima of the score are reported [default: false].
+    bool local_maxima_only{false};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr all_hits() noexcept = default; //!< Defaulted
+    constexpr all_hits(all_hits const &) noexcept = default; //!< Defaulted
+    constexpr all_hits(all_hits &&) noexcept = default; //!< Defaulted
+    constexpr all_hits & operator=(all_hits const &) noexcept = default; //!< Defaulted
+    constexpr all_hits & operator=(all_hits &&) noexcept = default; //!< Defaulted
+    ~all_hits() noexcept = default; //!< Defaulted
+
+    /*!\brief Initialises the reporting of all hits.
+     *
+     * \param local_maxima_only \copybrief local_maxima_only
+     */
+    constexpr all_hits(seqan3::align_cfg::local_maxima_only const local_maxima_only) :
+        local_maxima_only{local_maxima_only.get()}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::all_hits};
+};
+
+} // namespace seqan3::align_cfg
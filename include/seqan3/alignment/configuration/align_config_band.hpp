@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides seqan3::detail::align_config_band.
+ * \brief Provides seqan3::align_cfg::band_fixed_size and seqan3::align_cfg::band_per_sequence_pair.
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
  * \author Rene Rahn <rene.rahn AT fu-berlin.de>
  */
@@ -18,6 +18,8 @@
 #include <seqan3/core/algorithm/pipeable_config_element.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/core/semiregular_box.hpp>
+#include <seqan3/std/concepts>
 
 namespace seqan3::align_cfg
 {
@@ -110,4 +112,90 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::band};
 };
 
+/*!\brief Configuration element for setting an individual band for every sequence pair.
+ * \ingroup alignment_configuration
+ *
+ * \tparam band_selector_t The type of the band selector; must model std::invocable with the index of the sequence pair
+ *                         and return a seqan3::align_cfg::band_fixed_size.
+ *
+ * \details
+ *
+ * In many applications, e.g. in read mapping, the candidate regions are verified with a banded alignment and every
+ * candidate comes with its own diagonal range determined by the seeding step. Instead of a single band that must cover
+ * the union of all these ranges, this configuration invokes the given band selector with the index of every sequence
+ * pair, i.e. the position of the sequence pair within the input range passed to seqan3::align_pairwise, and computes
+ * the alignment only inside the returned band. Every band is validated as described for
+ * seqan3::align_cfg::band_fixed_size.
+ *
+ * In combination with seqan3::align_cfg::vectorised the sequence pairs of one simd vector are computed in the smallest
+ * band that covers the bands of all sequence pairs of this vector. The cells outside of the band of the respective
+ * sequence pair are excluded from the computation of this sequence pair, such that the result is the same as
+ * computing every sequence pair separately within its own band. Note that the lanes are only masked, not shifted:
+ * the cells that are computed per simd vector are bounded by the covering band, not by the individual bands. The
+ * vectorised computation therefore only saves work if the bands of the sequence pairs of one simd vector overlap, e.g.
+ * if the sequence pairs are sorted by their bands.
+ *
+ * This configuration is only supported for the global alignment computing the score and, if not vectorised, the end
+ * positions.
+ *
+ * \if DEV
+ * The given band selector is wrapped inside a seqan3::semiregular_box wrapper type. This allows to also
+ * use lambdas with a capture block, which otherwise are not std::copy_assignable and therefore invalidate the
+ * requirements for the configuration element (must model std::semiregular).
+ * \endif
+ */
+template <std::copy_constructible band_selector_t>
+class band_per_sequence_pair : public pipeable_config_element<band_per_sequence_pair<band_selector_t>>
+{
+public:
+    // Checked here and not as constraint of the class template, since the constraint would be checked for every
+    // callable of a configuration, e.g. the generic lambda of seqan3::align_cfg::on_result, when the configuration is
+    // searched for this element.
+    static_assert(std::invocable<band_selector_t const &, size_t> &&
+                  std::convertible_to<std::invoke_result_t<band_selector_t const &, size_t>, band_fixed_size>,
+                  "The band selector must be invocable with the index of a sequence pair and must return a "
+                  "seqan3::align_cfg::band_fixed_size.");
+
+    //!\brief The stored callable which returns the band for the sequence pair with the given index.
+    seqan3::semiregular_box_t<band_selector_t> band_selector{};
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr band_per_sequence_pair() = default; //!< Defaulted.
+    constexpr band_per_sequence_pair(band_per_sequence_pair const &) = default; //!< Defaulted.
+    constexpr band_per_sequence_pair(band_per_sequence_pair &&) = default; //!< Defaulted.
+    constexpr band_per_sequence_pair & operator=(band_per_sequence_pair const &) = default; //!< Defaulted.
+    constexpr band_per_sequence_pair & operator=(band_per_sequence_pair &&) = default; //!< Defaulted.
+    ~band_per_sequence_pair() = default; //!< Defaulted.
+
+    /*!\brief Constructs the configuration element with the given band selector.
+     * \param[in] band_selector The callable returning the band for the index of a sequence pair.
+     */
+    constexpr explicit band_per_sequence_pair(band_selector_t band_selector) :
+        band_selector{std::move(band_selector)}
+    {}
+    //!\}
+
+    /*!\brief Returns the band for the sequence pair with the given index.
+     * \param[in] index The index of the sequence pair.
+     */
+    band_fixed_size operator()(size_t const index) const
+    {
+        return band_selector(index);
+    }
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::band};
+};
+
+/*!\name Type deduction guides
+ * \{
+ */
+//!\brief Deduces the band selector type from a forwarding constructor argument.
+template <std::copy_constructible band_selector_t>
+band_per_sequence_pair(band_selector_t &&) -> band_per_sequence_pair<std::decay_t<band_selector_t>>;
+//!\}
+
 } // namespace seqan3::align_cfg
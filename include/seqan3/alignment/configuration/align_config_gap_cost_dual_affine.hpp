@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::gap_cost_dual_affine.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief A configuration element for the dual affine (two-piece affine) gap cost scheme.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Configures two affine gap cost functions: one for short gaps, usually with a cheap gap open score and an expensive
+ * gap extension score, and one for long gaps, usually with an expensive gap open score and a cheap gap extension
+ * score. A stretch of `n` consecutive gap characters is scored with the better of both functions, i.e.
+ * `max(short.open_score + n * short.extension_score, long.open_score + n * long.extension_score)`. This concave gap
+ * cost function models small indels as well as large insertions and deletions, e.g. in alignments of long reads
+ * with a high indel error rate.
+ *
+ * This configuration replaces seqan3::align_cfg::gap_cost_affine and cannot be combined with it. It is supported for
+ * the scalar and the vectorised alignment computing the score, the end positions and, in the vectorised local
+ * alignment, the begin positions. It cannot be combined with a band or with seqan3::align_cfg::vectorised_striped,
+ * and the alignment cannot be requested.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * seqan3::align_cfg::gap_cost_dual_affine gap_cost{
+ *     seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4}, seqan3::align_cfg::extension_score{-2}},
+ *     seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-24}, seqan3::align_cfg::extension_score{-1}}};
+ * ```
+ */
+class gap_cost_dual_affine : public pipeable_config_element<gap_cost_dual_affine>
+{
+public:
+    //!\brief The gap cost function for short gaps. Defaults to a gap open score of 0 and a gap extension score of -1.
+    gap_cost_affine short_gap_cost{};
+    //!\brief The gap cost function for long gaps. Defaults to a gap open score of 0 and a gap extension score of -1.
+    gap_cost_affine long_gap_cost{};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr gap_cost_dual_affine() = default; //!< Defaulted
+    constexpr gap_cost_dual_affine(gap_cost_dual_affine const &) = default; //!< Defaulted
+    constexpr gap_cost_dual_affine(gap_cost_dual_affine &&) = default; //!< Defaulted
+    constexpr gap_cost_dual_affine & operator=(gap_cost_dual_affine const &) = default; //!< Defaulted
+    constexpr gap_cost_dual_affine & operator=(gap_cost_dual_affine &&) = default; //!< Defaulted
+    ~gap_cost_dual_affine() = default; //!< Defaulted
+
+    /*!\brief Construction from the gap cost functions for short and long gaps.
+     * \param short_gap_cost The gap cost function for short gaps (of type seqan3::align_cfg::gap_cost_affine).
+     * \param long_gap_cost The gap cost function for long gaps (of type seqan3::align_cfg::gap_cost_affine).
+     */
+    constexpr gap_cost_dual_affine(gap_cost_affine short_gap_cost, gap_cost_affine long_gap_cost) :
+        short_gap_cost{std::move(short_gap_cost)}, long_gap_cost{std::move(long_gap_cost)}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::gap};
+};
+
+} // namespace seqan3::align_cfg
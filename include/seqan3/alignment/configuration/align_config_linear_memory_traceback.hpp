@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_memory_traceback configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the alignment in linear memory instead of storing the full trace matrix.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default the computation of the alignment (seqan3::align_cfg::output_alignment) and of the begin positions
+ * (seqan3::align_cfg::output_begin_position) stores one trace direction per cell of the alignment matrix, i.e. the
+ * memory grows with the product of the sequence lengths. With this configuration the alignment is instead computed
+ * with the divide-and-conquer strategy of Hirschberg, extended to affine gap costs by Myers and Miller: the first
+ * sequence is split in the middle and a forward pass over the first half and a backward pass over the reversed second
+ * half determine where an optimal alignment crosses the middle. Both halves are then solved recursively.
+ * Only two score columns are kept at any time, such that the memory grows linearly with the length of the second
+ * sequence at the price of roughly doubling the runtime.
+ *
+ * This configuration can only be combined with the \ref seqan3::align_cfg::method_global "global alignment" without
+ * free end-gaps. It cannot be combined with a band, the vectorised alignment or seqan3::align_cfg::x_drop.
+ * If neither the alignment nor the begin positions are requested, this configuration has no effect since the score
+ * and the end positions are always computed in linear memory.
+ *
+ * \sa For further information see Myers, E. W., & Miller, W. (1988). Optimal alignments in linear space.
+ *     Bioinformatics, 4(1), 11-17.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * auto cfg = seqan3::align_cfg::method_global{} |
+ *            seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+ *            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+ *                                               seqan3::align_cfg::extension_score{-1}} |
+ *            seqan3::align_cfg::linear_memory_traceback{} |
+ *            seqan3::align_cfg::output_alignment{};
+ * ```
+ */
+class linear_memory_traceback : public pipeable_config_element<linear_memory_traceback>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr linear_memory_traceback() = default; //!< Defaulted.
+    constexpr linear_memory_traceback(linear_memory_traceback const &) = default; //!< Defaulted.
+    constexpr linear_memory_traceback(linear_memory_traceback &&) = default; //!< Defaulted.
+    constexpr linear_memory_traceback & operator=(linear_memory_traceback const &) = default; //!< Defaulted.
+    constexpr linear_memory_traceback & operator=(linear_memory_traceback &&) = default; //!< Defaulted.
+    ~linear_memory_traceback() = default; //!< Defaulted.
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::linear_memory_traceback};
+};
+
+} // namespace seqan3::align_cfg
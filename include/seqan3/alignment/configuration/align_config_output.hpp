@@ -115,6 +115,11 @@ public:
  * If this option is not set in the alignment configuration, accessing the begin positions via the
  * seqan3::alignment_result object is forbidden and will lead to a compile time error.
  *
+ * \note The unbanded vectorised global alignment computes the begin positions without a trace matrix and therefore
+ *       assumes that the alignment begins in the origin of the matrix. If free leading end gaps are configured for
+ *       either sequence via seqan3::align_cfg::method_global, this combination is not yet supported and throws
+ *       seqan3::invalid_alignment_configuration, unless seqan3::align_cfg::output_alignment is configured as well.
+ *
  * ### Example
  *
  * \include test/snippet/alignment/configuration/align_cfg_output_begin_position.cpp
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::packed_trace_matrix configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Stores the trace matrix with four bits per cell instead of one byte.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default the traceback stores one byte per cell of the alignment matrix. With this configuration two cells are
+ * packed into one byte, which halves the memory of the trace matrix. In return, every column is packed after it has
+ * been computed and every step of the traceback decodes the packed cell, such that the alignment is slightly slower.
+ * This pays off for long sequences, whose trace matrix does not fit into the cache or the main memory otherwise, but
+ * not for short reads.
+ *
+ * Currently, the packed trace matrix is only used for the unbanded global alignment that computes the begin positions
+ * (seqan3::align_cfg::output_begin_position) but not the alignment. For all other configurations, including the
+ * edit distance, seqan3::align_pairwise throws a seqan3::invalid_alignment_configuration. It cannot be combined with
+ * the vectorised alignment, seqan3::align_cfg::vectorised_striped, seqan3::align_cfg::wavefront or
+ * seqan3::align_cfg::linear_memory_traceback.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * auto cfg = seqan3::align_cfg::method_global{} |
+ *            seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+ *            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+ *                                               seqan3::align_cfg::extension_score{-1}} |
+ *            seqan3::align_cfg::packed_trace_matrix{} |
+ *            seqan3::align_cfg::output_begin_position{};
+ * ```
+ */
+class packed_trace_matrix : public pipeable_config_element<packed_trace_matrix>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr packed_trace_matrix() = default; //!< Defaulted.
+    constexpr packed_trace_matrix(packed_trace_matrix const &) = default; //!< Defaulted.
+    constexpr packed_trace_matrix(packed_trace_matrix &&) = default; //!< Defaulted.
+    constexpr packed_trace_matrix & operator=(packed_trace_matrix const &) = default; //!< Defaulted.
+    constexpr packed_trace_matrix & operator=(packed_trace_matrix &&) = default; //!< Defaulted.
+    ~packed_trace_matrix() = default; //!< Defaulted.
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::packed_trace_matrix};
+};
+
+} // namespace seqan3::align_cfg
@@ -31,6 +31,8 @@ namespace seqan3::align_cfg
  * Depending on your processor architecture you can gain a significant speed-up.
  *
  * The value represents the number of threads to be used and must be greater than `0`.
+ * To distribute the alignments with work stealing or to share a seqan3::thread_pool between several invocations, use
+ * seqan3::align_cfg::parallel_work_stealing instead.
  *
  * ### Example
  *
@@ -39,4 +41,25 @@ namespace seqan3::align_cfg
 using parallel = seqan3::detail::parallel_mode<std::integral_constant<seqan3::detail::align_config_id,
                                                                       seqan3::detail::align_config_id::parallel>>;
 
+/*!\brief Enables the parallel execution of the alignment algorithm with work stealing.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Like seqan3::align_cfg::parallel, but the alignments are distributed to the threads with work stealing, such that
+ * threads which finish their share early take over alignments from busy threads
+ * (see seqan3::detail::execution_handler_work_stealing). This pays off if the sequence pairs differ a lot in length.
+ *
+ * The value represents the number of threads to be used and must be greater than `0`.
+ * Alternatively, a seqan3::thread_pool can be given, whose threads are reused by every invocation of
+ * seqan3::align_pairwise configured with it instead of spawning new threads for every invocation.
+ * The thread pool must outlive the returned seqan3::algorithm_result_generator_range.
+ *
+ * This configuration element cannot be combined with seqan3::align_cfg::parallel.
+ */
+using parallel_work_stealing =
+    seqan3::detail::parallel_mode<std::integral_constant<seqan3::detail::align_config_id,
+                                                         seqan3::detail::align_config_id::parallel>,
+                                  true>;
+
 } // namespace seqan3::align_cfg
@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::query_profile.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/alignment/scoring/query_profile.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Sets a precomputed seqan3::query_profile for the alignment algorithm.
+ * \ingroup alignment_configuration
+ * \tparam query_profile_t The type of the query profile; must be a specialisation of seqan3::query_profile.
+ *
+ * \details
+ *
+ * The striped alignment (seqan3::align_cfg::vectorised_striped) computes a query profile of the second sequence for
+ * every sequence pair. If the same query is aligned against many targets, the profile can be computed once and passed
+ * with this configuration, such that its construction is amortised over all sequence pairs.
+ *
+ * The configuration stores a pointer to the given profile, i.e. the profile must outlive all alignment result ranges
+ * that were configured with it. The profile is used for every sequence pair whose second sequence equals the query of
+ * the profile; for other sequence pairs the profile is computed as usual. The profile must be computed with the
+ * configured scoring scheme and its score type must be the configured score type (see seqan3::align_cfg::score_type).
+ *
+ * This configuration requires seqan3::align_cfg::vectorised_striped, otherwise
+ * seqan3::invalid_alignment_configuration is thrown.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * seqan3::query_profile profile{query, scheme};
+ *
+ * auto cfg = seqan3::align_cfg::method_global{} |
+ *            seqan3::align_cfg::scoring_scheme{scheme} |
+ *            seqan3::align_cfg::vectorised_striped{} |
+ *            seqan3::align_cfg::query_profile{profile} |
+ *            seqan3::align_cfg::output_score{};
+ *
+ * auto results = seqan3::align_pairwise(seqan3::views::zip(database, seqan3::views::repeat(query)), cfg);
+ * ```
+ */
+template <typename query_profile_t>
+//!\cond
+    requires seqan3::detail::is_type_specialisation_of_v<query_profile_t, seqan3::query_profile>
+//!\endcond
+class query_profile : public pipeable_config_element<query_profile<query_profile_t>>
+{
+public:
+    //!\brief The precomputed query profile; must outlive the alignment.
+    query_profile_t const * profile{nullptr};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr query_profile() = default; //!< Defaulted
+    constexpr query_profile(query_profile const &) = default; //!< Defaulted
+    constexpr query_profile(query_profile &&) = default; //!< Defaulted
+    constexpr query_profile & operator=(query_profile const &) = default; //!< Defaulted
+    constexpr query_profile & operator=(query_profile &&) = default; //!< Defaulted
+    ~query_profile() = default; //!< Defaulted
+
+    /*!\brief Initialises the configuration with the given query profile.
+     * \param[in] profile The precomputed query profile; must outlive the alignment.
+     */
+    constexpr explicit query_profile(query_profile_t const & profile) noexcept : profile{&profile}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::query_profile};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::align_cfg::query_profile
+ * \{
+ */
+
+//!\brief Deduces the query profile type from the constructor argument.
+template <typename query_profile_t>
+query_profile(query_profile_t const &) -> query_profile<query_profile_t>;
+//!\}
+
+} // namespace seqan3::align_cfg
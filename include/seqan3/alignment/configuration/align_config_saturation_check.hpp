@@ -0,0 +1,61 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::detail::saturation_check.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg::detail
+{
+/*!\brief Configuration element to detect scores of the vectorised alignment that exceed the configured score type.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The seqan3::detail::pairwise_alignment_algorithm_adaptive computes the sequence pairs first with a narrow score type
+ * and adds this configuration element to the configuration of the narrow algorithms. The vectorised alignment then
+ * tracks the largest score of every lane. If any score of a batch comes closer to the largest value of the score type
+ * than the maximal substitution score, the next cell could overflow. In this case no result is reported for the entire
+ * batch, such that the adaptive algorithm can compute the batch again with the next wider score type.
+ *
+ * \note This configuration element is only added internally during the alignment configuration and is not intended for
+ *       public use.
+ */
+class saturation_check : public pipeable_config_element<saturation_check>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr saturation_check() = default; //!< Defaulted.
+    constexpr saturation_check(saturation_check const &) = default; //!< Defaulted.
+    constexpr saturation_check(saturation_check &&) = default; //!< Defaulted.
+    constexpr saturation_check & operator=(saturation_check const &) = default; //!< Defaulted.
+    constexpr saturation_check & operator=(saturation_check &&) = default; //!< Defaulted.
+    ~saturation_check() = default; //!< Defaulted.
+
+    /*!\brief Initialises the saturation check with the maximal substitution score.
+     * \param[in] max_sequence_score The maximal score that a single cell adds to its diagonal predecessor.
+     */
+    constexpr explicit saturation_check(int32_t const max_sequence_score) noexcept :
+        max_sequence_score{max_sequence_score}
+    {}
+    //!\}
+
+    //!\brief The maximal substitution score including the score of the padded symbols.
+    int32_t max_sequence_score{};
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::saturation_check};
+};
+} // namespace seqan3::align_cfg::detail
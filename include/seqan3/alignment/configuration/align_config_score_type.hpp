@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides alignment configuration seqan3::align_cfg::score_type.
+ * \brief Provides alignment configuration seqan3::align_cfg::score_type and seqan3::align_cfg::score_type_adaptive.
  * \author Lydia Buntrock <lydia.buntrock AT fu-berlin.de>
  */
 
@@ -58,4 +58,45 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_type};
 };
 
+/*!\brief A configuration element to let the vectorised alignment select the score width for every sequence pair.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The number of alignments that can be computed simultaneously in the vectorised alignment depends on the bit width of
+ * the score type, e.g. a 256 bit wide simd vector holds 32 scores of type `int8_t` but only 8 scores of type `int32_t`.
+ * With seqan3::align_cfg::score_type the same score type is used for all sequence pairs, such that it must be chosen
+ * large enough for the longest sequences to avoid an overflow.
+ *
+ * If this configuration is used in combination with seqan3::align_cfg::vectorised, every sequence pair is computed with
+ * the narrowest score type, i.e. `int8_t`, `int16_t` or `int32_t`, that covers the lowest score of the alignment
+ * matrix. This bound is derived from the lengths of the sequences and the gap costs. The largest score depends on the
+ * similarity of the sequences and is checked during the computation instead: if a score of the narrower score type
+ * gets close to an overflow, the sequence pairs computed together with it are computed again with the next wider one.
+ * For the banded local alignment and the banded alignment computing more than the score, the score of a path with only
+ * matches must fit into the narrower score type instead.
+ * The computed scores are always reported as `int32_t`.
+ *
+ * This configuration cannot be combined with seqan3::align_cfg::score_type. Without seqan3::align_cfg::vectorised
+ * the alignment is computed with `int32_t`.
+ */
+class score_type_adaptive : public pipeable_config_element<score_type_adaptive>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr score_type_adaptive() = default; //!< Defaulted.
+    constexpr score_type_adaptive(score_type_adaptive const &) = default; //!< Defaulted.
+    constexpr score_type_adaptive(score_type_adaptive &&) = default; //!< Defaulted.
+    constexpr score_type_adaptive & operator=(score_type_adaptive const &) = default; //!< Defaulted.
+    constexpr score_type_adaptive & operator=(score_type_adaptive &&) = default; //!< Defaulted.
+    ~score_type_adaptive() = default; //!< Defaulted.
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_type};
+};
+
 } // namespace seqan3::align_cfg
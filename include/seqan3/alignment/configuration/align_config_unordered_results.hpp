@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::unordered_results.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Streams the alignment results of a parallel computation in the order in which they are completed.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default, the parallel alignment computation returns the results in the order of the input sequence pairs.
+ * To do so, all results are buffered until the alignments of all preceding sequence pairs have been computed, such
+ * that fast threads stall behind slow ones and the buffer grows with the number of sequence pairs.
+ * With this configuration the results are delivered as soon as they are computed instead. The results are passed
+ * from the threads to the consumer through a queue of a fixed size, which bounds the memory footprint: If the
+ * consumer is slower than the threads, the threads wait until space becomes available in the queue.
+ *
+ * Since the order of the results is not defined, the seqan3::align_cfg::output_sequence1_id and
+ * seqan3::align_cfg::output_sequence2_id configurations are added automatically to identify the sequence pair of a
+ * result. This configuration only has an effect in combination with seqan3::align_cfg::parallel; the sequential
+ * computation produces the results in the input order anyway.
+ *
+ * If the range over the results is destroyed before all results have been consumed, the sequence pairs which are not
+ * yet in computation are skipped.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * auto cfg = seqan3::align_cfg::method_global{} |
+ *            seqan3::align_cfg::edit_scheme |
+ *            seqan3::align_cfg::output_score{} |
+ *            seqan3::align_cfg::parallel{4} |
+ *            seqan3::align_cfg::unordered_results{};
+ *
+ * for (auto && result : seqan3::align_pairwise(sequence_pairs, cfg))
+ *     write(result.sequence1_id(), result.score());
+ * ```
+ */
+class unordered_results : public pipeable_config_element<unordered_results>
+{
+public:
+    //!\brief The maximal number of results buffered between the threads and the consumer [default: 1024].
+    uint32_t buffer_size{1024};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr unordered_results() noexcept = default; //!< Defaulted
+    constexpr unordered_results(unordered_results const &) noexcept = default; //!< Defaulted
+    constexpr unordered_results(unordered_results &&) noexcept = default; //!< Defaulted
+    constexpr unordered_results & operator=(unordered_results const &) noexcept = default; //!< Defaulted
+    constexpr unordered_results & operator=(unordered_results &&) noexcept = default; //!< Defaulted
+    ~unordered_results() noexcept = default; //!< Defaulted
+
+    /*!\brief Initialises the unordered results with the given buffer size.
+     * \param buffer_size \copybrief buffer_size Must be greater than `0`.
+     */
+    constexpr explicit unordered_results(uint32_t const buffer_size) noexcept : buffer_size{buffer_size}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::unordered_results};
+};
+
+} // namespace seqan3::align_cfg
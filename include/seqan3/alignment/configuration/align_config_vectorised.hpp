@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides seqan3::align_cfg::vectorised configuration.
+ * \brief Provides seqan3::align_cfg::vectorised and seqan3::align_cfg::vectorised_striped configuration.
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
  * \author Lydia Buntrock <lydia.buntrock AT fu-berlin.de>
  */
@@ -32,6 +32,10 @@ namespace seqan3::align_cfg
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
  *
+ * Combined with seqan3::align_cfg::edit_scheme, the bit-vectors of up to 4, 8 or 16 queries (the second sequences)
+ * are packed into the lanes of one SIMD register if the queries are not longer than 32 or 64 symbols. This applies if
+ * only the score, the end positions or the ids are requested. All other sequence pairs are computed one after another.
+ *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
  * ### Example
@@ -57,4 +61,42 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::vectorised};
 };
 
+/*!\brief Enables the striped vectorisation of a single alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In contrast to seqan3::align_cfg::vectorised, which computes several alignments simultaneously, this mode
+ * vectorises the computation of a single alignment. It follows the striped approach of Farrar, where the second
+ * sequence is divided into as many segments as the SIMD register has lanes and each lane processes one segment
+ * within the same column of the alignment matrix. A query profile is precomputed once per alignment and the
+ * remaining dependencies between the lanes are resolved in a lazy pass over the column.
+ *
+ * This mode pays off for few but long sequence pairs, for which the inter-sequence vectorisation cannot fill the SIMD
+ * registers. It can be combined with the global and the local alignment method and supports the output of the score
+ * and the end positions. The computation of the begin positions or the alignment, a band as well as free end-gaps
+ * are not supported in this mode and throw a seqan3::invalid_alignment_configuration exception.
+ *
+ * \sa For further information on the striped alignment see Farrar, M. (2007). Striped Smith-Waterman speeds database
+ *     searches six times over other SIMD implementations. Bioinformatics, 23(2), 156-161.
+ */
+class vectorised_striped : public pipeable_config_element<vectorised_striped>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr vectorised_striped() = default; //!< Defaulted.
+    constexpr vectorised_striped(vectorised_striped const &) = default; //!< Defaulted.
+    constexpr vectorised_striped(vectorised_striped &&) = default; //!< Defaulted.
+    constexpr vectorised_striped & operator=(vectorised_striped const &) = default; //!< Defaulted.
+    constexpr vectorised_striped & operator=(vectorised_striped &&) = default; //!< Defaulted.
+    ~vectorised_striped() = default; //!< Defaulted.
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::vectorised_striped};
+};
+
 } // namespace seqan3::align_cfg
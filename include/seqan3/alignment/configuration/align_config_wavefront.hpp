@@ -0,0 +1,70 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the global alignment with the wavefront algorithm.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Instead of computing every cell of the alignment matrix, the wavefront alignment algorithm (WFA) only tracks, for
+ * every reachable score and every diagonal, the furthest cell that can be reached with this score. Runs of matching
+ * symbols are skipped by comparing the sequences directly. The runtime is thereby in \f$ O((n+m) * s) \f$ for the
+ * alignment score `s`, which is much faster than the dynamic programming algorithm for similar sequences. The memory
+ * required to compute the alignment grows with \f$ s^2 \f$, such that the algorithm is not suited for divergent
+ * sequences.
+ *
+ * The algorithm computes the same optimal global alignment as the dynamic programming algorithm, including
+ * the alignment itself if seqan3::align_cfg::output_alignment is requested. It is restricted to the
+ * \ref seqan3::align_cfg::method_global "global alignment" without free end-gaps, to the affine gap costs of
+ * seqan3::align_cfg::gap_cost_affine and to scoring schemes with a single match and a single mismatch score, e.g.
+ * seqan3::nucleotide_scoring_scheme or the edit distance. The match score must be non-negative and larger than
+ * the mismatch score. Otherwise, seqan3::invalid_alignment_configuration is thrown.
+ *
+ * \sa For further information see Marco-Sola, S., et al. (2021). Fast gap-affine pairwise alignment using the
+ *     wavefront algorithm. Bioinformatics, 37(4), 456-463.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * auto cfg = seqan3::align_cfg::method_global{} |
+ *            seqan3::align_cfg::edit_scheme |
+ *            seqan3::align_cfg::wavefront{} |
+ *            seqan3::align_cfg::output_alignment{};
+ * ```
+ */
+class wavefront : public pipeable_config_element<wavefront>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr wavefront() = default; //!< Defaulted.
+    constexpr wavefront(wavefront const &) = default; //!< Defaulted.
+    constexpr wavefront(wavefront &&) = default; //!< Defaulted.
+    constexpr wavefront & operator=(wavefront const &) = default; //!< Defaulted.
+    constexpr wavefront & operator=(wavefront &&) = default; //!< Defaulted.
+    ~wavefront() = default; //!< Defaulted.
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,81 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::x_drop configuration.
+ */
+
+#pragma once
+
+#include <limits>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Terminates the alignment early once the score drops too far below the best score found so far.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This configuration turns the \ref seqan3::align_cfg::method_global "global alignment" into an anchored extension:
+ * the alignment still starts in the origin of the alignment matrix, but it may end in any cell of the matrix.
+ * The matrix is computed column by column and after every column the algorithm checks if the scores of all
+ * computed cells in this column are more than seqan3::align_cfg::x_drop::value below the best score found so far.
+ * In this case the computation stops and the algorithm reports the best score together with the position of the
+ * cell where it was found. Since no alignment can recover from such a drop without first gaining back the lost score,
+ * this avoids computing the remainder of the matrix when extending seeds into diverging flanking regions.
+ *
+ * The score is only checked at the granularity of entire columns, i.e. cells inside of a column that already fell
+ * below the threshold are still computed as long as another cell of the same column is above the threshold.
+ * If the alignment is \ref seqan3::align_cfg::vectorised "vectorised", the computation stops as soon as all
+ * sequence pairs in the current batch are terminated.
+ *
+ * This configuration can only be combined with the global alignment method and cannot be used together with
+ * seqan3::align_cfg::output_alignment or seqan3::align_cfg::output_begin_position.
+ * Otherwise a seqan3::invalid_alignment_configuration exception will be thrown.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * auto cfg = seqan3::align_cfg::method_global{} |
+ *            seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+ *            seqan3::align_cfg::x_drop{20} |
+ *            seqan3::align_cfg::output_score{} |
+ *            seqan3::align_cfg::output_end_position{};
+ * ```
+ */
+class x_drop : public pipeable_config_element<x_drop>
+{
+public:
+    //!\brief The maximal score drop below the best score before the computation is terminated [default: infinity].
+    int32_t value{std::numeric_limits<int32_t>::max()};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr x_drop() noexcept = default; //!< Defaulted
+    constexpr x_drop(x_drop const &) noexcept = default; //!< Defaulted
+    constexpr x_drop(x_drop &&) noexcept = default; //!< Defaulted
+    constexpr x_drop & operator=(x_drop const &) noexcept = default; //!< Defaulted
+    constexpr x_drop & operator=(x_drop &&) noexcept = default; //!< Defaulted
+    ~x_drop() noexcept = default; //!< Defaulted
+
+    /*!\brief Initialises the maximal score drop.
+     *
+     * \param value \copybrief value
+     */
+    constexpr x_drop(int32_t const value) : value{value}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::x_drop};
+};
+
+} // namespace seqan3::align_cfg
@@ -12,19 +12,28 @@
 
 #pragma once
 
+#include <seqan3/alignment/configuration/align_config_all_hits.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_packed_trace_matrix.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_saturation_check.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_unordered_results.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
 #include <seqan3/alignment/configuration/detail.hpp>
 
 /*!\namespace seqan3::align_cfg
@@ -22,25 +22,34 @@ namespace seqan3::detail
  */
 enum struct align_config_id : uint8_t
 {
-    band,                  //!< ID for the \ref seqan3::align_cfg::band_fixed_size "band" option.
-    debug,                 //!< ID for the \ref seqan3::align_cfg::detail::debug "debug" option.
-    gap,                   //!< ID for the \ref seqan3::align_cfg::gap_cost_affine "gap_cost_affine" option.
-    global,                //!< ID for the \ref seqan3::align_cfg::method_global "global alignment" option.
-    local,                 //!< ID for the \ref seqan3::align_cfg::method_local "local alignment" option.
-    min_score,             //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
-    on_result,             //!< ID for the \ref seqan3::align_cfg::on_result "on_result" option.
-    output_alignment,      //!< ID for the \ref seqan3::align_cfg::output_alignment "alignment output" option.
-    output_begin_position, //!< ID for the \ref seqan3::align_cfg::output_begin_position "begin position output" option.
-    output_end_position,   //!< ID for the \ref seqan3::align_cfg::output_end_position "end position output" option.
-    output_sequence1_id,   //!< ID for the \ref seqan3::align_cfg::output_sequence1_id "sequence1 id output" option.
-    output_sequence2_id,   //!< ID for the \ref seqan3::align_cfg::output_sequence2_id "sequence2 id output" option.
-    output_score,          //!< ID for the \ref seqan3::align_cfg::output_score "score output" option.
-    parallel,              //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
-    result_type,           //!< ID for the \ref seqan3::align_cfg::detail::result_type "result_type" option.
-    score_type,            //!< ID for the \ref seqan3::align_cfg::score_type "score_type" option.
-    scoring,               //!< ID for the \ref seqan3::align_cfg::scoring_scheme "scoring_scheme" option.
-    vectorised,            //!< ID for the \ref seqan3::align_cfg::vectorised "vectorised" option.
-    SIZE                   //!< Represents the number of configuration elements.
+    all_hits,                //!< ID for the \ref seqan3::align_cfg::all_hits "all_hits" option.
+    band,                    //!< ID for the \ref seqan3::align_cfg::band_fixed_size "band" option.
+    debug,                   //!< ID for the \ref seqan3::align_cfg::detail::debug "debug" option.
+    gap,                     //!< ID for the \ref seqan3::align_cfg::gap_cost_affine "gap cost" options.
+    global,                  //!< ID for the \ref seqan3::align_cfg::method_global "global alignment" option.
+    linear_memory_traceback, //!< ID for the \ref seqan3::align_cfg::linear_memory_traceback "linear memory" option.
+    local,                   //!< ID for the \ref seqan3::align_cfg::method_local "local alignment" option.
+    min_score,               //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
+    on_result,               //!< ID for the \ref seqan3::align_cfg::on_result "on_result" option.
+    output_alignment,        //!< ID for the \ref seqan3::align_cfg::output_alignment "alignment output" option.
+    output_begin_position,   //!< ID for the \ref seqan3::align_cfg::output_begin_position "begin position output" option.
+    output_end_position,     //!< ID for the \ref seqan3::align_cfg::output_end_position "end position output" option.
+    output_sequence1_id,     //!< ID for the \ref seqan3::align_cfg::output_sequence1_id "sequence1 id output" option.
+    output_sequence2_id,     //!< ID for the \ref seqan3::align_cfg::output_sequence2_id "sequence2 id output" option.
+    output_score,            //!< ID for the \ref seqan3::align_cfg::output_score "score output" option.
+    packed_trace_matrix,     //!< ID for the \ref seqan3::align_cfg::packed_trace_matrix "packed trace" option.
+    parallel,                //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
+    query_profile,           //!< ID for the \ref seqan3::align_cfg::query_profile "query_profile" option.
+    result_type,             //!< ID for the \ref seqan3::align_cfg::detail::result_type "result_type" option.
+    saturation_check,        //!< ID for the \ref seqan3::align_cfg::detail::saturation_check "saturation_check" option.
+    score_type,              //!< ID for the \ref seqan3::align_cfg::score_type "score_type" option.
+    scoring,                 //!< ID for the \ref seqan3::align_cfg::scoring_scheme "scoring_scheme" option.
+    unordered_results,       //!< ID for the \ref seqan3::align_cfg::unordered_results "unordered_results" option.
+    vectorised,              //!< ID for the \ref seqan3::align_cfg::vectorised "vectorised" option.
+    vectorised_striped,      //!< ID for the \ref seqan3::align_cfg::vectorised_striped "vectorised_striped" option.
+    wavefront,               //!< ID for the \ref seqan3::align_cfg::wavefront "wavefront" option.
+    x_drop,                  //!< ID for the \ref seqan3::align_cfg::x_drop "x_drop" option.
+    SIZE                     //!< Represents the number of configuration elements.
 };
 
 // ----------------------------------------------------------------------------
@@ -56,42 +65,60 @@ template <>
 inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_id::SIZE)>,
                             static_cast<uint8_t>(align_config_id::SIZE)> compatibility_table<align_config_id>
 {
-    {   //band
-        //|  debug
-        //|  |  gap
-        //|  |  |  global
-        //|  |  |  |  local
-        //|  |  |  |  |  min_score
-        //|  |  |  |  |  |  on_result
-        //|  |  |  |  |  |  |  output_alignment
-        //|  |  |  |  |  |  |  |  output_begin_position
-        //|  |  |  |  |  |  |  |  |  output_end_position
-        //|  |  |  |  |  |  |  |  |  |  output_sequence1_id
-        //|  |  |  |  |  |  |  |  |  |  |  output_sequence2_id
-        //|  |  |  |  |  |  |  |  |  |  |  |  output_score
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  parallel
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  result_type
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  | score_type
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  scoring
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised
-        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  0: band
-        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: debug
-        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: gap
-        { 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: global
-        { 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: local
-        { 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  5: max_error
-        { 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  6: on_result
-        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  7: output_alignment
-        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  8: output_begin_position
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // 9: output_end_position
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // 10: output_sequence1_id
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 11: output_sequence2_id
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 12: output_score
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 13: parallel
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // 14: result_type
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, // 15: score_type
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, // 16: scoring
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // 17: vectorised
+    {   //all_hits
+        //|  band
+        //|  |  debug
+        //|  |  |  gap
+        //|  |  |  |  global
+        //|  |  |  |  |  linear_memory_traceback
+        //|  |  |  |  |  |  local
+        //|  |  |  |  |  |  |  min_score
+        //|  |  |  |  |  |  |  |  on_result
+        //|  |  |  |  |  |  |  |  |  output_alignment
+        //|  |  |  |  |  |  |  |  |  |  output_begin_position
+        //|  |  |  |  |  |  |  |  |  |  |  output_end_position
+        //|  |  |  |  |  |  |  |  |  |  |  |  output_sequence1_id
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  output_sequence2_id
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  output_score
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  packed_trace_matrix
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  parallel
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  query_profile
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  result_type
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  saturation_check
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  score_type
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  scoring
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  unordered_results
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised_striped
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  wavefront
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  x_drop
+        { 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0}, //  0: all_hits
+        { 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1}, //  1: band
+        { 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1}, //  2: debug
+        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: gap
+        { 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: global
+        { 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0}, //  5: linear_memory_traceback
+        { 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0}, //  6: local
+        { 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, //  7: max_error
+        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  8: on_result
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  9: output_alignment
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 10: output_begin_position
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 11: output_end_position
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 12: output_sequence1_id
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 13: output_sequence2_id
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 14: output_score
+        { 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1}, // 15: packed_trace_matrix
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 16: parallel
+        { 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0}, // 17: query_profile
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // 18: result_type
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // 19: saturation_check
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 20: score_type
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 21: scoring
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 22: unordered_results
+        { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 1}, // 23: vectorised
+        { 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0}, // 24: vectorised_striped
+        { 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0}, // 25: wavefront
+        { 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0}  // 26: x_drop
     }
 };
 
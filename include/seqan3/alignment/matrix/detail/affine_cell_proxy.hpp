@@ -63,6 +63,28 @@ SEQAN3_CONCEPT affine_score_cell = tuple_like<t> &&
                                    arithmetic_or_simd<std::remove_reference_t<std::tuple_element_t<2, t>>>;
 //!\endcond
 
+/*!\interface seqan3::detail::dual_affine_score_cell <>
+ * \extends seqan3::tuple_like
+ * \brief The concept for a type that models a dual affine cell of the score matrix.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * This concept describes the requirements an alignment matrix cell must fulfil to represent a score matrix entry
+ * for the dual affine gap cost model (see seqan3::align_cfg::gap_cost_dual_affine). In addition to the scores of
+ * seqan3::detail::affine_score_cell, the cell stores the horizontal and the vertical score of the long gaps.
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT dual_affine_score_cell = tuple_like<t> &&
+                                        std::tuple_size_v<t> == 5 &&
+                                        arithmetic_or_simd<std::remove_reference_t<std::tuple_element_t<0, t>>> &&
+                                        arithmetic_or_simd<std::remove_reference_t<std::tuple_element_t<1, t>>> &&
+                                        arithmetic_or_simd<std::remove_reference_t<std::tuple_element_t<2, t>>> &&
+                                        arithmetic_or_simd<std::remove_reference_t<std::tuple_element_t<3, t>>> &&
+                                        arithmetic_or_simd<std::remove_reference_t<std::tuple_element_t<4, t>>>;
+//!\endcond
+
 /*!\interface seqan3::detail::affine_trace_cell <>
  * \extends seqan3::tuple_like
  * \brief The concept for a type that models an affine cell of the trace matrix.
@@ -105,24 +127,28 @@ SEQAN3_CONCEPT affine_score_and_trace_cell = tuple_like<t> &&
  * \ingroup alignment_matrix
  *
  * \tparam tuple_t The underlying cell type of the affine alignment matrix; must model
- *                 seqan3::detail::affine_score_cell or seqan3::detail::affine_score_and_trace_cell.
+ *                 seqan3::detail::affine_score_cell, seqan3::detail::dual_affine_score_cell or
+ *                 seqan3::detail::affine_score_and_trace_cell.
  *
  * \details
  *
  * This wrapper provides a uniform access to the different elements of the cell within an affine score matrix. This
  * includes the best score, the horizontal gap score and the vertical gap score. In case of a combined alignment
  * matrix including the trace matrix, the interface is extended to also access the best, horizontal, and vertical trace
- * value.
+ * value. In case of a dual affine score cell, the interface is extended to also access the long horizontal and the
+ * long vertical gap score.
  */
 template <typename tuple_t>
 //!\cond
-    requires (affine_score_cell<tuple_t> || affine_score_and_trace_cell<tuple_t>)
+    requires (affine_score_cell<tuple_t> || dual_affine_score_cell<tuple_t> || affine_score_and_trace_cell<tuple_t>)
 //!\endcond
 class affine_cell_proxy : public tuple_t
 {
 private:
     //!\brief The type of the score cell.
-    using score_cell_type = std::conditional_t<affine_score_cell<tuple_t>, tuple_t, std::tuple_element_t<0, tuple_t>>;
+    using score_cell_type = std::conditional_t<affine_score_cell<tuple_t> || dual_affine_score_cell<tuple_t>,
+                                               tuple_t,
+                                               std::tuple_element_t<0, tuple_t>>;
     //!\brief The type of the trace cell (might be seqan3::detail::empty_type if not defined).
     using trace_cell_type = std::conditional_t<affine_score_and_trace_cell<tuple_t>,
                                                std::tuple_element_t<1, tuple_t>,
@@ -260,6 +286,84 @@ public:
         return get_score_impl<2>(std::move(*this));
 #endif // SEQAN3_WORKAROUND_GCC_94967
     }
+
+    //!\brief Access the long horizontal score of the wrapped dual affine score matrix cell.
+    decltype(auto) long_horizontal_score() & noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+        return get_score_impl<3>(*this);
+    }
+    //!\overload
+    decltype(auto) long_horizontal_score() const & noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+        return get_score_impl<3>(*this);
+    }
+    //!\overload
+    decltype(auto) long_horizontal_score() && noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+        return get_score_impl<3>(std::move(*this));
+    }
+    //!\overload
+    decltype(auto) long_horizontal_score() const && noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+#if SEQAN3_WORKAROUND_GCC_94967
+        // A simple std::move(...) does not work, because it would mess up tuple_element types like `int const &`
+        using return_t = std::tuple_element_t<3, score_cell_type>;
+        return static_cast<return_t const &&>(get_score_impl<3>(std::move(*this)));
+#else // ^^^ workaround / no workaround vvv
+        return get_score_impl<3>(std::move(*this));
+#endif // SEQAN3_WORKAROUND_GCC_94967
+    }
+
+    //!\brief Access the long vertical score of the wrapped dual affine score matrix cell.
+    decltype(auto) long_vertical_score() & noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+        return get_score_impl<4>(*this);
+    }
+    //!\overload
+    decltype(auto) long_vertical_score() const & noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+        return get_score_impl<4>(*this);
+    }
+    //!\overload
+    decltype(auto) long_vertical_score() && noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+        return get_score_impl<4>(std::move(*this));
+    }
+    //!\overload
+    decltype(auto) long_vertical_score() const && noexcept
+    //!\cond
+        requires dual_affine_score_cell<tuple_t>
+    //!\endcond
+    {
+#if SEQAN3_WORKAROUND_GCC_94967
+        // A simple std::move(...) does not work, because it would mess up tuple_element types like `int const &`
+        using return_t = std::tuple_element_t<4, score_cell_type>;
+        return static_cast<return_t const &&>(get_score_impl<4>(std::move(*this)));
+#else // ^^^ workaround / no workaround vvv
+        return get_score_impl<4>(std::move(*this));
+#endif // SEQAN3_WORKAROUND_GCC_94967
+    }
     //!\}
 
     /*!\name Trace value accessor
@@ -386,7 +490,7 @@ public:
 
 private:
     /*!\brief Implements the get interface for the various calls to receive the score value.
-     * \tparam index The index of the tuple element to get; must be smaller than 3.
+     * \tparam index The index of the tuple element to get; must be smaller than the size of the score cell.
      * \tparam this_t The perfectly forwarded type of `*this`.
      *
      * \param[in] me The instance of `*this`.
@@ -395,13 +499,13 @@ private:
      */
     template <size_t index, typename this_t>
     //!\cond
-        requires (index < 3)
+        requires (index < std::tuple_size_v<score_cell_type>)
     //!\endcond
     static constexpr decltype(auto) get_score_impl(this_t && me) noexcept
     {
         using std::get;
 
-        if constexpr (affine_score_cell<tuple_t>)
+        if constexpr (affine_score_cell<tuple_t> || dual_affine_score_cell<tuple_t>)
             return get<index>(std::forward<this_t>(me));
         else
             return get<index>(get<0>(std::forward<this_t>(me)));
@@ -439,14 +543,16 @@ namespace std
 //!\cond
 template <typename tuple_t>
 //!\cond
-    requires (seqan3::detail::affine_score_cell<tuple_t> || seqan3::detail::affine_score_and_trace_cell<tuple_t>)
+    requires (seqan3::detail::affine_score_cell<tuple_t> || seqan3::detail::dual_affine_score_cell<tuple_t> ||
+              seqan3::detail::affine_score_and_trace_cell<tuple_t>)
 //!\endcond
 struct tuple_size<seqan3::detail::affine_cell_proxy<tuple_t>> : public tuple_size<tuple_t>
 {};
 
 template <size_t index, typename tuple_t>
 //!\cond
-    requires (seqan3::detail::affine_score_cell<tuple_t> || seqan3::detail::affine_score_and_trace_cell<tuple_t>)
+    requires (seqan3::detail::affine_score_cell<tuple_t> || seqan3::detail::dual_affine_score_cell<tuple_t> ||
+              seqan3::detail::affine_score_and_trace_cell<tuple_t>)
 //!\endcond
 struct tuple_element<index, seqan3::detail::affine_cell_proxy<tuple_t>> : public tuple_element<index, tuple_t>
 {};
@@ -22,6 +22,7 @@
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/detail/is_class_template_declarable.hpp>
+#include <seqan3/range/container/concept.hpp>
 #include <seqan3/range/decorator/gap_decorator.hpp>
 #include <seqan3/range/views/convert.hpp>
 #include <seqan3/range/views/slice.hpp>
@@ -177,7 +178,10 @@ public:
         std::tie(res.first_sequence_slice_positions.second, res.second_sequence_slice_positions.second) =
             std::pair<size_t, size_t>{trace_it.coordinate()};
 
-        std::vector<std::pair<trace_directions, size_t>> trace_segments;
+        // The segment buffer is reused by all alignments computed on this thread, such that it does not need to be
+        // allocated once it has grown to the length of the longest trace path.
+        static thread_local std::vector<std::pair<trace_directions, size_t>> trace_segments{};
+        trace_segments.clear();
 
         while (trace_it != std::ranges::end(trace_path))
         {
@@ -223,6 +227,17 @@ private:
         if (std::ranges::empty(rev_traces))
             return;
 
+        // Both aligned sequences have the length of the trace path. Reserving it upfront avoids repeated reallocations
+        // while the gaps are inserted.
+        size_t aligned_length = 0;
+        for (auto const & segment : rev_traces)
+            aligned_length += segment.second;
+
+        if constexpr (reservible_container<fst_aligned_t>)
+            fst_aligned.reserve(aligned_length);
+        if constexpr (reservible_container<sec_aligned_t>)
+            sec_aligned.reserve(aligned_length);
+
         auto fst_it = std::ranges::begin(fst_aligned);
         auto sec_it = std::ranges::begin(sec_aligned);
 
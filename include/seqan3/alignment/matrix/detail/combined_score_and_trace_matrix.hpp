@@ -82,7 +82,8 @@ public:
      *
      * \details
      *
-     * Resizes the underlying score and trace matrix to the given dimensions.
+     * Resizes the underlying score and trace matrix to the given dimensions. The matrices are resized in place, such
+     * that the memory allocated for a previous alignment is reused if it is large enough.
      *
      * ### Complexity
      *
@@ -90,21 +91,15 @@ public:
      *
      * ### Exception
      *
-     * Strong exception guarantee. Might throw std::bad_alloc.
+     * Basic exception guarantee. Might throw std::bad_alloc.
      */
     template <std::integral column_index_t, std::integral row_index_t>
     void resize(column_index_type<column_index_t> const column_count,
                 row_index_type<row_index_t> const row_count,
                 score_type const initial_score = score_type{})
     {
-        score_matrix_t tmp_score_matrix{};
-        tmp_score_matrix.resize(column_count, row_count, initial_score);
-
-        trace_matrix_t tmp_trace_matrix{};
-        tmp_trace_matrix.resize(column_count, row_count);
-
-        score_matrix = std::move(tmp_score_matrix);
-        trace_matrix = std::move(tmp_trace_matrix);
+        score_matrix.resize(column_count, row_count, initial_score);
+        trace_matrix.resize(column_count, row_count);
     }
 
     /*!\name Iterators
@@ -141,6 +136,20 @@ public:
     {
         return trace_matrix.trace_path(from_coordinate);
     }
+
+    /*!\brief Returns the trace path of a single alignment of the vectorised alignment starting from the given
+     *        coordinate and ending in the cell with seqan3::detail::trace_directions::none.
+     * \param[in] from_coordinate A seqan3::matrix_coordinate pointing to the start of the trace to follow.
+     * \param[in] lane The lane of the simd vector storing the traces of the respective alignment.
+     *
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     *
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     */
+    auto trace_path(matrix_coordinate const & from_coordinate, size_t const lane) const
+    {
+        return trace_matrix.trace_path(from_coordinate, lane);
+    }
 };
 
 /*!\brief Combined score and trace matrix iterator for the pairwise sequence alignment.
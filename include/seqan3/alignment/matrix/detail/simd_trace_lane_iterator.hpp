@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::simd_trace_lane_iterator.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_concept.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A two-dimensional matrix iterator over a single lane of a trace matrix storing simd vectors.
+ * \ingroup alignment_matrix
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ *
+ * \tparam matrix_iter_t The wrapped matrix iterator; must model seqan3::detail::two_dimensional_matrix_iterator and
+ *                       its value type must model seqan3::simd::simd_concept.
+ *
+ * \details
+ *
+ * In the vectorised alignment the trace directions of all alignments of one batch are stored interleaved, i.e.
+ * every cell of the trace matrix stores one simd vector whose lanes hold the trace directions of the respective
+ * alignments. This iterator moves over the wrapped matrix iterator but dereferences only to the trace direction
+ * stored in the lane it was constructed with. Accordingly, it can be used as the underlying matrix iterator of the
+ * seqan3::detail::trace_iterator to follow the trace path of a single alignment without copying the trace matrix.
+ */
+template <two_dimensional_matrix_iterator matrix_iter_t>
+//!\cond
+    requires simd_concept<std::iter_value_t<matrix_iter_t>>
+//!\endcond
+class simd_trace_lane_iterator :
+    public two_dimensional_matrix_iterator_base<simd_trace_lane_iterator<matrix_iter_t>, matrix_major_order::column>
+{
+private:
+    //!\brief The base class type.
+    using base_t = two_dimensional_matrix_iterator_base<simd_trace_lane_iterator, matrix_major_order::column>;
+
+    //!\brief Befriend the base crtp class.
+    template <typename derived_t, matrix_major_order other_order>
+    //!\cond
+        requires is_type_specialisation_of_v<derived_t, simd_trace_lane_iterator> &&
+                 (other_order == matrix_major_order::column)
+    //!\endcond
+    friend class two_dimensional_matrix_iterator_base;
+
+    //!\brief The wrapped matrix iterator.
+    matrix_iter_t host_iter{};
+    //!\brief The lane of the simd vector that is accessed.
+    size_t lane{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = trace_directions;
+    //!\brief The reference type.
+    using reference = trace_directions;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::iter_difference_t<matrix_iter_t>;
+    //!\brief The iterator category.
+    using iterator_category = std::random_access_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr simd_trace_lane_iterator() = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator(simd_trace_lane_iterator const &) = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator(simd_trace_lane_iterator &&) = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator & operator=(simd_trace_lane_iterator const &) = default; //!< Defaulted.
+    constexpr simd_trace_lane_iterator & operator=(simd_trace_lane_iterator &&) = default; //!< Defaulted.
+    ~simd_trace_lane_iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs from the underlying matrix iterator and the lane to access.
+     * \param[in] host_iter The underlying matrix iterator.
+     * \param[in] lane The lane of the simd vector to access.
+     */
+    constexpr simd_trace_lane_iterator(matrix_iter_t host_iter, size_t const lane) noexcept :
+        host_iter{std::move(host_iter)},
+        lane{lane}
+    {}
+    //!\}
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Advances the iterator by the given offset.
+    constexpr simd_trace_lane_iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        host_iter += offset;
+        return *this;
+    }
+
+    //!\brief Returns the trace direction stored in the selected lane of the pointed-to simd vector.
+    constexpr reference operator*() const noexcept
+    {
+        return static_cast<trace_directions>((*host_iter)[lane]);
+    }
+
+    //!\brief Returns the trace direction stored in the selected lane after advancing the iterator by the given offset.
+    constexpr reference operator[](difference_type const offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    //!\brief Returns the trace direction stored in the selected lane after advancing the iterator by the given offset.
+    constexpr reference operator[](matrix_offset const & offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    //!\brief Returns the current position of the iterator as a two-dimensional matrix coordinate.
+    matrix_coordinate coordinate() const noexcept
+    {
+        return host_iter.coordinate();
+    }
+};
+
+} // namespace seqan3::detail
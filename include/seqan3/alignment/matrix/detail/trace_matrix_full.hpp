@@ -12,11 +12,13 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
 #include <seqan3/std/span>
 #include <vector>
 
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/simd_trace_lane_iterator.hpp>
 #include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
@@ -25,6 +27,8 @@
 #include <seqan3/range/container/aligned_allocator.hpp>
 #include <seqan3/range/views/repeat_n.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
 
 namespace seqan3::detail
 {
@@ -33,12 +37,19 @@ namespace seqan3::detail
  * \ingroup alignment_matrix
  * \implements std::ranges::input_range
  *
- * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions.
+ * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions or must model
+ *                 seqan3::simd::simd_concept.
  *
  * \details
  *
  * In the default trace back implementation we allocate the entire matrix using one byte per cell to store the
  * seqan3::detail::trace_directions.
+ * In the vectorised alignment the trace type is a simd vector, such that every cell stores the trace directions of
+ * all alignments computed in one batch interleaved within one simd vector. The alignment algorithm uses an 8 bit simd
+ * vector with as many lanes as the score type, such that every alignment occupies one byte per cell independent of
+ * the score width.
+ * The trace path of a single alignment is then obtained by passing the respective lane to the
+ * seqan3::detail::trace_matrix_full::trace_path member function.
  *
  * ### Range interface
  *
@@ -49,7 +60,7 @@ namespace seqan3::detail
  */
 template <typename trace_t>
 //!\cond
-    requires std::same_as<trace_t, trace_directions>
+    requires (std::same_as<trace_t, trace_directions> || simd_concept<trace_t>)
 //!\endcond
 class trace_matrix_full
 {
@@ -117,7 +128,10 @@ public:
         this->column_count = column_count.get();
         this->row_count = row_count.get();
         complete_matrix.resize(number_rows{this->row_count}, number_cols{this->column_count});
-        horizontal_column.resize(this->row_count);
+        // The traces of a previous alignment left in the reused memory are not reset: the alignment algorithms write
+        // every cell that can be reached by the traceback, including the first row and column. The horizontal traces,
+        // however, are read before they are written in the rows that enter the band from below.
+        horizontal_column.assign(this->row_count, trace_t{});
         vertical_column = views::repeat_n(trace_t{}, this->row_count);
     }
 
@@ -139,6 +153,38 @@ public:
         return path_t{trace_iterator_t{complete_matrix.begin() + matrix_offset{trace_begin}}, std::default_sentinel};
     }
 
+    /*!\brief Returns the trace path of a single alignment of the vectorised alignment starting from the given
+     *        coordinate and ending in the cell with seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \param[in] lane The lane of the simd vector storing the traces of the respective alignment.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     *
+     * \details
+     *
+     * This function is only available if the trace type models seqan3::simd::simd_concept. The trace matrix is not
+     * copied. Instead, the trace path wraps the seqan3::detail::simd_trace_lane_iterator, which only accesses the
+     * given lane of the stored simd vectors.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin, size_t const lane) const
+    //!\cond
+        requires simd_concept<trace_t>
+    //!\endcond
+    {
+        using matrix_iter_t = std::ranges::iterator_t<matrix_t const>;
+        using lane_iterator_t = simd_trace_lane_iterator<matrix_iter_t>;
+        using trace_iterator_t = trace_iterator<lane_iterator_t>;
+        using path_t = std::ranges::subrange<trace_iterator_t, std::default_sentinel_t>;
+
+        if (trace_begin.row >= row_count || trace_begin.col >= column_count)
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        assert(lane < simd_traits<trace_t>::length);
+
+        lane_iterator_t lane_iterator{complete_matrix.begin() + matrix_offset{trace_begin}, lane};
+        return path_t{trace_iterator_t{lane_iterator}, std::default_sentinel};
+    }
+
     /*!\name Iterators
      * \{
      */
@@ -173,7 +219,7 @@ public:
  */
 template <typename trace_t>
 //!\cond
-    requires std::same_as<trace_t, trace_directions>
+    requires (std::same_as<trace_t, trace_directions> || simd_concept<trace_t>)
 //!\endcond
 class trace_matrix_full<trace_t>::iterator
 {
@@ -291,7 +337,7 @@ public:
  */
 template <typename trace_t>
 //!\cond
-    requires std::same_as<trace_t, trace_directions>
+    requires (std::same_as<trace_t, trace_directions> || simd_concept<trace_t>)
 //!\endcond
 class trace_matrix_full<trace_t>::iterator::column_proxy : public std::ranges::view_interface<column_proxy>
 {
@@ -0,0 +1,578 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_matrix_full_packed.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/range/views/repeat_n.hpp>
+#include <seqan3/range/views/zip.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Reduces the given trace to the canonical value of its cell state.
+ * \ingroup alignment_matrix
+ * \param[in] trace The trace to reduce.
+ * \returns The canonical value, which leads the seqan3::detail::trace_iterator along the same path.
+ *
+ * \details
+ *
+ * The open flags are kept as they are evaluated whenever the trace iterator moves through a gap. Of the remaining
+ * directions only the one followed by the trace iterator is kept.
+ */
+constexpr trace_directions canonical_trace_directions(trace_directions const trace) noexcept
+{
+    trace_directions const open_flags = trace & (trace_directions::up_open | trace_directions::left_open);
+
+    if (static_cast<bool>(trace & trace_directions::diagonal))
+        return trace_directions::diagonal | open_flags;
+    else if (static_cast<bool>(trace & trace_directions::up_open))
+        return open_flags;
+    else if (static_cast<bool>(trace & trace_directions::up))
+        return trace_directions::up | open_flags;
+    else if (static_cast<bool>(trace & trace_directions::left_open))
+        return trace_directions::left_open;
+    else if (static_cast<bool>(trace & trace_directions::left))
+        return trace_directions::left;
+    else
+        return trace_directions::none;
+}
+
+/*!\brief Trace matrix for the pairwise alignment storing the full trace matrix with four bits per cell.
+ * \ingroup alignment_matrix
+ * \implements std::ranges::input_range
+ *
+ * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions.
+ *
+ * \details
+ *
+ * This matrix offers the same interface as seqan3::detail::trace_matrix_full over seqan3::detail::trace_directions,
+ * but stores two cells per byte instead of one cell per byte. This halves the memory of the trace matrix, which
+ * dominates the memory footprint of the traceback for long sequences, and accordingly the number of cache lines that
+ * are touched when the matrix is written and when the trace path is followed. In return, every column is packed after
+ * it has been computed and every step of the trace path decodes the packed cell. The alignment algorithm therefore only
+ * uses this matrix if seqan3::align_cfg::packed_trace_matrix is configured.
+ *
+ * ### Encoding
+ *
+ * A cell of seqan3::detail::trace_directions uses five bits, but the seqan3::detail::trace_iterator only
+ * distinguishes eleven different cell states: the followed direction (diagonal before up before left) and whether
+ * the up and left gaps are opened in this cell. Before a cell is stored it is reduced to the canonical value of its
+ * state, which is encoded by the index of the state. Decoding the index yields the canonical value, such that the trace
+ * paths obtained from this matrix are identical to the ones obtained from seqan3::detail::trace_matrix_full.
+ *
+ * ### Range interface
+ *
+ * The matrix offers an input range interface over the columns of the matrix. Dereferencing the iterator will return
+ * a seqan3::views::zip view over the best trace, as well as the horizontal and vertical trace column. The best traces
+ * of the current column are computed in an unpacked column buffer, which is packed into the matrix when the next
+ * column is accessed. The buffered column is read directly from the buffer when the trace path is computed.
+ */
+template <typename trace_t>
+//!\cond
+    requires std::same_as<trace_t, trace_directions>
+//!\endcond
+class trace_matrix_full_packed
+{
+private:
+    //!\brief The type storing two packed cells.
+    using packed_type = uint8_t;
+    //!\brief The type of the column buffer and the score column which allocate memory for the entire column.
+    using physical_column_t = std::vector<trace_t>;
+    //!\brief The type of the virtual score column which only stores one value.
+    using virtual_column_t = decltype(views::repeat_n(trace_t{}, 1));
+
+    class iterator;
+    class matrix_iterator;
+
+    //!\brief The number of cell states that are distinguished by the trace iterator.
+    static constexpr size_t state_count = 11;
+
+    //!\brief The canonical trace value of every cell state; the position of the value is its code.
+    static constexpr std::array<trace_directions, state_count> decode_table
+    {
+        trace_directions::none,
+        trace_directions::diagonal,
+        trace_directions::diagonal | trace_directions::up_open,
+        trace_directions::diagonal | trace_directions::left_open,
+        trace_directions::diagonal | trace_directions::up_open | trace_directions::left_open,
+        trace_directions::up,
+        trace_directions::up | trace_directions::left_open,
+        trace_directions::up_open,
+        trace_directions::up_open | trace_directions::left_open,
+        trace_directions::left,
+        trace_directions::left_open
+    };
+
+    //!\brief The code of every trace value, indexed by the value.
+    static constexpr std::array<packed_type, 32> encode_table = [] () constexpr
+    {
+        std::array<packed_type, 32> table{};
+
+        for (size_t value = 0; value < table.size(); ++value)
+        {
+            trace_directions const canonical = canonical_trace_directions(static_cast<trace_directions>(value));
+            for (size_t code = 0; code < state_count; ++code)
+                if (decode_table[code] == canonical)
+                    table[value] = code;
+        }
+
+        return table;
+    }();
+
+    //!\brief The packed matrix storing two cells per byte in column major order.
+    std::vector<packed_type> packed_matrix{};
+    //!\brief The unpacked best traces of the current column.
+    physical_column_t column_buffer{};
+    //!\brief The column over the horizontal traces.
+    physical_column_t horizontal_column{};
+    //!\brief The virtual column over the vertical traces.
+    virtual_column_t vertical_column{};
+    //!\brief The index of the column that is currently stored in the column buffer.
+    size_t buffered_column_id{};
+    //!\brief The number of columns for this matrix.
+    size_t column_count{};
+    //!\brief The number of rows for this matrix.
+    size_t row_count{};
+
+    /*!\brief Makes the given column the buffered column.
+     * \param[in] column_id The index of the column to buffer.
+     *
+     * \details
+     *
+     * If another column is buffered, it is packed into the matrix and the buffer is reset to
+     * seqan3::detail::trace_directions::none.
+     */
+    void buffer_column(size_t const column_id)
+    {
+        if (column_id == buffered_column_id)
+            return;
+
+        size_t cell_index = buffered_column_id * row_count;
+        for (trace_directions const trace : column_buffer)
+        {
+            packed_type & packed_cells = packed_matrix[cell_index / 2];
+            size_t const shift = (cell_index % 2) * 4;
+            packed_cells = static_cast<packed_type>((packed_cells & ~(0b1111 << shift)) |
+                                                    (encode_table[static_cast<uint8_t>(trace)] << shift));
+            ++cell_index;
+        }
+
+        std::ranges::fill(column_buffer, trace_directions::none);
+        buffered_column_id = column_id;
+    }
+
+    /*!\brief Returns the trace stored in the given cell.
+     * \param[in] cell_index The index of the cell in column major order.
+     */
+    trace_directions cell(size_t const cell_index) const noexcept
+    {
+        size_t const column_id = cell_index / row_count;
+
+        if (column_id == buffered_column_id)
+            return canonical_trace_directions(column_buffer[cell_index - column_id * row_count]);
+
+        return decode_table[(packed_matrix[cell_index / 2] >> ((cell_index % 2) * 4)) & 0b1111];
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_matrix_full_packed() = default; //!< Defaulted.
+    trace_matrix_full_packed(trace_matrix_full_packed const &) = default; //!< Defaulted.
+    trace_matrix_full_packed(trace_matrix_full_packed &&) = default; //!< Defaulted.
+    trace_matrix_full_packed & operator=(trace_matrix_full_packed const &) = default; //!< Defaulted.
+    trace_matrix_full_packed & operator=(trace_matrix_full_packed &&) = default; //!< Defaulted.
+    ~trace_matrix_full_packed() = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief Resizes the matrix.
+     * \tparam column_index_t The column index type; must model std::integral.
+     * \tparam row_index_t The row index type; must model std::integral.
+     *
+     * \param[in] column_count The number of columns for this matrix.
+     * \param[in] row_count The number of rows for this matrix.
+     *
+     * \details
+     *
+     * Resizes the entire trace matrix storing the best trace path, the column buffer and the horizontal trace column.
+     * All cells are reset to seqan3::detail::trace_directions::none.
+     * Note the trace matrix requires the number of columns and rows to be one bigger than the size of sequence1,
+     * respectively sequence2 for the initialisation of the matrix.
+     * Reallocation happens only if the new size exceeds the current capacity of the underlying trace matrix.
+     *
+     * ### Complexity
+     *
+     * In worst case `column_count` times `row_count` half bytes are allocated.
+     *
+     * ### Exception
+     *
+     * Basic exception guarantee. Might throw std::bad_alloc on resizing the internal matrices.
+     */
+    template <std::integral column_index_t, std::integral row_index_t>
+    void resize(column_index_type<column_index_t> const column_count,
+                row_index_type<row_index_t> const row_count)
+    {
+        this->column_count = column_count.get();
+        this->row_count = row_count.get();
+        packed_matrix.clear();
+        packed_matrix.resize((this->column_count * this->row_count + 1) / 2, packed_type{});
+        column_buffer.clear();
+        column_buffer.resize(this->row_count, trace_directions::none);
+        buffered_column_id = 0;
+        horizontal_column.assign(this->row_count, trace_t{});
+        vertical_column = views::repeat_n(trace_t{}, this->row_count);
+    }
+
+    /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
+     *        seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const
+    {
+        using trace_iterator_t = trace_iterator<matrix_iterator>;
+        using path_t = std::ranges::subrange<trace_iterator_t, std::default_sentinel_t>;
+
+        if (trace_begin.row >= row_count || trace_begin.col >= column_count)
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        return path_t{trace_iterator_t{matrix_iterator{*this, trace_begin.col * row_count + trace_begin.row}},
+                      std::default_sentinel};
+    }
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns the iterator pointing to the first column.
+    iterator begin()
+    {
+        return iterator{*this, 0u};
+    }
+
+    //!\brief This score matrix is not const-iterable.
+    iterator begin() const = delete;
+
+    //!\brief Returns the iterator pointing behind the last column.
+    iterator end()
+    {
+        return iterator{*this, column_count};
+    }
+
+    //!\brief This score matrix is not const-iterable.
+    iterator end() const = delete;
+    //!\}
+};
+
+/*!\brief Trace matrix iterator for the pairwise alignment using the packed full trace matrix.
+ * \implements std::input_iterator
+ *
+ * \details
+ *
+ * Implements a counted iterator to keep track of the current column within the matrix. When dereferenced, the
+ * iterator makes the current column the buffered column of the matrix and returns a view over the column buffer.
+ * The returned view zips the three columns into a single range.
+ */
+template <typename trace_t>
+//!\cond
+    requires std::same_as<trace_t, trace_directions>
+//!\endcond
+class trace_matrix_full_packed<trace_t>::iterator
+{
+private:
+    //!\brief A lightweight representation of the column buffer.
+    using single_trace_column_type = std::span<trace_t>;
+    //!\brief The type of the zipped score column.
+    using matrix_column_type = decltype(views::zip(std::declval<single_trace_column_type>(),
+                                                   std::declval<physical_column_t &>(),
+                                                   std::declval<virtual_column_t &>()));
+    //!\brief The column type as value type.
+    using matrix_column_value_t = std::vector<std::ranges::range_value_t<matrix_column_type>>;
+
+    // Defines a proxy that can be converted to the value type.
+    class column_proxy;
+
+    //!\brief The pointer to the underlying matrix.
+    trace_matrix_full_packed * host_ptr{nullptr};
+    //!\brief The current column index.
+    size_t current_column_id{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = matrix_column_value_t;
+    //!\brief The reference type.
+    using reference = column_proxy;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator category.
+    using iterator_category = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Constructor, assignment and destructor
+     * \{
+     */
+    iterator() noexcept = default; //!< Defaulted.
+    iterator(iterator const &) noexcept = default; //!< Defaulted.
+    iterator(iterator &&) noexcept = default; //!< Defaulted.
+    iterator & operator=(iterator const &) noexcept = default; //!< Defaulted.
+    iterator & operator=(iterator &&) noexcept = default; //!< Defaulted.
+    ~iterator() = default; //!< Defaulted.
+
+    /*!\brief Initialises the iterator from the underlying matrix.
+     *
+     * \param[in] host_matrix The underlying matrix.
+     * \param[in] initial_column_id The initial column index.
+     */
+    explicit iterator(trace_matrix_full_packed & host_matrix, size_t const initial_column_id) noexcept :
+        host_ptr{std::addressof(host_matrix)},
+        current_column_id{initial_column_id}
+    {}
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the range over the current column.
+    reference operator*() const
+    {
+        host_ptr->buffer_column(current_column_id);
+
+        return column_proxy{views::zip(single_trace_column_type{host_ptr->column_buffer},
+                                       host_ptr->horizontal_column,
+                                       host_ptr->vertical_column)};
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Move `this` to the next column.
+    iterator & operator++()
+    {
+        ++current_column_id;
+        return *this;
+    }
+
+    //!\brief Move `this` to the next column.
+    void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Tests whether `lhs == rhs`.
+    friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.current_column_id == rhs.current_column_id;
+    }
+
+    //!\brief Tests whether `lhs != rhs`.
+    friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+};
+
+/*!\brief The proxy returned as reference type.
+ * \implements std::ranges::view
+ *
+ * \details
+ *
+ * The proxy stores the column view of the current iterator and offers a dedicated conversion operator to
+ * assign it to the value type of the iterator.
+ */
+template <typename trace_t>
+//!\cond
+    requires std::same_as<trace_t, trace_directions>
+//!\endcond
+class trace_matrix_full_packed<trace_t>::iterator::column_proxy : public std::ranges::view_interface<column_proxy>
+{
+private:
+    //!\brief The represented column.
+    matrix_column_type column{};
+
+public:
+    /*!\name Constructor, assignment and destructor
+     * \{
+     */
+    column_proxy() = default; //!< Defaulted.
+    column_proxy(column_proxy const &) = default; //!< Defaulted.
+    column_proxy(column_proxy &&) = default; //!< Defaulted.
+    column_proxy & operator=(column_proxy const &) = default; //!< Defaulted.
+    column_proxy & operator=(column_proxy &&) = default; //!< Defaulted.
+    ~column_proxy() = default; //!< Defaulted.
+
+    /*!\brief Initialises the proxy with the respective column.
+    *
+    * \param[in] column The column to set.
+    */
+    explicit column_proxy(matrix_column_type && column) noexcept : column{std::move(column)}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the begin of the column.
+    std::ranges::iterator_t<matrix_column_type> begin()
+    {
+        return column.begin();
+    }
+    //!\brief Const iterator is not accessible.
+    std::ranges::iterator_t<matrix_column_type> begin() const = delete;
+
+    //!\brief Returns a sentinel marking the end of the column.
+    std::ranges::sentinel_t<matrix_column_type> end()
+    {
+        return column.end();
+    }
+
+    //!\brief Const sentinel is not accessible.
+    std::ranges::sentinel_t<matrix_column_type> end() const = delete;
+    //!\}
+
+    //!\brief Implicitly converts the column proxy into the value type of the iterator.
+    constexpr operator matrix_column_value_t() const
+    {
+        matrix_column_value_t target{};
+        std::ranges::copy(column, std::cpp20::back_inserter(target));
+        return target;
+    }
+};
+
+/*!\brief A two-dimensional matrix iterator over the cells of the packed trace matrix.
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ *
+ * \details
+ *
+ * Dereferencing the iterator decodes the trace of the pointed-to cell. It is used as the underlying matrix iterator of
+ * the seqan3::detail::trace_iterator to follow the trace path without unpacking the trace matrix.
+ */
+template <typename trace_t>
+//!\cond
+    requires std::same_as<trace_t, trace_directions>
+//!\endcond
+class trace_matrix_full_packed<trace_t>::matrix_iterator :
+    public two_dimensional_matrix_iterator_base<matrix_iterator, matrix_major_order::column>
+{
+private:
+    //!\brief The base class type.
+    using base_t = two_dimensional_matrix_iterator_base<matrix_iterator, matrix_major_order::column>;
+
+    //!\brief Befriend the base crtp class.
+    friend base_t;
+
+    //!\brief The pointer to the underlying matrix.
+    trace_matrix_full_packed const * host_ptr{nullptr};
+    //!\brief The index of the pointed-to cell in column major order.
+    std::ptrdiff_t host_iter{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = trace_directions;
+    //!\brief The reference type.
+    using reference = trace_directions;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator category.
+    using iterator_category = std::random_access_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr matrix_iterator() = default; //!< Defaulted.
+    constexpr matrix_iterator(matrix_iterator const &) = default; //!< Defaulted.
+    constexpr matrix_iterator(matrix_iterator &&) = default; //!< Defaulted.
+    constexpr matrix_iterator & operator=(matrix_iterator const &) = default; //!< Defaulted.
+    constexpr matrix_iterator & operator=(matrix_iterator &&) = default; //!< Defaulted.
+    ~matrix_iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs from the underlying matrix and the index of the pointed-to cell.
+     * \param[in] host_matrix The underlying matrix.
+     * \param[in] cell_index The index of the pointed-to cell in column major order.
+     */
+    constexpr matrix_iterator(trace_matrix_full_packed const & host_matrix, size_t const cell_index) noexcept :
+        host_ptr{std::addressof(host_matrix)},
+        host_iter{static_cast<std::ptrdiff_t>(cell_index)}
+    {}
+    //!\}
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Advances the iterator by the given offset.
+    constexpr matrix_iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        assert(host_ptr != nullptr);
+
+        host_iter += offset.col * static_cast<std::ptrdiff_t>(host_ptr->row_count) + offset.row;
+        return *this;
+    }
+
+    //!\brief Returns the trace direction stored in the pointed-to cell.
+    reference operator*() const noexcept
+    {
+        assert(host_ptr != nullptr);
+
+        return host_ptr->cell(host_iter);
+    }
+
+    //!\brief Returns the trace direction stored in the cell after advancing the iterator by the given offset.
+    reference operator[](difference_type const offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    //!\brief Returns the trace direction stored in the cell after advancing the iterator by the given offset.
+    reference operator[](matrix_offset const & offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    //!\brief Returns the current position of the iterator as a two-dimensional matrix coordinate.
+    matrix_coordinate coordinate() const noexcept
+    {
+        assert(host_ptr != nullptr);
+
+        size_t const cell_index = host_iter;
+        return {row_index_type{cell_index % host_ptr->row_count}, column_index_type{cell_index / host_ptr->row_count}};
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,252 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_path_linear_memory.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Stores the trace path of an alignment that was computed without a trace matrix.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * The linear memory alignment (see seqan3::align_cfg::linear_memory_traceback) emits the trace directions of the
+ * optimal alignment in order from the origin of the alignment matrix to its last cell. Instead of a full trace matrix
+ * only this path is stored, which requires memory linear in the length of the alignment.
+ *
+ * The member function seqan3::detail::trace_path_linear_memory::trace_path offers the same interface as
+ * seqan3::detail::trace_matrix_full::trace_path, such that this type can be passed to the
+ * seqan3::detail::policy_alignment_result_builder in place of the alignment matrix. The returned path is traversed
+ * from the last cell back to the origin of the alignment matrix.
+ */
+class trace_path_linear_memory
+{
+private:
+    class iterator;
+
+    //!\brief The stored trace directions in order from the origin to the end of the alignment.
+    std::vector<trace_directions> directions{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_path_linear_memory() = default; //!< Defaulted.
+    trace_path_linear_memory(trace_path_linear_memory const &) = default; //!< Defaulted.
+    trace_path_linear_memory(trace_path_linear_memory &&) = default; //!< Defaulted.
+    trace_path_linear_memory & operator=(trace_path_linear_memory const &) = default; //!< Defaulted.
+    trace_path_linear_memory & operator=(trace_path_linear_memory &&) = default; //!< Defaulted.
+    ~trace_path_linear_memory() = default; //!< Defaulted.
+    //!\}
+
+    //!\brief Removes all stored trace directions but keeps the allocated memory.
+    void clear() noexcept
+    {
+        directions.clear();
+    }
+
+    /*!\brief Appends the given trace direction `count` times to the end of the path.
+     * \param[in] direction The trace direction to append; must be seqan3::detail::trace_directions::diagonal,
+     *                      seqan3::detail::trace_directions::up or seqan3::detail::trace_directions::left.
+     * \param[in] count The number of times the direction is appended.
+     */
+    void append(trace_directions const direction, size_t const count = 1)
+    {
+        assert(direction == trace_directions::diagonal ||
+               direction == trace_directions::up ||
+               direction == trace_directions::left);
+
+        directions.insert(directions.end(), count, direction);
+    }
+
+    /*!\brief Returns the trace path starting from the given coordinate and ending in the origin of the matrix.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the last cell of the stored path.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is not reached by the stored path.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const;
+};
+
+/*!\brief The iterator over the trace path stored in seqan3::detail::trace_path_linear_memory.
+ * \implements std::forward_iterator
+ *
+ * \details
+ *
+ * Visits the stored trace directions in reverse order and keeps track of the coordinate of the current cell.
+ * The iterator compares equal to std::default_sentinel once the origin of the alignment matrix is reached.
+ */
+class trace_path_linear_memory::iterator
+{
+private:
+    //!\brief Pointer to the first stored trace direction.
+    trace_directions const * data_ptr{nullptr};
+    //!\brief The number of trace directions that have not yet been visited.
+    size_t remaining{};
+    //!\brief The coordinate of the current cell.
+    matrix_coordinate current_coordinate{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions const &; //!< The reference type.
+    using pointer = value_type const *; //!< The pointer type.
+    using difference_type = std::ptrdiff_t; //!< The difference type.
+    using iterator_category = std::forward_iterator_tag; //!< Forward iterator tag.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr iterator() = default; //!< Defaulted.
+    constexpr iterator(iterator const &) = default; //!< Defaulted.
+    constexpr iterator(iterator &&) = default; //!< Defaulted.
+    constexpr iterator & operator=(iterator const &) = default; //!< Defaulted.
+    constexpr iterator & operator=(iterator &&) = default; //!< Defaulted.
+    ~iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs the iterator pointing to the last trace direction of the path.
+     * \param[in] data_ptr Pointer to the first stored trace direction.
+     * \param[in] size The number of stored trace directions.
+     * \param[in] end_coordinate The coordinate of the last cell of the path.
+     */
+    constexpr iterator(trace_directions const * data_ptr,
+                       size_t const size,
+                       matrix_coordinate const end_coordinate) noexcept :
+        data_ptr{data_ptr},
+        remaining{size},
+        current_coordinate{end_coordinate}
+    {}
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the current trace direction.
+    constexpr reference operator*() const noexcept
+    {
+        assert(remaining > 0);
+        return data_ptr[remaining - 1];
+    }
+
+    //!\brief Returns a pointer to the current trace direction.
+    constexpr pointer operator->() const noexcept
+    {
+        return &(**this);
+    }
+
+    //!\brief Returns the coordinate of the current cell.
+    [[nodiscard]] constexpr matrix_coordinate coordinate() const noexcept
+    {
+        return current_coordinate;
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Advances the iterator to the previous cell of the path.
+    constexpr iterator & operator++() noexcept
+    {
+        trace_directions const direction = **this;
+        --remaining;
+
+        if (direction != trace_directions::up) // diagonal or left
+            --current_coordinate.col;
+        if (direction != trace_directions::left) // diagonal or up
+            --current_coordinate.row;
+
+        return *this;
+    }
+
+    //!\brief Advances the iterator to the previous cell of the path.
+    constexpr iterator operator++(int) noexcept
+    {
+        iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Returns `true` if both iterators point to the same cell of the path.
+    constexpr friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.remaining == rhs.remaining;
+    }
+
+    //!\brief Returns `true` if both iterators point to different cells of the path.
+    constexpr friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Returns `true` if the origin of the matrix is reached.
+    constexpr friend bool operator==(iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.remaining == 0;
+    }
+
+    //!\brief Returns `true` if the origin of the matrix is reached.
+    constexpr friend bool operator==(std::default_sentinel_t const &, iterator const & rhs) noexcept
+    {
+        return rhs == std::default_sentinel;
+    }
+
+    //!\brief Returns `true` if the origin of the matrix is not yet reached.
+    constexpr friend bool operator!=(iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return !(lhs == std::default_sentinel);
+    }
+
+    //!\brief Returns `true` if the origin of the matrix is not yet reached.
+    constexpr friend bool operator!=(std::default_sentinel_t const &, iterator const & rhs) noexcept
+    {
+        return !(rhs == std::default_sentinel);
+    }
+    //!\}
+};
+
+//!\cond
+inline auto trace_path_linear_memory::trace_path(matrix_coordinate const & trace_begin) const
+{
+    size_t columns = 0;
+    size_t rows = 0;
+    for (trace_directions const direction : directions)
+    {
+        columns += (direction != trace_directions::up);
+        rows += (direction != trace_directions::left);
+    }
+
+    if (trace_begin.row != rows || trace_begin.col != columns)
+        throw std::invalid_argument{"The given coordinate is not the end of the stored trace path."};
+
+    return std::ranges::subrange<iterator, std::default_sentinel_t>{iterator{directions.data(),
+                                                                             directions.size(),
+                                                                             trace_begin},
+                                                                    std::default_sentinel};
+}
+//!\endcond
+
+} // namespace seqan3::detail
@@ -27,6 +27,7 @@
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
 #include <seqan3/range/views/persist.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
 #include <seqan3/utility/simd/simd.hpp>
@@ -73,7 +74,9 @@ namespace seqan3
  * The seqan3::align_pairwise function returns an seqan3::algorithm_result_generator_range which can be used to iterate
  * over the alignments. If the `vectorised` configurations are omitted the alignments are computed on-demand when
  * iterating over the results. In case of a parallel execution all alignments are computed at once in parallel when
- * calling `begin` on the associated seqan3::algorithm_result_generator_range.
+ * calling `begin` on the associated seqan3::algorithm_result_generator_range. If seqan3::align_cfg::unordered_results
+ * is configured in addition, the results are returned in the order in which they are computed instead, and at most a
+ * fixed number of results is buffered.
  *
  * The following snippets demonstrate the single element and the range based interface.
  *
@@ -180,13 +183,18 @@ constexpr auto align_pairwise(sequence_t && sequences,
     using traits_t = detail::alignment_configuration_traits<complete_config_t>;
 
     auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0))
-                                     | views::chunk(traits_t::alignments_per_vector);
+                                     | views::chunk(traits_t::alignments_per_chunk);
 
     using indexed_sequences_t = decltype(indexed_sequence_chunk_view);
     using alignment_result_t = typename traits_t::alignment_result_type;
-    using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
-                                                   detail::execution_handler_parallel,
-                                                   detail::execution_handler_sequential>;
+    constexpr bool work_stealing = complete_config_t::template exists<align_cfg::parallel_work_stealing>();
+    using parallel_t = std::conditional_t<work_stealing, align_cfg::parallel_work_stealing, align_cfg::parallel>;
+    using execution_handler_t = std::conditional_t<
+                                    work_stealing,
+                                    detail::execution_handler_work_stealing,
+                                    std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
+                                                       detail::execution_handler_parallel,
+                                                       detail::execution_handler_sequential>>;
     using executor_t = detail::algorithm_executor_blocking<indexed_sequences_t,
                                                            decltype(algorithm),
                                                            alignment_result_t,
@@ -195,24 +203,42 @@ constexpr auto align_pairwise(sequence_t && sequences,
     // Select the execution handler for the alignment configuration.
     auto select_execution_handler = [&] ()
     {
-        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_sequential>)
         {
-            auto thread_count = get<align_cfg::parallel>(complete_config).thread_count;
+            return execution_handler_t{};
+        }
+        else
+        {
+            auto const & parallel_config = get<parallel_t>(complete_config);
+            if constexpr (work_stealing)
+            {
+                if (parallel_config.pool != nullptr)
+                    return execution_handler_t{*parallel_config.pool};
+            }
+
+            auto thread_count = parallel_config.thread_count;
             if (!thread_count)
                 throw std::runtime_error{"You must configure the number of threads in seqan3::align_cfg::parallel."};
 
             return execution_handler_t{*thread_count};
         }
-        else
-        {
-            return execution_handler_t{};
-        }
     };
 
     if constexpr (traits_t::is_one_way_execution) // Just compute alignment and wait until all alignments are computed.
         select_execution_handler().bulk_execute(algorithm,
                                                 indexed_sequence_chunk_view,
                                                 get<align_cfg::on_result>(complete_config).callback);
+    else if constexpr (traits_t::is_unordered) // Return the range over the alignments in completion order.
+        return algorithm_result_generator_range{
+            detail::algorithm_executor_streaming<indexed_sequences_t,
+                                                 decltype(algorithm),
+                                                 alignment_result_t,
+                                                 execution_handler_t>{
+                std::move(indexed_sequence_chunk_view),
+                std::move(algorithm),
+                alignment_result_t{},
+                select_execution_handler(),
+                get<align_cfg::unordered_results>(complete_config).buffer_size}};
     else  // Require two way execution: return the range over the alignments.
         return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
                                                 std::move(algorithm),
@@ -25,12 +25,20 @@
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_full_banded.hpp>
 #include <seqan3/alignment/matrix/detail/combined_score_and_trace_matrix.hpp>
 #include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
+#include <seqan3/alignment/matrix/detail/score_matrix_single_column_dual_affine.hpp>
 #include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_full_packed.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_adaptive.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_lane_packing.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_striped.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_wavefront.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_dual_affine_gap_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion_banded.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_with_trace_recursion.hpp>
@@ -229,9 +237,11 @@ private:
                                        policy_affine_gap_recursion_banded<config_t>>;
     public:
         //!\brief The configured recursion policy.
-        using type = std::conditional_t<traits_type::is_banded,
-                                        banded_gap_recursion_policy_type,
-                                        gap_recursion_policy_type>;
+        using type = std::conditional_t<traits_type::is_dual_affine,
+                                        policy_dual_affine_gap_recursion<config_t>,
+                                        std::conditional_t<traits_type::is_banded,
+                                                           banded_gap_recursion_policy_type,
+                                                           gap_recursion_policy_type>>;
     };
 
 public:
@@ -325,7 +335,19 @@ public:
         auto const & gap_cost = config_with_result_type.get_or(edit_gap_cost);
         auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
 
-        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
+        // The banded edit distance computes only the score and the end positions within a fixed band.
+        using edit_traits_t = alignment_configuration_traits<decltype(config_with_result_type)>;
+        constexpr bool is_supported_edit_band = !edit_traits_t::is_banded ||
+                                                !(edit_traits_t::is_banded_per_sequence_pair ||
+                                                  edit_traits_t::compute_begin_positions ||
+                                                  edit_traits_t::compute_sequence_alignment ||
+                                                  edit_traits_t::is_debug);
+
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>() &&
+                      !config_t::template exists<seqan3::align_cfg::linear_memory_traceback>() &&
+                      !config_t::template exists<seqan3::align_cfg::gap_cost_dual_affine>() &&
+                      !config_t::template exists<seqan3::align_cfg::wavefront>() &&
+                      is_supported_edit_band)
         {
             // Only use edit distance if ...
             auto method_global_cfg = get<seqan3::align_cfg::method_global>(config_with_result_type);
@@ -359,9 +381,75 @@ public:
         if (config_t::template exists<align_cfg::min_score>())
             throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
                                                   "specific edit distance computation."};
+        // Do not allow all hits configuration for alignments not computing the edit distance.
+        if (config_t::template exists<align_cfg::all_hits>())
+            throw invalid_alignment_configuration{"The align_cfg::all_hits configuration is only allowed for the "
+                                                  "specific edit distance computation."};
+        // Do not allow a precomputed query profile for alignments not using the striped vectorisation.
+        if (config_t::template exists<align_cfg::query_profile>() &&
+            !config_t::template exists<align_cfg::vectorised_striped>())
+            throw invalid_alignment_configuration{"The align_cfg::query_profile configuration is only allowed in "
+                                                  "combination with align_cfg::vectorised_striped."};
         // Configure the alignment algorithm.
-        return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
-                         config_with_result_type};
+        using config_with_result_type_t = decltype(config_with_result_type);
+        using traits_t = alignment_configuration_traits<config_with_result_type_t>;
+
+        if constexpr (config_t::template exists<align_cfg::wavefront>())
+        {
+            return std::pair{configure_wavefront<function_wrapper_t>(config_with_result_type), config_with_result_type};
+        }
+        else if constexpr (traits_t::is_dual_affine &&
+                           (config_t::template exists<align_cfg::vectorised_striped>() ||
+                            traits_t::is_linear_memory_traceback))
+        {
+            throw invalid_alignment_configuration{"The align_cfg::gap_cost_dual_affine configuration cannot be "
+                                                  "combined with align_cfg::vectorised_striped or "
+                                                  "align_cfg::linear_memory_traceback."};
+        }
+        else if constexpr (config_t::template exists<align_cfg::vectorised_striped>())
+        {
+            return std::pair{configure_striped<function_wrapper_t>(config_with_result_type), config_with_result_type};
+        }
+        else if constexpr (traits_t::is_linear_memory_traceback && traits_t::requires_trace_information)
+        {
+            return std::pair{configure_linear_memory_traceback<function_wrapper_t>(config_with_result_type),
+                             config_with_result_type};
+        }
+        else if constexpr (traits_t::is_vectorised && traits_t::is_score_type_adaptive)
+        {
+            // Configure one algorithm per score type which is selected for every sequence pair separately.
+            // Only the new implementation detects the scores that exceed a narrow score type.
+            using adaptive_algorithm_t = pairwise_alignment_algorithm_adaptive<config_with_result_type_t,
+                                                                               indexed_sequence_pair_chunk_t,
+                                                                               callback_on_result_t,
+                                                                               !uses_old_algorithm<traits_t>>;
+            using score_type_function_wrapper_t = typename adaptive_algorithm_t::algorithm_type;
+
+            adaptive_algorithm_t algorithm{config_with_result_type, [] (auto const & score_type_config)
+            {
+                return configure_scoring_scheme<score_type_function_wrapper_t>(score_type_config);
+            }};
+
+            return std::pair{function_wrapper_t{std::move(algorithm)}, config_with_result_type};
+        }
+        else if constexpr (traits_t::is_vectorised)
+        {
+            // Compute the sequence pairs of similar length in the same simd vector.
+            using lane_packing_algorithm_t = pairwise_alignment_algorithm_lane_packing<config_with_result_type_t,
+                                                                                       indexed_sequence_pair_chunk_t,
+                                                                                       callback_on_result_t>;
+            using vectorised_function_wrapper_t = typename lane_packing_algorithm_t::algorithm_type;
+
+            lane_packing_algorithm_t algorithm{
+                configure_scoring_scheme<vectorised_function_wrapper_t>(config_with_result_type)};
+
+            return std::pair{function_wrapper_t{std::move(algorithm)}, config_with_result_type};
+        }
+        else
+        {
+            return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
+                             config_with_result_type};
+        }
     }
 
 private:
@@ -380,7 +468,7 @@ private:
         using traits_t = alignment_configuration_traits<config_t>;
 
         if constexpr (traits_t::has_output_configuration)
-            return config;
+            return maybe_add_sequence_ids(config);
         else
             return config | align_cfg::output_score{} |
                             align_cfg::output_begin_position{} |
@@ -390,6 +478,29 @@ private:
                             align_cfg::output_sequence2_id{};
     }
 
+    /*!\brief Adds the output of the sequence ids if the results are unordered.
+     *
+     * \tparam config_t The type of the alignment configuration.
+     *
+     * \param[in] config The configuration to check.
+     *
+     * \returns The configuration extended by the missing sequence id outputs if seqan3::align_cfg::unordered_results
+     *          is configured, otherwise the original configuration.
+     */
+    template <typename config_t>
+    static constexpr auto maybe_add_sequence_ids(config_t const & config) noexcept
+    {
+        // Unordered results can only be mapped back to their sequence pair by the sequence ids.
+        if constexpr (!config_t::template exists<align_cfg::unordered_results>())
+            return config;
+        else if constexpr (!config_t::template exists<align_cfg::output_sequence1_id>())
+            return maybe_add_sequence_ids(config | align_cfg::output_sequence1_id{});
+        else if constexpr (!config_t::template exists<align_cfg::output_sequence2_id>())
+            return maybe_add_sequence_ids(config | align_cfg::output_sequence2_id{});
+        else
+            return config;
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
@@ -404,8 +515,13 @@ private:
         // Unsupported configurations
         // ----------------------------------------------------------------------------
 
-        if constexpr (traits_t::is_banded)
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
+        if constexpr (traits_t::is_x_drop)
+            throw invalid_alignment_configuration{"The align_cfg::x_drop configuration is not supported for the edit "
+                                                  "distance."};
+
+        if constexpr (traits_t::is_packed_trace_matrix)
+            throw invalid_alignment_configuration{"The align_cfg::packed_trace_matrix configuration is not supported "
+                                                  "for the edit distance."};
 
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
@@ -414,15 +530,31 @@ private:
         // Get the value for the sequence ends configuration.
         auto method_global_cfg = cfg.get_or(align_cfg::method_global{});
 
-        auto configure_edit_traits = [&] (auto is_semi_global)
+        auto configure_edit_traits = [&] (auto is_semi_global) -> function_wrapper_t
         {
             struct edit_traits_type
             {
                 using is_semi_global_type [[maybe_unused]] = std::remove_cvref_t<decltype(is_semi_global)>;
             };
 
-            edit_distance_algorithm<std::remove_cvref_t<config_t>, edit_traits_type> algorithm{cfg};
-            return function_wrapper_t{std::move(algorithm)};
+            constexpr bool report_all_hits = config_t::template exists<align_cfg::all_hits>();
+
+            // All hits are only defined within the min_score and if the first sequence has free end gaps.
+            if constexpr (report_all_hits && !config_t::template exists<align_cfg::min_score>())
+            {
+                throw invalid_alignment_configuration{"The align_cfg::all_hits configuration requires the "
+                                                      "align_cfg::min_score configuration."};
+            }
+            else if constexpr (report_all_hits && !decltype(is_semi_global)::value)
+            {
+                throw invalid_alignment_configuration{"The align_cfg::all_hits configuration requires free end "
+                                                      "gaps at the leading and trailing end of the first sequence."};
+            }
+            else
+            {
+                edit_distance_algorithm<std::remove_cvref_t<config_t>, edit_traits_type> algorithm{cfg};
+                return function_wrapper_t{std::move(algorithm)};
+            }
         };
 
         // Check if it has free ends set for the first sequence trailing gaps.
@@ -467,6 +599,27 @@ private:
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
 
+    /*!\brief Whether the alignment is computed with the old alignment implementation.
+     * \tparam traits_t The type of the seqan3::detail::alignment_configuration_traits of the alignment configuration.
+     *
+     * \details
+     *
+     * Temporarily we will use the new and the old alignment implementation in order to
+     * refactor step-by-step to the new implementation. The new implementation will be tested in
+     * macrobenchmarks to show that it maintains a high performance.
+     */
+    template <typename traits_t>
+    static constexpr bool uses_old_algorithm =
+                      // Use old alignment implementation if...
+                      (traits_t::is_local && !traits_t::is_vectorised) ||             // it is a scalar local alignment,
+                      (traits_t::is_local && traits_t::is_banded) ||                  // it is a banded local alignment,
+                      traits_t::is_debug ||                                           // it runs in debug mode,
+                     (traits_t::compute_sequence_alignment &&                         // it computes more than the begin position
+                      !(traits_t::is_vectorised && !traits_t::is_banded)) ||          // and is not an unbanded simd alignment.
+                     (traits_t::is_banded && traits_t::compute_begin_positions) ||    // banded && more than end positions.
+                     (traits_t::is_vectorised && traits_t::is_banded &&               // banded simd and more than the
+                      traits_t::compute_end_positions);                               // score.
+
     /*!\brief Constructs the actual alignment algorithm wrapped in the passed std::function object.
      *
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
@@ -486,37 +639,73 @@ private:
     {
         using traits_t = alignment_configuration_traits<config_t>;
 
-        // Temporarily we will use the new and the old alignment implementation in order to
-        // refactor step-by-step to the new implementation. The new implementation will be tested in
-        // macrobenchmarks to show that it maintains a high performance.
+        constexpr bool use_old_algorithm = uses_old_algorithm<traits_t>;
 
-        // Use old alignment implementation if...
-        if constexpr (traits_t::is_local ||                                          // it is a local alignment,
-                      traits_t::is_debug ||                                          // it runs in debug mode,
-                      traits_t::compute_sequence_alignment ||                        // it computes more than the begin position.
-                     (traits_t::is_banded && traits_t::compute_begin_positions) ||   // banded && more than end positions.
-                     (traits_t::is_vectorised && traits_t::compute_end_positions))   // simd and more than the score.
+        if constexpr (traits_t::is_x_drop && (use_old_algorithm || traits_t::requires_trace_information ||
+                                              traits_t::compute_begin_positions))
         {
-            using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
-            using gap_policy_t = typename select_gap_policy<traits_t>::type;
-            using find_optimum_t = typename select_find_optimum_policy<traits_t>::type;
-            using gap_init_policy_t = deferred_crtp_base<affine_gap_init_policy>;
-
-            return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, find_optimum_t, gap_init_policy_t, policies_t...>{cfg};
+            // The extension ends anywhere in the matrix, which is only supported by the new implementation.
+            throw invalid_alignment_configuration{"The align_cfg::x_drop configuration only supports the computation "
+                                                  "of the score and, if not banded and vectorised, the end "
+                                                  "positions."};
+        }
+        else if constexpr (traits_t::is_dual_affine && (use_old_algorithm || traits_t::requires_trace_information ||
+                                                        traits_t::is_banded))
+        {
+            // The dual affine gap costs are only implemented for the unbanded score matrix without trace.
+            throw invalid_alignment_configuration{"The align_cfg::gap_cost_dual_affine configuration only supports "
+                                                  "the unbanded alignment computed without a trace matrix, i.e. the "
+                                                  "alignment cannot be requested."};
+        }
+        else if constexpr (traits_t::is_packed_trace_matrix &&
+                           (use_old_algorithm || !traits_t::requires_trace_information))
+        {
+            // Only the trace matrix of the new implementation can be packed.
+            throw invalid_alignment_configuration{"The align_cfg::packed_trace_matrix configuration is only "
+                                                  "supported for the unbanded global alignment computing the begin "
+                                                  "positions but not the alignment."};
+        }
+        else if constexpr (use_old_algorithm && traits_t::is_banded_per_sequence_pair)
+        {
+            // The old implementation only supports a single band for all sequence pairs.
+            throw invalid_alignment_configuration{"The align_cfg::band_per_sequence_pair configuration is only "
+                                                  "supported for the global alignment computing the score and, if "
+                                                  "not vectorised, the end positions."};
+        }
+        else if constexpr (use_old_algorithm)
+        {
+            return make_old_algorithm<function_wrapper_t, policies_t...>(cfg);
         }
         else  // Use new alignment algorithm implementation.
         {
+            // Without the trace matrix the vectorised global alignment reports the origin of the matrix as begin
+            // position.
+            if constexpr (traits_t::is_vectorised && traits_t::is_global && traits_t::compute_begin_positions &&
+                          !traits_t::requires_trace_information)
+            {
+                auto const & method_global_cfg = get<seqan3::align_cfg::method_global>(cfg);
+                if (method_global_cfg.free_end_gaps_sequence1_leading ||
+                    method_global_cfg.free_end_gaps_sequence2_leading)
+                    throw invalid_alignment_configuration{"The begin positions of a vectorised global alignment with "
+                                                          "free leading end gaps are not yet supported."};
+            }
+
             //----------------------------------------------------------------------------------------------------------
             // Configure the optimum tracker policy.
             //----------------------------------------------------------------------------------------------------------
 
-            using scalar_optimum_updater_t = std::conditional_t<traits_t::is_banded,
+            using scalar_optimum_updater_t = std::conditional_t<traits_t::is_banded && !traits_t::is_x_drop,
                                                                 max_score_banded_updater,
                                                                 max_score_updater>;
 
+            using simd_optimum_updater_t = std::conditional_t<traits_t::is_local || traits_t::is_x_drop,
+                                                              max_score_updater_simd_local<
+                                                                  typename traits_t::matrix_index_type>,
+                                                              max_score_updater_simd_global>;
+
             using optimum_tracker_policy_t =
                 lazy_conditional_t<traits_t::is_vectorised,
-                                   lazy<policy_optimum_tracker_simd, config_t, max_score_updater_simd_global>,
+                                   lazy<policy_optimum_tracker_simd, config_t, simd_optimum_updater_t>,
                                    lazy<policy_optimum_tracker, config_t, scalar_optimum_updater_t>>;
 
             //----------------------------------------------------------------------------------------------------------
@@ -535,7 +724,8 @@ private:
             // Configure the scoring scheme policy.
             //----------------------------------------------------------------------------------------------------------
 
-            using alignment_method_t = std::conditional_t<traits_t::is_global,
+            // With x-drop the alignment may end in any cell, so padded cells must never score better than real ones.
+            using alignment_method_t = std::conditional_t<traits_t::is_global && !traits_t::is_x_drop,
                                                           seqan3::align_cfg::method_global,
                                                           seqan3::align_cfg::method_local>;
 
@@ -568,8 +758,13 @@ private:
             // Configure the alignment matrix policy.
             //----------------------------------------------------------------------------------------------------------
 
-            using score_matrix_t = score_matrix_single_column<score_t>;
-            using trace_matrix_t = trace_matrix_full<trace_directions>;
+            using score_matrix_t = std::conditional_t<traits_t::is_dual_affine,
+                                                      score_matrix_single_column_dual_affine<score_t>,
+                                                      score_matrix_single_column<score_t>>;
+            using trace_t = typename traits_t::compact_trace_type;
+            using trace_matrix_t = lazy_conditional_t<traits_t::is_packed_trace_matrix,
+                                                      lazy<trace_matrix_full_packed, trace_t>,
+                                                      lazy<trace_matrix_full, trace_t>>;
 
             using alignment_matrix_t = std::conditional_t<traits_t::requires_trace_information,
                                                           combined_score_and_trace_matrix<score_matrix_t,
@@ -591,6 +786,132 @@ private:
             return algorithm_t{cfg};
         }
     }
+
+    /*!\brief Configures the striped vectorised alignment algorithm.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the begin positions or the alignment are requested or if
+     *         free end-gaps are configured for the global alignment.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_striped(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::requires_trace_information)
+        {
+            throw invalid_alignment_configuration{"The align_cfg::vectorised_striped configuration only supports the "
+                                                  "computation of the score and the end positions."};
+        }
+        else
+        {
+            if constexpr (traits_t::is_global)
+            {
+                auto const & method_global_cfg = get<seqan3::align_cfg::method_global>(cfg);
+                if (method_global_cfg.free_end_gaps_sequence1_leading ||
+                    method_global_cfg.free_end_gaps_sequence2_leading ||
+                    method_global_cfg.free_end_gaps_sequence1_trailing ||
+                    method_global_cfg.free_end_gaps_sequence2_trailing)
+                    throw invalid_alignment_configuration{"The align_cfg::vectorised_striped configuration does not "
+                                                          "support free end-gaps."};
+            }
+
+            return function_wrapper_t{pairwise_alignment_algorithm_striped<config_t>{cfg}};
+        }
+    }
+
+    /*!\brief Configures the global alignment that computes the trace in linear memory.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if free end-gaps are configured.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_linear_memory_traceback(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        auto const & method_global_cfg = get<seqan3::align_cfg::method_global>(cfg);
+        if (method_global_cfg.free_end_gaps_sequence1_leading ||
+            method_global_cfg.free_end_gaps_sequence2_leading ||
+            method_global_cfg.free_end_gaps_sequence1_trailing ||
+            method_global_cfg.free_end_gaps_sequence2_trailing)
+            throw invalid_alignment_configuration{"The align_cfg::linear_memory_traceback configuration does not "
+                                                  "support free end-gaps."};
+
+        using algorithm_t = pairwise_alignment_algorithm_linear_memory<
+                                config_t,
+                                policy_affine_gap_recursion<config_t>,
+                                policy_alignment_result_builder<config_t>,
+                                policy_scoring_scheme<config_t, typename traits_t::scoring_scheme_type>>;
+
+        return function_wrapper_t{algorithm_t{cfg}};
+    }
+
+    /*!\brief Configures the global alignment that is computed with the wavefront algorithm.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if free end-gaps or the dual affine gap costs are configured.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_wavefront(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::is_dual_affine)
+        {
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration cannot be combined with "
+                                                  "align_cfg::gap_cost_dual_affine."};
+        }
+        else
+        {
+            auto const & method_global_cfg = get<seqan3::align_cfg::method_global>(cfg);
+            if (method_global_cfg.free_end_gaps_sequence1_leading ||
+                method_global_cfg.free_end_gaps_sequence2_leading ||
+                method_global_cfg.free_end_gaps_sequence1_trailing ||
+                method_global_cfg.free_end_gaps_sequence2_trailing)
+                throw invalid_alignment_configuration{"The align_cfg::wavefront configuration does not support free "
+                                                      "end-gaps."};
+
+            using algorithm_t = pairwise_alignment_algorithm_wavefront<
+                                    config_t,
+                                    policy_alignment_result_builder<config_t>,
+                                    policy_scoring_scheme<config_t, typename traits_t::scoring_scheme_type>>;
+
+            return function_wrapper_t{algorithm_t{cfg}};
+        }
+    }
+
+    /*!\brief Constructs the old alignment algorithm wrapped in the passed std::function object.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam policies_t A template parameter pack for the already configured policy types.
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * Used for all configurations that are not yet supported by the new alignment implementation.
+     */
+    template <typename function_wrapper_t, typename ...policies_t, typename config_t>
+    static constexpr function_wrapper_t make_old_algorithm(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
+        using gap_policy_t = typename select_gap_policy<traits_t>::type;
+        using find_optimum_t = typename select_find_optimum_policy<traits_t>::type;
+        using gap_init_policy_t = deferred_crtp_base<affine_gap_init_policy>;
+
+        return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, find_optimum_t, gap_init_policy_t, policies_t...>{cfg};
+    }
 };
 
 //!\cond
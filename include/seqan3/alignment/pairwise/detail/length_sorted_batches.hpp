@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::length_sorted_batches.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes sequence pairs in batches of sequence pairs of similar length and restores the original order of
+ *        their results.
+ * \ingroup pairwise_alignment
+ *
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk over indexed sequence pairs passed to the alignment
+ *                                       algorithm.
+ * \tparam alignment_result_t The type of the alignment result.
+ *
+ * \details
+ *
+ * The vectorised alignment pads all sequences of a simd vector to the length of the longest sequence. This helper is
+ * used by the alignment algorithms that wrap the vectorised alignment algorithm, e.g.
+ * seqan3::detail::pairwise_alignment_algorithm_lane_packing and seqan3::detail::pairwise_alignment_algorithm_adaptive.
+ * It sorts the sequence pairs by the length of the longer sequence and passes them in batches of the given size to the
+ * wrapped algorithm. The results are stored at the position of the respective sequence pair within the chunk, such
+ * that they can be reported in the original order of the chunk after all batches have been computed.
+ */
+template <typename indexed_sequence_pair_chunk_t, typename alignment_result_t>
+class length_sorted_batches
+{
+private:
+    //!\brief The type of an indexed sequence pair as obtained from the chunk.
+    using indexed_sequence_pair_reference_t = std::ranges::range_reference_t<indexed_sequence_pair_chunk_t>;
+    //!\brief The type of the sequence pair as obtained from the indexed sequence pair.
+    using sequence_pair_reference_t = decltype(std::get<0>(std::declval<indexed_sequence_pair_reference_t>()));
+    //!\brief The type of the first sequence.
+    using sequence1_reference_t =
+        std::remove_reference_t<decltype(std::get<0>(std::declval<sequence_pair_reference_t>()))> &;
+    //!\brief The type of the second sequence.
+    using sequence2_reference_t =
+        std::remove_reference_t<decltype(std::get<1>(std::declval<sequence_pair_reference_t>()))> &;
+    //!\brief The type of the index.
+    using index_t = std::remove_cvref_t<decltype(std::get<1>(std::declval<indexed_sequence_pair_reference_t>()))>;
+
+public:
+    //!\brief The type of an indexed sequence pair that refers to the sequences of the original chunk.
+    using indexed_sequence_pair_type = std::pair<std::tuple<sequence1_reference_t, sequence2_reference_t>, index_t>;
+    //!\brief The type of a batch of indexed sequence pairs.
+    using batch_type = std::vector<indexed_sequence_pair_type>;
+
+    /*!\brief Prepares the results for a new chunk.
+     * \param[in] pair_count The number of sequence pairs of the chunk.
+     */
+    void reset(size_t const pair_count)
+    {
+        results.resize(pair_count);
+    }
+
+    /*!\brief Computes the given sequence pairs sorted by length in batches of the given size.
+     * \tparam algorithm_t The type of the wrapped algorithm; must be invocable with a batch and a callback that is
+     *                     invoked with the results of the batch in the order of the batch.
+     * \tparam position_map_t The type of the position map; must be invocable with a `size_t` and return a `size_t`.
+     *
+     * \param[in] pairs The sequence pairs to compute.
+     * \param[in] batch_size The maximal number of sequence pairs of a batch.
+     * \param[in] algorithm The wrapped algorithm invoked with every batch.
+     * \param[in] position_map Maps the position of a sequence pair within `pairs` to its position within the chunk.
+     *
+     * \details
+     *
+     * Sequence pairs of the same length keep their order. The wrapped algorithm may report no result for a batch,
+     * e.g. if the scores of the batch exceed the score type of the algorithm. The positions of the sequence pairs of
+     * such a batch can be obtained with seqan3::detail::length_sorted_batches::unreported_pairs afterwards.
+     */
+    template <typename algorithm_t, typename position_map_t>
+    void compute(batch_type const & pairs,
+                 size_t const batch_size,
+                 algorithm_t & algorithm,
+                 position_map_t && position_map)
+    {
+        lengths.clear();
+        for (indexed_sequence_pair_type const & indexed_sequence_pair : pairs)
+        {
+            lengths.push_back(std::max<size_t>(std::ranges::distance(std::get<0>(indexed_sequence_pair.first)),
+                                               std::ranges::distance(std::get<1>(indexed_sequence_pair.first))));
+        }
+
+        order.resize(pairs.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&] (size_t const lhs, size_t const rhs)
+        {
+            return lengths[lhs] < lengths[rhs];
+        });
+
+        unreported_positions.clear();
+        for (size_t batch_begin = 0; batch_begin < pairs.size(); batch_begin += batch_size)
+        {
+            size_t const batch_end = std::min(batch_begin + batch_size, pairs.size());
+
+            batch.clear();
+            for (size_t pair_index = batch_begin; pair_index < batch_end; ++pair_index)
+                batch.push_back(pairs[order[pair_index]]);
+
+            size_t pair_index = batch_begin;
+            algorithm(batch, [&] (auto && result)
+            {
+                results[position_map(order[pair_index++])] = std::move(result);
+            });
+
+            if (pair_index == batch_begin)
+                unreported_positions.insert(unreported_positions.end(),
+                                            order.begin() + batch_begin,
+                                            order.begin() + batch_end);
+        }
+    }
+
+    /*!\brief Returns the positions of the sequence pairs for which the last call to compute reported no result.
+     *
+     * \details
+     *
+     * The positions refer to the sequence pairs passed to seqan3::detail::length_sorted_batches::compute.
+     */
+    std::vector<size_t> const & unreported_pairs() const noexcept
+    {
+        return unreported_positions;
+    }
+
+    /*!\brief Invokes the callback with the results of the chunk in the original order.
+     * \tparam callback_t The type of the callback; must model std::invocable with `alignment_result_t`.
+     * \param[in] callback The callback invoked with every result.
+     */
+    template <typename callback_t>
+    void report(callback_t && callback)
+    {
+        for (alignment_result_t & result : results)
+            callback(std::move(result));
+    }
+
+private:
+    //!\brief The length of the longer sequence of every sequence pair that is currently computed.
+    std::vector<size_t> lengths{};
+    //!\brief The positions of the sequence pairs that are currently computed, sorted by length.
+    std::vector<size_t> order{};
+    //!\brief The batch of sequence pairs that is currently computed.
+    batch_type batch{};
+    //!\brief The positions of the sequence pairs for which no result was reported.
+    std::vector<size_t> unreported_positions{};
+    //!\brief The results of the current chunk in the original order.
+    std::vector<alignment_result_t> results{};
+};
+
+} // namespace seqan3::detail
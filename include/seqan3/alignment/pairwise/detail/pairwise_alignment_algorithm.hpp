@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <array>
 #include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
@@ -19,6 +20,8 @@
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/range/container/aligned_allocator.hpp>
 #include <seqan3/range/views/get.hpp>
+#include <seqan3/range/views/take.hpp>
+#include <seqan3/range/views/zip.hpp>
 #include <seqan3/utility/detail/type_name_as_string.hpp>
 #include <seqan3/utility/simd/views/to_simd.hpp>
 
@@ -184,18 +187,43 @@ public:
 
         compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix);
 
+        // No result is reported if a score may have overflowed, such that the batch can be computed again with a
+        // wider score type.
+        if (this->is_saturated())
+            return;
+
+        // Extract the scores and the end positions of the individual alignments.
+        std::array<original_score_t, traits_type::alignments_per_vector> scores{};
+        std::array<matrix_coordinate, traits_type::alignments_per_vector> end_positions{};
+        std::array<matrix_coordinate, traits_type::alignments_per_vector> begin_positions{};
+
+        for (size_t index = 0; index < traits_type::alignments_per_vector; ++index)
+        {
+            size_t const padding_offset = this->padding_offsets[index];
+            scores[index] = this->optimal_score[index] -
+                            (this->padding_offsets[index] * this->scoring_scheme.padding_match_score());
+            end_positions[index] =
+                matrix_coordinate{row_index_type{size_t{this->optimal_coordinate.row[index]} - padding_offset},
+                                  column_index_type{size_t{this->optimal_coordinate.col[index]} - padding_offset}};
+        }
+
+        // The global alignment always begins in the origin of the matrix. Only in the local alignment a second
+        // pass is needed, unless the begin positions are obtained from the trace matrix.
+        if constexpr (traits_type::compute_begin_positions &&
+                      traits_type::is_local &&
+                      !traits_type::requires_trace_information)
+            compute_begin_positions(seq1_collection, seq2_collection, end_positions, begin_positions);
+
         size_t index = 0;
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
         {
-            original_score_t score = this->optimal_score[index] -
-                                     (this->padding_offsets[index] * this->scoring_scheme.padding_match_score());
-            matrix_coordinate coordinate{row_index_type{size_t{this->optimal_coordinate.row[index]}},
-                                         column_index_type{size_t{this->optimal_coordinate.col[index]}}};
             this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
                                          std::move(idx),
-                                         std::move(score),
-                                         std::move(coordinate),
+                                         std::move(scores[index]),
+                                         std::move(begin_positions[index]),
+                                         std::move(end_positions[index]),
                                          alignment_matrix,
+                                         index,
                                          callback);
             ++index;
         }
@@ -238,6 +266,80 @@ protected:
             std::ranges::move(simd_vector_chunk, std::cpp20::back_inserter(simd_sequence));
     }
 
+    /*!\brief Computes the begin positions of a batch of local alignments in a second vectorised pass.
+     * \tparam sequence1_collection_t The type of the first sequence collection; must model std::ranges::forward_range.
+     * \tparam sequence2_collection_t The type of the second sequence collection; must model std::ranges::forward_range.
+     * \tparam coordinate_array_t The type of the array storing the matrix coordinates of the alignments.
+     *
+     * \param[in] sequence1_collection The batch of first sequences.
+     * \param[in] sequence2_collection The batch of second sequences.
+     * \param[in] end_positions The end positions of the alignments computed in the forward pass.
+     * \param[out] begin_positions The computed begin positions of the alignments.
+     *
+     * \details
+     *
+     * The prefixes of the sequences that end in the respective end positions are reversed and aligned again using the
+     * vectorised local alignment. An optimal alignment in the reversed matrices ends where the optimal alignment of
+     * the forward pass begins. Thus, the begin positions are obtained by subtracting the tracked coordinates of the
+     * reverse pass from the end positions. Compared to the computation of the trace matrix this keeps the linear
+     * memory footprint of the vectorised alignment and the cost is bounded by the size of the prefixes.
+     */
+    template <std::ranges::forward_range sequence1_collection_t,
+              std::ranges::forward_range sequence2_collection_t,
+              typename coordinate_array_t>
+    void compute_begin_positions(sequence1_collection_t & sequence1_collection,
+                                 sequence2_collection_t & sequence2_collection,
+                                 coordinate_array_t const & end_positions,
+                                 coordinate_array_t & begin_positions)
+    {
+        using simd_collection_t = std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>>;
+
+        auto reversed_prefix = [] (auto && sequence, size_t const prefix_size)
+        {
+            return sequence | views::take(prefix_size) | std::views::reverse;
+        };
+
+        auto reversed_sequence1_collection = views::zip(sequence1_collection, end_positions)
+                                           | std::views::transform([&] (auto && sequence_and_position)
+        {
+            auto && [sequence, position] = sequence_and_position;
+            return reversed_prefix(sequence, position.col);
+        });
+
+        auto reversed_sequence2_collection = views::zip(sequence2_collection, end_positions)
+                                           | std::views::transform([&] (auto && sequence_and_position)
+        {
+            auto && [sequence, position] = sequence_and_position;
+            return reversed_prefix(sequence, position.row);
+        });
+
+        this->initialise_tracker(reversed_sequence1_collection, reversed_sequence2_collection);
+
+        thread_local simd_collection_t simd_seq1_collection{};
+        thread_local simd_collection_t simd_seq2_collection{};
+
+        convert_batch_of_sequences_to_simd_vector(simd_seq1_collection,
+                                                  reversed_sequence1_collection,
+                                                  this->scoring_scheme.padding_symbol);
+        convert_batch_of_sequences_to_simd_vector(simd_seq2_collection,
+                                                  reversed_sequence2_collection,
+                                                  this->scoring_scheme.padding_symbol);
+
+        size_t const sequence1_size = std::ranges::distance(simd_seq1_collection);
+        size_t const sequence2_size = std::ranges::distance(simd_seq2_collection);
+
+        auto && [alignment_matrix, index_matrix] = this->acquire_matrices(sequence1_size, sequence2_size);
+
+        compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix);
+
+        for (size_t index = 0; index < traits_type::alignments_per_vector; ++index)
+        {
+            begin_positions[index] =
+                matrix_coordinate{row_index_type{end_positions[index].row - this->optimal_coordinate.row[index]},
+                                  column_index_type{end_positions[index].col - this->optimal_coordinate.col[index]}};
+        }
+    }
+
     /*!\brief Compute the actual alignment.
      * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
      * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
@@ -250,6 +352,11 @@ protected:
      * \param[in] sequence2 The second sequence to compute the alignment for.
      * \param[in] alignment_matrix The alignment matrix to compute.
      * \param[in] index_matrix The index matrix corresponding to the alignment matrix.
+     *
+     * \details
+     *
+     * If seqan3::align_cfg::x_drop is configured, the computation stops after the first column for which the
+     * optimum tracker reports that the score dropped too far below the optimum.
      */
     template <std::ranges::forward_range sequence1_t,
               std::ranges::forward_range sequence2_t,
@@ -279,12 +386,18 @@ protected:
         // Iteration phase: compute column-wise the alignment matrix.
         // ---------------------------------------------------------------------
 
+        size_t column_index = 0;
         for (auto alphabet1 : sequence1)
+        {
             compute_column(*++alignment_matrix_it,
                            *++indexed_matrix_it,
                            this->scoring_scheme_profile_column(alphabet1),
                            sequence2);
 
+            if (this->x_drop_reached(++column_index)) // Terminate the extension early.
+                break;
+        }
+
         // ---------------------------------------------------------------------
         // Final phase: track score of last column
         // ---------------------------------------------------------------------
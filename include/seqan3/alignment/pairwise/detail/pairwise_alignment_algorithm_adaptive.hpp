@@ -0,0 +1,359 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_adaptive.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_saturation_check.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/detail/length_sorted_batches.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the vectorised alignment with the narrowest score type that cannot overflow.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk over indexed sequence pairs passed to this algorithm.
+ * \tparam callback_t The type of the callback invoked with the computed alignment results.
+ * \tparam detect_saturation Whether the algorithms of the narrow score types detect scores that exceed the score type.
+ *
+ * \details
+ *
+ * This algorithm is configured if seqan3::align_cfg::score_type_adaptive is combined with
+ * seqan3::align_cfg::vectorised. It holds one vectorised alignment algorithm for every score type `int8_t`, `int16_t`
+ * and `int32_t`. For every sequence pair of the given chunk the narrowest score type is selected for which no value
+ * of the alignment matrix can fall below the range of the score type. Then the sequence pairs are computed in batches
+ * with the algorithm of the respective score type and the results are reported in the original order of the chunk.
+ *
+ * The lower bound for the values of the alignment matrix is derived from the length `l` of the longer sequence, the
+ * minimal substitution score \f$ s_{min} \f$, the gap open score \f$ g_o \f$ and the gap extension score \f$ g_e \f$.
+ * Every value in the global alignment is bounded from below by the score of a path with only gaps, i.e.
+ * \f$ 3g_o + (2l + 2)g_e + s_{min} \f$ including the intermediate values of the gap matrices. In the local alignment
+ * the lower bound is independent of the sequence length: \f$ g_o + 2g_e + s_{min} \f$.
+ * Since the sequences of one batch are padded to the length of the longest sequence, the bound of a sequence pair also
+ * holds for every batch the pair is computed in, as long as all pairs of the batch satisfy the bound for the same score
+ * type. In addition, the length of the sequences must fit into the score type, which also stores the padding offsets.
+ *
+ * The largest value of the alignment matrix depends on the similarity of the sequences and is often far below the
+ * score of a path with only matches, i.e. \f$ l * s_{max} \f$ with the maximal substitution score \f$ s_{max} \f$.
+ * Therefore, the algorithms of the score types `int8_t` and `int16_t` are configured with
+ * seqan3::align_cfg::detail::saturation_check and report no result for a batch in which any value came closer to the
+ * largest value of the score type than \f$ s_{max} \f$. The sequence pairs of such a batch are computed again with
+ * the next wider score type. If the configured alignment is computed by an implementation that cannot detect the
+ * saturation, i.e. `detect_saturation` is `false`, the upper bound \f$ l * s_{max} \f$ must fit into the score type
+ * instead.
+ *
+ * Within every score type the sequence pairs are sorted by length before they are distributed to the batches,
+ * such that a long sequence pair does not force the other lanes of its batch to compute a much larger matrix.
+ */
+template <typename alignment_configuration_t,
+          typename indexed_sequence_pair_chunk_t,
+          typename callback_t,
+          bool detect_saturation>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_adaptive
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The helper that computes the sequence pairs sorted by length and restores the original order.
+    using batches_type = length_sorted_batches<indexed_sequence_pair_chunk_t,
+                                               typename traits_type::alignment_result_type>;
+
+public:
+    //!\brief The type of an indexed sequence pair that refers to the sequences of the original chunk.
+    using indexed_sequence_pair_type = typename batches_type::indexed_sequence_pair_type;
+    //!\brief The type of a batch of indexed sequence pairs computed with the same score type.
+    using batch_type = typename batches_type::batch_type;
+    //!\brief The type-erased alignment algorithm for a single score type.
+    using algorithm_type = std::function<void(batch_type &, callback_t)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_adaptive() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive(pairwise_alignment_algorithm_adaptive const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive(pairwise_alignment_algorithm_adaptive &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive & operator=(pairwise_alignment_algorithm_adaptive const &) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive & operator=(pairwise_alignment_algorithm_adaptive &&) = default;
+    //!< Defaulted.
+    ~pairwise_alignment_algorithm_adaptive() = default; //!< Defaulted.
+
+    /*!\brief Constructs the algorithms for the different score types.
+     * \tparam algorithm_factory_t The type of the factory; must be invocable with a configuration and return
+     *                             pairwise_alignment_algorithm_adaptive::algorithm_type.
+     *
+     * \param[in] config The alignment configuration.
+     * \param[in] algorithm_factory The factory used to configure the algorithm for a single score type.
+     *
+     * \details
+     *
+     * The factory is invoked with the given configuration, in which seqan3::align_cfg::score_type_adaptive is replaced
+     * by seqan3::align_cfg::score_type for the respective score type. The algorithm is only configured for a score
+     * type if the scores of the scoring scheme can be represented by this type. If `detect_saturation` is `true`, the
+     * configurations of the score types `int8_t` and `int16_t` are extended by
+     * seqan3::align_cfg::detail::saturation_check.
+     */
+    template <typename algorithm_factory_t>
+    pairwise_alignment_algorithm_adaptive(alignment_configuration_t const & config,
+                                          algorithm_factory_t && algorithm_factory)
+    {
+        initialise_score_bounds(config);
+
+        auto config_without_score_type = config.template remove<align_cfg::score_type_adaptive>();
+
+        auto make_narrow_algorithm = [&] (auto const & score_type_config)
+        {
+            if constexpr (detect_saturation)
+                return algorithm_factory(score_type_config |
+                                         align_cfg::detail::saturation_check{static_cast<int32_t>(max_sequence_score)});
+            else
+                return algorithm_factory(score_type_config);
+        };
+
+        if (scoring_scheme_fits<int8_t>())
+            algorithms[0] = make_narrow_algorithm(config_without_score_type | align_cfg::score_type<int8_t>{});
+        if (scoring_scheme_fits<int16_t>())
+            algorithms[1] = make_narrow_algorithm(config_without_score_type | align_cfg::score_type<int16_t>{});
+
+        algorithms[2] = algorithm_factory(config_without_score_type | align_cfg::score_type<int32_t>{});
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignments for the given chunk over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam other_callback_t The type of the callback function that is called with the alignment result; must
+     *                          model std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Distributes the sequence pairs to the narrowest viable score type and computes them in batches of the size of
+     * the respective simd vector. The sequence pairs of a batch for which no result was reported are computed again
+     * with the next wider score type. The callback is invoked with the results in the order of the given sequence
+     * pairs.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename other_callback_t>
+    //!\cond
+        requires std::invocable<other_callback_t, typename traits_type::alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, other_callback_t && callback)
+    {
+        using std::get;
+
+        for (size_t score_type_index = 0; score_type_index < algorithms.size(); ++score_type_index)
+        {
+            batches[score_type_index].clear();
+            positions[score_type_index].clear();
+        }
+
+        size_t position = 0;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            size_t const sequence_length = std::max<size_t>(std::ranges::distance(get<0>(sequence_pair)),
+                                                            std::ranges::distance(get<1>(sequence_pair)));
+            size_t const score_type_index = select_score_type(sequence_length);
+
+            batches[score_type_index].emplace_back(std::forward_as_tuple(get<0>(sequence_pair), get<1>(sequence_pair)),
+                                                   idx);
+            positions[score_type_index].push_back(position++);
+        }
+
+        constexpr std::array<size_t, 3> batch_sizes{simd_traits<simd_type_t<int8_t>>::length,
+                                                    simd_traits<simd_type_t<int16_t>>::length,
+                                                    simd_traits<simd_type_t<int32_t>>::length};
+
+        sorted_batches.reset(position);
+
+        for (size_t score_type_index = 0; score_type_index < algorithms.size(); ++score_type_index)
+        {
+            std::vector<size_t> const & pair_positions = positions[score_type_index];
+            sorted_batches.compute(batches[score_type_index],
+                                   batch_sizes[score_type_index],
+                                   algorithms[score_type_index],
+                                   [&] (size_t const pair_index) { return pair_positions[pair_index]; });
+
+            // The algorithm of the int32_t score type never detects a saturation.
+            for (size_t const pair_index : sorted_batches.unreported_pairs())
+            {
+                batches[score_type_index + 1].push_back(batches[score_type_index][pair_index]);
+                positions[score_type_index + 1].push_back(pair_positions[pair_index]);
+            }
+        }
+
+        sorted_batches.report(callback);
+    }
+    //!\}
+
+private:
+    /*!\brief Returns the index of the narrowest score type with which the alignment matrix can be computed.
+     * \param[in] sequence_length The length of the longer sequence of the sequence pair.
+     */
+    size_t select_score_type(size_t const sequence_length) const noexcept
+    {
+        if (algorithms[0] && fits<int8_t>(sequence_length))
+            return 0;
+        else if (algorithms[1] && fits<int16_t>(sequence_length))
+            return 1;
+        else
+            return 2;
+    }
+
+    /*!\brief Checks whether the alignment matrix can be computed with the given score type.
+     * \tparam score_t The score type to check.
+     * \param[in] sequence_length The length of the longer sequence of the sequence pair.
+     */
+    template <typename score_t>
+    bool fits(size_t const sequence_length) const noexcept
+    {
+        // The padding offsets are stored with the score type and the matrix coordinates with its unsigned counterpart.
+        if (sequence_length > static_cast<size_t>(std::numeric_limits<score_t>::max()))
+            return false;
+
+        int64_t const length = sequence_length;
+        int64_t const lower_bound = (traits_type::is_local)
+                                  ? gap_open_score + 2 * gap_extension_score + min_sequence_score
+                                  : 3 * gap_open_score + (2 * length + 2) * gap_extension_score + min_sequence_score;
+
+        if (lower_bound < std::numeric_limits<score_t>::lowest())
+            return false;
+
+        // Otherwise, a value exceeding the score type is detected during the computation.
+        if constexpr (!detect_saturation)
+            return length * max_sequence_score <= std::numeric_limits<score_t>::max();
+        else
+            return true;
+    }
+
+    /*!\brief Checks whether the scoring scheme can be represented by the simd scoring scheme of the given score type.
+     * \tparam score_t The score type to check.
+     *
+     * \details
+     *
+     * Besides the scores, the vectorised scoring scheme for amino acids stores the indices into the linearised
+     * scoring matrix with the score type.
+     */
+    template <typename score_t>
+    bool scoring_scheme_fits() const noexcept
+    {
+        using scoring_scheme_t = typename traits_type::scoring_scheme_type;
+
+        if constexpr (is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>)
+        {
+            constexpr int64_t index_offset = alphabet_size<typename traits_type::scoring_scheme_alphabet_type> + 1;
+
+            if constexpr (index_offset * index_offset > std::numeric_limits<score_t>::max())
+                return false;
+        }
+
+        return max_sequence_score <= std::numeric_limits<score_t>::max() &&
+               min_sequence_score >= std::numeric_limits<score_t>::lowest();
+    }
+
+    /*!\brief Initialises the bounds of the substitution and the gap scores from the configuration.
+     * \param[in] config The alignment configuration.
+     *
+     * \details
+     *
+     * The substitution score bounds include the scores used for the padded symbols of the vectorised alignment.
+     */
+    void initialise_score_bounds(alignment_configuration_t const & config)
+    {
+        using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
+        auto const & scoring_scheme = get<align_cfg::scoring_scheme>(config).scheme;
+
+        max_sequence_score = 1;
+        min_sequence_score = -1;
+        for (size_t lhs_rank = 0; lhs_rank < alphabet_size<alphabet_t>; ++lhs_rank)
+        {
+            for (size_t rhs_rank = 0; rhs_rank < alphabet_size<alphabet_t>; ++rhs_rank)
+            {
+                int64_t const score = scoring_scheme.score(assign_rank_to(lhs_rank, alphabet_t{}),
+                                                           assign_rank_to(rhs_rank, alphabet_t{}));
+                max_sequence_score = std::max(max_sequence_score, score);
+                min_sequence_score = std::min(min_sequence_score, score);
+            }
+        }
+
+        if constexpr (traits_type::is_dual_affine)
+        {
+            // Both gap cost functions are computed separately, so the bounds must hold for the worse of both.
+            auto const & gap_cost = get<align_cfg::gap_cost_dual_affine>(config);
+            gap_open_score = std::min<int64_t>({gap_cost.short_gap_cost.open_score,
+                                                gap_cost.long_gap_cost.open_score,
+                                                0});
+            gap_extension_score = std::min<int64_t>({gap_cost.short_gap_cost.extension_score,
+                                                     gap_cost.long_gap_cost.extension_score,
+                                                     0});
+        }
+        else
+        {
+            auto const & gap_cost = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                             align_cfg::extension_score{-1}});
+            gap_open_score = std::min<int64_t>(gap_cost.open_score, 0);
+            gap_extension_score = std::min<int64_t>(gap_cost.extension_score, 0);
+        }
+    }
+
+    //!\brief The algorithms for the score types `int8_t`, `int16_t` and `int32_t`; empty if not viable.
+    std::array<algorithm_type, 3> algorithms{};
+    //!\brief The sequence pairs of the current chunk distributed to the score types.
+    std::array<batch_type, 3> batches{};
+    //!\brief The positions of the distributed sequence pairs within the current chunk.
+    std::array<std::vector<size_t>, 3> positions{};
+    //!\brief Computes the sequence pairs of every score type in batches.
+    batches_type sorted_batches{};
+    //!\brief The maximal substitution score.
+    int64_t max_sequence_score{};
+    //!\brief The minimal substitution score.
+    int64_t min_sequence_score{};
+    //!\brief The gap open score.
+    int64_t gap_open_score{};
+    //!\brief The gap extension score.
+    int64_t gap_extension_score{};
+};
+
+} // namespace seqan3::detail
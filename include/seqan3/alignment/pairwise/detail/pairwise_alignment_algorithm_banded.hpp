@@ -12,10 +12,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
 #include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
+#include <vector>
 
+#include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
 #include <seqan3/range/views/drop.hpp>
 #include <seqan3/range/views/take.hpp>
 #include <seqan3/range/views/slice.hpp>
@@ -27,6 +34,14 @@ namespace seqan3::detail
  * \implements std::invocable
  * \ingroup pairwise_alignment
  * \copydetails seqan3::detail::pairwise_alignment_algorithm
+ *
+ * ### Band per sequence pair
+ *
+ * If seqan3::align_cfg::band_per_sequence_pair is configured, the band is selected for every sequence pair before its
+ * alignment is computed. In the vectorised alignment the matrix is computed within the smallest band covering the
+ * bands of all sequence pairs of the current simd vector. Every cell outside of the band of a sequence pair is set to
+ * the lowest viable score in the respective vector lane, such that it cannot contribute to the alignment of this
+ * sequence pair.
  */
 template <typename alignment_configuration_t, typename ...policies_t>
 //!\cond
@@ -68,7 +83,10 @@ public:
      * \throws seqan3::invalid_alignment_configuration.
      */
     pairwise_alignment_algorithm_banded(alignment_configuration_t const & config) : base_algorithm_t(config)
-    {}
+    {
+        if constexpr (traits_type::is_banded_per_sequence_pair)
+            band_selector = get<align_cfg::band_per_sequence_pair>(config);
+    }
     //!\}
 
     /*!\name Invocation
@@ -85,6 +103,9 @@ public:
 
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
         {
+            if constexpr (traits_type::is_banded_per_sequence_pair)
+                this->select_band(band_selector(idx));
+
             size_t sequence1_size = std::ranges::distance(get<0>(sequence_pair));
             size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
 
@@ -92,9 +113,11 @@ public:
                                                                               sequence2_size,
                                                                               this->lowest_viable_score());
 
-            // Initialise the cell updater with the dimensions of the regular matrix.
-            this->compare_and_set_optimum.set_target_indices(row_index_type{sequence2_size},
-                                                             column_index_type{sequence1_size});
+            // Initialise the cell updater with the dimensions of the regular matrix. With x-drop the alignment may end
+            // in any cell, which is tracked by the unbanded updater.
+            if constexpr (!traits_type::is_x_drop)
+                this->compare_and_set_optimum.set_target_indices(row_index_type{sequence2_size},
+                                                                 column_index_type{sequence1_size});
 
             // Shrink the first sequence if the band ends before its actual end.
             sequence1_size = std::min(sequence1_size, this->upper_diagonal + sequence2_size);
@@ -126,6 +149,9 @@ public:
         auto seq1_collection = indexed_sequence_pairs | views::get<0> | views::get<0>;
         auto seq2_collection = indexed_sequence_pairs | views::get<0> | views::get<1>;
 
+        if constexpr (traits_type::is_banded_per_sequence_pair)
+            select_lane_bands(indexed_sequence_pairs);
+
         this->initialise_tracker(seq1_collection, seq2_collection);
 
         // Convert batch of sequences to sequence of simd vectors.
@@ -148,6 +174,11 @@ public:
 
         compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix);
 
+        // No result is reported if a score may have overflowed, such that the batch can be computed again with a
+        // wider score type.
+        if (this->is_saturated())
+            return;
+
         size_t index = 0;
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
         {
@@ -158,8 +189,10 @@ public:
             this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
                                          std::move(idx),
                                          std::move(score),
+                                         matrix_coordinate{},
                                          std::move(coordinate),
                                          alignment_matrix,
+                                         index,
                                          callback);
             ++index;
         }
@@ -218,6 +251,9 @@ protected:
      * G 3|     |     |(3,2)|(3,3)|(3,4)|(3,5)|(3,6)|
      * T 4|     |     |     |(4,3)|(4,4)|(4,5)|(4,6)|
      *```
+     *
+     * If seqan3::align_cfg::x_drop is configured, the computation stops after the first column in either phase for
+     * which the optimum tracker reports that the score dropped too far below the optimum.
      */
     template <std::ranges::forward_range sequence1_t,
               std::ranges::forward_range sequence2_t,
@@ -243,18 +279,28 @@ protected:
 
         size_t row_size = std::max<int32_t>(0, -this->lower_diagonal);
         size_t const column_size = std::max<int32_t>(0, this->upper_diagonal);
-        this->initialise_column(*alignment_matrix_it, *indexed_matrix_it, sequence2 | views::take(row_size));
+        initialise_column(*alignment_matrix_it,
+                          *indexed_matrix_it,
+                          sequence2 | views::take(row_size),
+                          column_size);
 
         // ---------------------------------------------------------------------
         // 1st recursion phase: band intersects with the first row.
         // ---------------------------------------------------------------------
 
+        size_t diagonal_offset = column_size;
+        size_t column_index = 0;
+        bool is_terminated = false;
         for (auto alphabet1 : sequence1 | views::take(column_size))
         {
-            this->compute_column(*++alignment_matrix_it,
-                                 *++indexed_matrix_it,
-                                 alphabet1,
-                                 sequence2 | views::take(++row_size));
+            compute_column(*++alignment_matrix_it,
+                           *++indexed_matrix_it,
+                           alphabet1,
+                           sequence2 | views::take(++row_size),
+                           --diagonal_offset);
+
+            if ((is_terminated = this->x_drop_reached(++column_index))) // Terminate the extension early.
+                break;
         }
 
         // ---------------------------------------------------------------------
@@ -264,11 +310,15 @@ protected:
         size_t first_row_index = 0u;
         for (auto alphabet1 : sequence1 | views::drop(column_size))
         {
+            if (is_terminated)
+                break;
+
             compute_band_column(*++alignment_matrix_it,
                                 *++indexed_matrix_it | views::drop(first_row_index + 1),
                                 alphabet1,
                                 sequence2 | views::slice(first_row_index, ++row_size));
             ++first_row_index;
+            is_terminated = this->x_drop_reached(++column_index);
         }
 
         // ---------------------------------------------------------------------
@@ -341,6 +391,9 @@ protected:
      * current cell (the one that is written to) and the second points to the next cell (the one where the
      * horizontal and vertical scores are read from). After computing the last cell of the column the value of the
      * current iterator can be used to track the score of the cell.
+     *
+     * The first cell of the column is always located on the upper diagonal of the band, such that the offset of the
+     * n-th cell from the upper diagonal is n.
      */
     template <std::ranges::forward_range alignment_column_t,
               std::ranges::input_range cell_index_column_t,
@@ -360,11 +413,15 @@ protected:
 
         // Points to the last valid cell in the column.
         decltype(current_alignment_column_it) next_alignment_column_it{current_alignment_column_it};
+        size_t diagonal_offset = 0;
         auto cell = *current_alignment_column_it;
         cell = this->track_cell(
-                this->initialise_band_first_cell(cell.best_score(),
-                                                 *++next_alignment_column_it,
-                                                 this->scoring_scheme.score(alphabet1, *std::ranges::begin(sequence2))),
+                restrict_to_lane_bands(
+                    this->initialise_band_first_cell(cell.best_score(),
+                                                     *++next_alignment_column_it,
+                                                     this->scoring_scheme.score(alphabet1,
+                                                                                *std::ranges::begin(sequence2))),
+                    diagonal_offset),
                 *cell_index_column_it);
 
         // ---------------------------------------------------------------------
@@ -376,9 +433,10 @@ protected:
             current_alignment_column_it = next_alignment_column_it;
             auto cell = *current_alignment_column_it;
             cell = this->track_cell(
-                this->compute_inner_cell(cell.best_score(),
-                                         *++next_alignment_column_it,
-                                         this->scoring_scheme.score(alphabet1, alphabet2)),
+                restrict_to_lane_bands(this->compute_inner_cell(cell.best_score(),
+                                                                *++next_alignment_column_it,
+                                                                this->scoring_scheme.score(alphabet1, alphabet2)),
+                                       ++diagonal_offset),
                 *++cell_index_column_it);
         }
 
@@ -388,6 +446,205 @@ protected:
 
         this->track_last_row_cell(*current_alignment_column_it, *cell_index_column_it);
     }
+
+    /*!\brief Initialises the first column of the banded alignment matrix.
+     * \tparam alignment_column_t The type of the alignment column; must model std::ranges::input_range.
+     * \tparam cell_index_column_t The type of the indexed column; must model std::ranges::input_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::input_range.
+     *
+     * \param[in] alignment_column The current alignment matrix column to compute.
+     * \param[in] cell_index_column The current index matrix column to get the respective cell indices.
+     * \param[in] sequence2 The second sequence used to determine the size of the column.
+     * \param[in] diagonal_offset The offset of the first cell of the column from the upper diagonal of the band.
+     *
+     * \details
+     *
+     * Same as seqan3::detail::pairwise_alignment_algorithm::initialise_column, but every cell is restricted to the
+     * bands of the sequence pairs (see seqan3::detail::pairwise_alignment_algorithm_banded::restrict_to_lane_bands).
+     */
+    template <std::ranges::input_range alignment_column_t,
+              std::ranges::input_range cell_index_column_t,
+              std::ranges::input_range sequence2_t>
+    void initialise_column(alignment_column_t && alignment_column,
+                           cell_index_column_t && cell_index_column,
+                           sequence2_t && sequence2,
+                           size_t diagonal_offset)
+    {
+        auto first_column_it = alignment_column.begin();
+        auto cell_index_column_it = cell_index_column.begin();
+        *first_column_it = this->track_cell(restrict_to_lane_bands(this->initialise_origin_cell(), diagonal_offset),
+                                            *cell_index_column_it);
+
+        for ([[maybe_unused]] auto const & unused : sequence2)
+        {
+            ++first_column_it;
+            *first_column_it = this->track_cell(
+                restrict_to_lane_bands(this->initialise_first_column_cell(*first_column_it), ++diagonal_offset),
+                *++cell_index_column_it);
+        }
+
+        this->track_last_row_cell(*first_column_it, *cell_index_column_it);
+    }
+
+    /*!\brief Computes a column of the band that starts in the first row of the alignment matrix.
+     * \tparam alignment_column_t The type of the alignment column; must model std::ranges::input_range.
+     * \tparam cell_index_column_t The type of the indexed column; must model std::ranges::input_range.
+     * \tparam alphabet1_t The type of the current symbol of sequence1.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::input_range.
+     *
+     * \param[in] alignment_column The current alignment matrix column to compute.
+     * \param[in] cell_index_column The current index matrix column to get the respective cell indices.
+     * \param[in] alphabet1 The current symbol of sequence1.
+     * \param[in] sequence2 The second sequence to align against `alphabet1`.
+     * \param[in] diagonal_offset The offset of the first cell of the column from the upper diagonal of the band.
+     *
+     * \details
+     *
+     * Same as seqan3::detail::pairwise_alignment_algorithm::compute_column, but every cell is restricted to the
+     * bands of the sequence pairs (see seqan3::detail::pairwise_alignment_algorithm_banded::restrict_to_lane_bands).
+     */
+    template <std::ranges::input_range alignment_column_t,
+              std::ranges::input_range cell_index_column_t,
+              typename alphabet1_t,
+              std::ranges::input_range sequence2_t>
+    void compute_column(alignment_column_t && alignment_column,
+                        cell_index_column_t && cell_index_column,
+                        alphabet1_t const & alphabet1,
+                        sequence2_t && sequence2,
+                        size_t diagonal_offset)
+    {
+        auto alignment_column_it = alignment_column.begin();
+        auto cell_index_column_it = cell_index_column.begin();
+
+        auto cell = *alignment_column_it;
+        score_type diagonal = cell.best_score();
+        *alignment_column_it = this->track_cell(restrict_to_lane_bands(this->initialise_first_row_cell(cell),
+                                                                       diagonal_offset),
+                                                *cell_index_column_it);
+
+        for (auto const & alphabet2 : sequence2)
+        {
+            auto cell = *++alignment_column_it;
+            score_type next_diagonal = cell.best_score();
+            *alignment_column_it = this->track_cell(
+                restrict_to_lane_bands(this->compute_inner_cell(diagonal,
+                                                                cell,
+                                                                this->scoring_scheme.score(alphabet1, alphabet2)),
+                                       ++diagonal_offset),
+                *++cell_index_column_it);
+            diagonal = next_diagonal;
+        }
+
+        this->track_last_row_cell(*alignment_column_it, *cell_index_column_it);
+    }
+
+    /*!\brief Selects the bands of the sequence pairs computed in the current simd vector.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \param[in] indexed_sequence_pairs The sequence pairs of the current simd vector.
+     *
+     * \details
+     *
+     * Validates the band of every sequence pair and selects the smallest band covering all of them. The band is
+     * additionally limited to the dimensions of the largest sequences, such that a sequence pair without any
+     * restriction does not enlarge the band beyond the alignment matrix. Afterwards, for every diagonal within the
+     * selected band, a mask is stored that marks the lanes whose band contains this diagonal. Lanes that are not
+     * occupied by a sequence pair are never restricted.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band of a sequence pair is invalid.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t>
+    void select_lane_bands(indexed_sequence_pairs_t && indexed_sequence_pairs)
+    {
+        using std::get;
+        using lane_band_t = std::pair<int64_t, int64_t>;
+
+        std::array<lane_band_t, traits_type::alignments_per_vector> lane_bands{};
+        int64_t lower_diagonal = std::numeric_limits<int32_t>::max();
+        int64_t upper_diagonal = std::numeric_limits<int32_t>::lowest();
+        int64_t max_sequence1_size = 0;
+        int64_t max_sequence2_size = 0;
+        size_t lane = 0;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            int64_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            int64_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            align_cfg::band_fixed_size const band = band_selector(idx);
+            this->select_band(band);
+            this->check_valid_band_configuration(sequence1_size, sequence2_size);
+
+            // The band always includes the diagonals computed before the band leaves the first row or column.
+            lane_bands[lane] = lane_band_t{std::min<int64_t>(band.lower_diagonal, 0),
+                                           std::max<int64_t>(band.upper_diagonal, 0)};
+            lower_diagonal = std::min(lower_diagonal, lane_bands[lane].first);
+            upper_diagonal = std::max(upper_diagonal, lane_bands[lane].second);
+            max_sequence1_size = std::max(max_sequence1_size, sequence1_size);
+            max_sequence2_size = std::max(max_sequence2_size, sequence2_size);
+            ++lane;
+        }
+
+        lower_diagonal = std::max(lower_diagonal, -max_sequence2_size);
+        upper_diagonal = std::min(upper_diagonal, max_sequence1_size);
+
+        for (; lane < lane_bands.size(); ++lane)
+            lane_bands[lane] = lane_band_t{lower_diagonal, upper_diagonal};
+
+        this->select_band(align_cfg::band_fixed_size{align_cfg::lower_diagonal{static_cast<int32_t>(lower_diagonal)},
+                                                     align_cfg::upper_diagonal{static_cast<int32_t>(upper_diagonal)}});
+
+        lane_band_masks.resize(upper_diagonal - lower_diagonal + 1);
+        for (int64_t diagonal = upper_diagonal; diagonal >= lower_diagonal; --diagonal)
+        {
+            score_type & mask = lane_band_masks[upper_diagonal - diagonal];
+            for (size_t lane_index = 0; lane_index < lane_bands.size(); ++lane_index)
+            {
+                auto const & [lane_lower_diagonal, lane_upper_diagonal] = lane_bands[lane_index];
+                mask[lane_index] = (lane_lower_diagonal <= diagonal && diagonal <= lane_upper_diagonal) ? -1 : 0;
+            }
+        }
+
+        outside_band_score = this->lowest_viable_score();
+    }
+
+    /*!\brief Sets the scores of a cell to the lowest viable score in every lane whose band does not contain the cell.
+     * \tparam affine_cell_t The type of the affine cell.
+     *
+     * \param[in] cell The computed cell.
+     * \param[in] diagonal_offset The offset of the diagonal of the cell from the upper diagonal of the band.
+     *
+     * \returns The cell restricted to the bands of the sequence pairs.
+     *
+     * \details
+     *
+     * Only has an effect if seqan3::align_cfg::band_per_sequence_pair is configured for the vectorised alignment.
+     * Otherwise, the band of the matrix is exactly the band of the computed sequence pair and the cell is returned
+     * unmodified.
+     */
+    template <typename affine_cell_t>
+    affine_cell_t restrict_to_lane_bands(affine_cell_t cell, [[maybe_unused]] size_t const diagonal_offset) const
+        noexcept
+    {
+        if constexpr (traits_type::is_vectorised && traits_type::is_banded_per_sequence_pair)
+        {
+            assert(diagonal_offset < lane_band_masks.size());
+
+            score_type const & in_band = lane_band_masks[diagonal_offset];
+            cell.best_score() = in_band ? cell.best_score() : outside_band_score;
+            cell.horizontal_score() = in_band ? cell.horizontal_score() : outside_band_score;
+            cell.vertical_score() = in_band ? cell.vertical_score() : outside_band_score;
+        }
+
+        return cell;
+    }
+
+    //!\brief The band selector if seqan3::align_cfg::band_per_sequence_pair is configured.
+    std::function<align_cfg::band_fixed_size(size_t)> band_selector{};
+    //!\brief For every diagonal of the band, the mask of the lanes whose band contains the diagonal.
+    std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>> lane_band_masks{};
+    //!\brief The score of the cells outside of the band of a lane.
+    score_type outside_band_score{};
 };
 
 } // namespace seqan3::detail
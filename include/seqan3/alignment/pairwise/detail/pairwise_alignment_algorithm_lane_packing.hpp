@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_lane_packing.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <functional>
+#include <seqan3/std/ranges>
+#include <tuple>
+
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/length_sorted_batches.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the vectorised alignment for sequence pairs of similar length in the same simd vector.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk over indexed sequence pairs passed to this algorithm.
+ * \tparam callback_t The type of the callback invoked with the computed alignment results.
+ *
+ * \details
+ *
+ * This algorithm is configured if seqan3::align_cfg::vectorised is used. The vectorised alignment pads all sequences
+ * of a simd vector to the length of the longest sequence, such that a single long sequence pair forces all other
+ * lanes to compute the full matrix of this pair. Therefore, seqan3::align_pairwise passes chunks of
+ * seqan3::detail::alignment_configuration_traits::alignments_per_chunk sequence pairs to this algorithm, which spans
+ * several simd vectors. The sequence pairs of the chunk are sorted by the length of the longer sequence and are then
+ * computed in batches of the size of the simd vector with the wrapped vectorised alignment algorithm.
+ * The chunk bounds the reordering window and the results are reported in the original order of the chunk.
+ */
+template <typename alignment_configuration_t, typename indexed_sequence_pair_chunk_t, typename callback_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_lane_packing
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The helper that computes the sequence pairs sorted by length and restores the original order.
+    using batches_type = length_sorted_batches<indexed_sequence_pair_chunk_t,
+                                               typename traits_type::alignment_result_type>;
+
+public:
+    //!\brief The type of an indexed sequence pair that refers to the sequences of the original chunk.
+    using indexed_sequence_pair_type = typename batches_type::indexed_sequence_pair_type;
+    //!\brief The type of a batch of indexed sequence pairs computed in one simd vector.
+    using batch_type = typename batches_type::batch_type;
+    //!\brief The type-erased vectorised alignment algorithm.
+    using algorithm_type = std::function<void(batch_type &, callback_t)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_lane_packing() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_lane_packing(pairwise_alignment_algorithm_lane_packing const &) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_lane_packing(pairwise_alignment_algorithm_lane_packing &&) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_lane_packing & operator=(pairwise_alignment_algorithm_lane_packing const &) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_lane_packing & operator=(pairwise_alignment_algorithm_lane_packing &&) = default;
+    //!< Defaulted.
+    ~pairwise_alignment_algorithm_lane_packing() = default; //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the wrapped vectorised alignment algorithm.
+     * \param[in] algorithm The vectorised alignment algorithm invoked with every batch.
+     */
+    explicit pairwise_alignment_algorithm_lane_packing(algorithm_type algorithm) : algorithm{std::move(algorithm)}
+    {}
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignments for the given chunk over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam other_callback_t The type of the callback function that is called with the alignment result; must
+     *                          model std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Sorts the sequence pairs by the length of the longer sequence and computes them in batches of the size of the
+     * simd vector. The callback is invoked with the results in the order of the given sequence pairs.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename other_callback_t>
+    //!\cond
+        requires std::invocable<other_callback_t, typename traits_type::alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, other_callback_t && callback)
+    {
+        using std::get;
+
+        pairs.clear();
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+            pairs.emplace_back(std::forward_as_tuple(get<0>(sequence_pair), get<1>(sequence_pair)), idx);
+
+        batches.reset(pairs.size());
+        batches.compute(pairs, traits_type::alignments_per_vector, algorithm, [] (size_t const position)
+        {
+            return position;
+        });
+        batches.report(callback);
+    }
+    //!\}
+
+private:
+    //!\brief The wrapped vectorised alignment algorithm.
+    algorithm_type algorithm{};
+    //!\brief The sequence pairs of the current chunk.
+    batch_type pairs{};
+    //!\brief Computes the sequence pairs of the current chunk in batches.
+    batches_type batches{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,398 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_linear_memory.
+ */
+
+#pragma once
+
+#include <limits>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+#include <tuple>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
+#include <seqan3/alignment/matrix/detail/trace_path_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/range/views/slice.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the global alignment in linear memory.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * This algorithm is selected by seqan3::align_cfg::linear_memory_traceback and computes the same global alignment
+ * as seqan3::detail::pairwise_alignment_algorithm, but without storing a trace matrix. It implements the
+ * divide-and-conquer algorithm of Hirschberg with the extension to affine gap costs by Myers and Miller:
+ * the first sequence is split in the middle, a forward pass over the first half and a pass over the reversed
+ * second half compute the last column of the respective score matrices, and the cell in which an optimal alignment
+ * crosses the middle symbol is determined from these two columns. Both sub-problems are then solved recursively
+ * until the first sequence is empty. The trace directions are thereby emitted in order and collected in a
+ * seqan3::detail::trace_path_linear_memory, which replaces the trace matrix when the result is built.
+ *
+ * The algorithm requires the gap recursion policy seqan3::detail::policy_affine_gap_recursion, a scoring scheme
+ * policy and the seqan3::detail::policy_alignment_result_builder. The passes reuse the recursion of the gap policy
+ * on two seqan3::detail::score_matrix_single_column instances.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_linear_memory : protected policies_t...
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The score matrix used for the forward and the reverse pass.
+    using score_matrix_type = score_matrix_single_column<score_type>;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global && !traits_type::is_vectorised && !traits_type::is_banded,
+                  "The linear memory alignment only supports the scalar and unbanded global alignment.");
+
+    //!\brief The bounds of a sub-problem of the divide-and-conquer recursion.
+    struct sub_problem
+    {
+        //!\brief The begin position within the first sequence.
+        size_t sequence1_begin{};
+        //!\brief The end position within the first sequence.
+        size_t sequence1_end{};
+        //!\brief The begin position within the second sequence.
+        size_t sequence2_begin{};
+        //!\brief The end position within the second sequence.
+        size_t sequence2_end{};
+        //!\brief Whether a gap in the second sequence at the begin continues an already opened gap.
+        bool leading_gap_is_open{};
+        //!\brief Whether a gap in the second sequence at the end continues into an already opened gap.
+        bool trailing_gap_is_open{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_linear_memory() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory const &) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory &&) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory & operator=(pairwise_alignment_algorithm_linear_memory const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory & operator=(pairwise_alignment_algorithm_linear_memory &&) = default;
+    //!< Defaulted.
+    ~pairwise_alignment_algorithm_linear_memory() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm.
+     */
+    pairwise_alignment_algorithm_linear_memory(alignment_configuration_t const & config) : policies_t(config)...
+    {}
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the score columns.
+     *
+     * \details
+     *
+     * Computes the global alignment for every sequence pair in linear memory and invokes the given callback with the
+     * respective alignment result. The sequences must model std::ranges::random_access_range and
+     * std::ranges::sized_range, since the recursion accesses arbitrary and reversed slices of them.
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee. Might throw std::bad_alloc.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence and `m` be the length of the second sequence.
+     * Every cell is computed roughly twice, such that the runtime is in \f$ O(n*m) \f$, while the space is in
+     * \f$ O(n+m) \f$ compared to \f$ O(n*m) \f$ for the alignment with a full trace matrix.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            trace_path_linear_memory & trace_path = std::get<2>(acquire_buffers());
+            trace_path.clear();
+
+            score_type const score = compute_alignment(get<0>(sequence_pair),
+                                                       get<1>(sequence_pair),
+                                                       sub_problem{0u, sequence1_size, 0u, sequence2_size});
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         score,
+                                         matrix_coordinate{row_index_type{sequence2_size},
+                                                           column_index_type{sequence1_size}},
+                                         trace_path,
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Acquires the thread local score matrices for both passes and the buffer for the trace path.
+     * \returns A std::tuple storing lvalue references to the forward and reverse score matrix and the trace path.
+     */
+    static auto acquire_buffers()
+    {
+        static thread_local score_matrix_type forward_matrix{};
+        static thread_local score_matrix_type reverse_matrix{};
+        static thread_local trace_path_linear_memory trace_path{};
+
+        return std::tie(forward_matrix, reverse_matrix, trace_path);
+    }
+
+    /*!\brief Computes the optimal alignment of the given sub-problem and appends its trace to the trace path.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] problem The bounds of the sub-problem within both sequences.
+     *
+     * \returns The optimal score of the sub-problem.
+     *
+     * \details
+     *
+     * A horizontal gap, i.e. a gap in the second sequence, that begins at the start of the sub-problem does not pay
+     * the gap open costs if `problem.leading_gap_is_open` is set; the same holds for a horizontal gap at the end if
+     * `problem.trailing_gap_is_open` is set.
+     * Thereby, a gap that crosses the middle of the first sequence opens exactly once when the sub-problems are
+     * solved independently.
+     */
+    template <std::ranges::viewable_range sequence1_t, std::ranges::viewable_range sequence2_t>
+    score_type compute_alignment(sequence1_t && sequence1, sequence2_t && sequence2, sub_problem const & problem)
+    {
+        static_assert(std::ranges::random_access_range<sequence1_t> && std::ranges::sized_range<sequence1_t> &&
+                      std::ranges::random_access_range<sequence2_t> && std::ranges::sized_range<sequence2_t>,
+                      "The linear memory alignment requires sized random access sequences.");
+
+        auto && [forward_matrix, reverse_matrix, trace_path] = acquire_buffers();
+
+        size_t const sequence1_size = problem.sequence1_end - problem.sequence1_begin;
+        size_t const sequence2_size = problem.sequence2_end - problem.sequence2_begin;
+
+        // ---------------------------------------------------------------------
+        // Base cases: one of the sequences is empty.
+        // ---------------------------------------------------------------------
+
+        if (sequence1_size == 0)
+        {
+            trace_path.append(trace_directions::up, sequence2_size);
+            return (sequence2_size == 0) ? score_type{}
+                                         : this->gap_open_score +
+                                           static_cast<score_type>(sequence2_size - 1) * this->gap_extension_score;
+        }
+
+        if (sequence2_size == 0)
+        {
+            trace_path.append(trace_directions::left, sequence1_size);
+            score_type const first_gap_score = (problem.leading_gap_is_open || problem.trailing_gap_is_open)
+                                             ? this->gap_extension_score
+                                             : this->gap_open_score;
+            return first_gap_score + static_cast<score_type>(sequence1_size - 1) * this->gap_extension_score;
+        }
+
+        // ---------------------------------------------------------------------
+        // Divide phase: compute the last columns of the forward and reverse pass.
+        // ---------------------------------------------------------------------
+
+        size_t const middle = problem.sequence1_begin + sequence1_size / 2;
+        auto sequence2_slice = sequence2 | views::slice(problem.sequence2_begin, problem.sequence2_end);
+
+        compute_last_column(sequence1 | views::slice(problem.sequence1_begin, middle),
+                            sequence2_slice,
+                            forward_matrix,
+                            problem.leading_gap_is_open);
+        compute_last_column(sequence1 | views::slice(middle + 1, problem.sequence1_end) | std::views::reverse,
+                            sequence2_slice | std::views::reverse,
+                            reverse_matrix,
+                            problem.trailing_gap_is_open);
+
+        // ---------------------------------------------------------------------
+        // Split phase: find the row in which an optimal alignment crosses the middle symbol of sequence1.
+        // ---------------------------------------------------------------------
+
+        // The row i of the forward column corresponds to the row sequence2_size - i of the reverse column.
+        auto forward_column = *forward_matrix.begin();
+        auto reverse_column = *reverse_matrix.begin();
+        auto forward_column_it = forward_column.begin();
+        auto reverse_column_it = std::ranges::next(reverse_column.begin(), sequence2_size);
+        auto sequence2_it = std::ranges::begin(sequence2_slice);
+        auto && middle_symbol = *std::ranges::next(std::ranges::begin(sequence1), middle);
+
+        score_type optimal_score = std::numeric_limits<score_type>::lowest();
+        size_t split_row = 0;
+        bool crosses_diagonal = false;
+
+        for (size_t row = 0; ; ++row)
+        {
+            auto forward_cell = *forward_column_it;
+            // Both horizontal scores account for the gap in the middle column, so its opening is counted twice.
+            score_type const horizontal_score = forward_cell.horizontal_score() +
+                                                (*reverse_column_it).horizontal_score() -
+                                                this->gap_open_score;
+            if (horizontal_score > optimal_score)
+            {
+                optimal_score = horizontal_score;
+                split_row = row;
+                crosses_diagonal = false;
+            }
+
+            if (row == sequence2_size)
+                break;
+
+            score_type const diagonal_score = forward_cell.best_score() +
+                                              this->scoring_scheme.score(middle_symbol, *sequence2_it) +
+                                              (*--reverse_column_it).best_score();
+            if (diagonal_score > optimal_score)
+            {
+                optimal_score = diagonal_score;
+                split_row = row;
+                crosses_diagonal = true;
+            }
+
+            ++forward_column_it;
+            ++sequence2_it;
+        }
+
+        // ---------------------------------------------------------------------
+        // Conquer phase: solve both sub-problems and emit the trace of the middle symbol in between.
+        // ---------------------------------------------------------------------
+
+        size_t const split_position = problem.sequence2_begin + split_row;
+
+        compute_alignment(sequence1, sequence2, sub_problem{problem.sequence1_begin,
+                                                            middle,
+                                                            problem.sequence2_begin,
+                                                            split_position,
+                                                            problem.leading_gap_is_open,
+                                                            !crosses_diagonal});
+
+        trace_path.append(crosses_diagonal ? trace_directions::diagonal : trace_directions::left);
+
+        compute_alignment(sequence1, sequence2, sub_problem{middle + 1,
+                                                            problem.sequence1_end,
+                                                            split_position + crosses_diagonal,
+                                                            problem.sequence2_end,
+                                                            !crosses_diagonal,
+                                                            problem.trailing_gap_is_open});
+
+        return optimal_score;
+    }
+
+    /*!\brief Computes the score matrix for the given sequences and keeps only its last column.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in,out] score_matrix The score matrix to compute.
+     * \param[in] leading_gap_is_open Whether a gap in the first row continues an already opened gap.
+     *
+     * \details
+     *
+     * After the computation the single column of the score matrix stores the optimal scores and the horizontal gap
+     * scores of the last column of the alignment matrix.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    void compute_last_column(sequence1_t && sequence1,
+                             sequence2_t && sequence2,
+                             score_matrix_type & score_matrix,
+                             bool const leading_gap_is_open)
+    {
+        score_matrix.resize(column_index_type{static_cast<size_t>(std::ranges::distance(sequence1)) + 1},
+                            row_index_type{static_cast<size_t>(std::ranges::distance(sequence2)) + 1});
+
+        // ---------------------------------------------------------------------
+        // Initialisation phase: initialise the first column.
+        // ---------------------------------------------------------------------
+
+        auto score_matrix_it = score_matrix.begin();
+        auto first_column = *score_matrix_it;
+        auto first_column_it = first_column.begin();
+
+        auto origin_cell = this->initialise_origin_cell();
+        if (leading_gap_is_open)
+            origin_cell.horizontal_score() = this->gap_extension_score;
+
+        *first_column_it = origin_cell;
+
+        for ([[maybe_unused]] auto const & unused : sequence2)
+        {
+            ++first_column_it;
+            *first_column_it = this->initialise_first_column_cell(*first_column_it);
+        }
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute column-wise the alignment matrix.
+        // ---------------------------------------------------------------------
+
+        for (auto const & alphabet1 : sequence1)
+        {
+            auto column = *++score_matrix_it;
+            auto column_it = column.begin();
+
+            auto cell = *column_it;
+            score_type diagonal = cell.best_score();
+            *column_it = this->initialise_first_row_cell(cell);
+
+            for (auto const & alphabet2 : sequence2)
+            {
+                auto cell = *++column_it;
+                score_type next_diagonal = cell.best_score();
+                *column_it = this->compute_inner_cell(diagonal, cell, this->scoring_scheme.score(alphabet1, alphabet2));
+                diagonal = next_diagonal;
+            }
+        }
+    }
+};
+
+} // namespace seqan3::detail
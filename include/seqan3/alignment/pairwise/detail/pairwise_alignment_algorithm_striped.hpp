@@ -0,0 +1,534 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_striped.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute a single pairwise alignment with the striped vectorisation.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ *
+ * \details
+ *
+ * Implements the intra-sequence vectorisation of Farrar (Bioinformatics, 2007) for the global and the local alignment
+ * with affine gap costs. The second sequence, which is mapped to the rows of the alignment matrix, is divided into
+ * `L` segments of length `s = ceil(m / L)`, where `L` is the number of lanes of the simd vector and `m` the size of
+ * the second sequence. The `k`-th simd vector of a column stores the cells of the rows `k`, `s + k`, ..., `(L-1)s + k`,
+ * such that the cells within one simd vector do not depend on each other, except for the vertical gap. The vertical
+ * gaps are first computed within each segment and afterwards propagated over the segment borders in a lazy loop which
+ * terminates as soon as the vertical gap can no longer improve any cell.
+ *
+ * The substitution scores are looked up from a query profile that is computed once for every sequence pair from the
+ * configured scalar scoring scheme. It stores for every symbol of the alphabet of the first sequence the scores
+ * against the second sequence in the striped layout. If a seqan3::query_profile was configured with
+ * seqan3::align_cfg::query_profile, it is used instead for every sequence pair whose second sequence is the query of
+ * the profile.
+ *
+ * The algorithm only keeps a single column of the alignment matrix in memory and reports the score and the end
+ * positions of the optimal alignment.
+ */
+template <typename alignment_configuration_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_striped :
+    protected policy_alignment_result_builder<alignment_configuration_t>
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured scalar score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The simd vector type used to compute the striped columns.
+    using simd_score_type = simd_type_t<score_type>;
+    //!\brief The configured scoring scheme type.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of a striped column.
+    using simd_column_type = std::vector<simd_score_type, aligned_allocator<simd_score_type, alignof(simd_score_type)>>;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(!traits_type::requires_trace_information,
+                  "The striped alignment does not compute the begin positions or the alignment.");
+
+    //!\brief Helper function to determine the pointer type of the precomputed query profile.
+    static constexpr auto determine_query_profile_pointer_type() noexcept
+    {
+        if constexpr (traits_type::has_query_profile)
+            return decltype(get<align_cfg::query_profile>(std::declval<alignment_configuration_t>()).profile){};
+        else
+            return static_cast<empty_type const *>(nullptr);
+    }
+
+    //!\brief The pointer type of the precomputed query profile; points to seqan3::detail::empty_type if not configured.
+    using query_profile_pointer_type = decltype(determine_query_profile_pointer_type());
+
+    //!\brief The number of lanes of the simd vector.
+    static constexpr size_t lane_count = simd_traits<simd_score_type>::length;
+    //!\brief The value used as negative infinity; leaves enough space to add gap scores without an underflow.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+
+    //!\brief The scalar scoring scheme used to compute the query profile.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The score for extending a gap.
+    score_type gap_extension_score{};
+    //!\brief The score for opening a gap including the score for extending it.
+    score_type gap_open_score{};
+    //!\brief The precomputed query profile, if configured.
+    query_profile_pointer_type precomputed_query_profile{nullptr};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_striped() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped const &) = default;
+    //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped &&) = default;
+    //!< Defaulted.
+    ~pairwise_alignment_algorithm_striped() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the scoring scheme, the gap scores and the precomputed query profile from the given configuration.
+     */
+    pairwise_alignment_algorithm_striped(alignment_configuration_t const & config) :
+        policy_alignment_result_builder<alignment_configuration_t>{config}
+    {
+        scoring_scheme = get<align_cfg::scoring_scheme>(config).scheme;
+
+        auto const & selected_gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                                    align_cfg::extension_score{-1}});
+        gap_extension_score = static_cast<score_type>(selected_gap_scheme.extension_score);
+        gap_open_score = static_cast<score_type>(selected_gap_scheme.open_score) + gap_extension_score;
+
+        if constexpr (traits_type::has_query_profile)
+            precomputed_query_profile = get<align_cfg::query_profile>(config).profile;
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the query profile or the alignment columns.
+     *
+     * \details
+     *
+     * Every sequence pair is computed separately using all lanes of the simd vector.
+     * For every computed alignment the given callback is invoked with the respective alignment result.
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee. Might throw std::bad_alloc.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence, `L` the number of lanes
+     * of the simd vector and `σ` the size of the alphabet of the first sequence. The runtime is in \f$ O(n*m/L) \f$
+     * in the best case and in \f$ O(n*m) \f$ in the worst case, in which the lazy loop has to propagate the vertical
+     * gaps over all segments in every column. The space consumption is in \f$ O(σ*m) \f$ for the query profile.
+     * If a precomputed query profile is used, the query profile is not computed, which saves \f$ O(σ*m) \f$ time per
+     * sequence pair.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            auto [optimal_score, optimal_coordinate] = compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair));
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         std::move(optimal_score),
+                                         std::move(optimal_coordinate),
+                                         empty_type{}, // The striped alignment does not store an alignment matrix.
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Computes the striped alignment matrix column by column.
+     * \tparam sequence1_t The type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     *
+     * \param[in] sequence1 The first sequence mapped to the columns of the alignment matrix.
+     * \param[in] sequence2 The second sequence mapped to the rows of the alignment matrix.
+     *
+     * \returns A pair with the optimal score and the matrix coordinate of the optimal score.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    std::pair<score_type, matrix_coordinate> compute_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        size_t const sequence1_size = std::ranges::distance(sequence1);
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+
+        // An empty second sequence has no rows to vectorise.
+        if (sequence2_size == 0)
+        {
+            if constexpr (traits_type::is_local)
+            {
+                return {score_type{}, matrix_coordinate{row_index_type{0u}, column_index_type{0u}}};
+            }
+            else
+            {
+                score_type score = (sequence1_size == 0)
+                                 ? score_type{}
+                                 : gap_open_score + static_cast<score_type>(sequence1_size - 1) * gap_extension_score;
+                return {score, matrix_coordinate{row_index_type{0u}, column_index_type{sequence1_size}}};
+            }
+        }
+
+        size_t const segment_length = (sequence2_size + lane_count - 1) / lane_count;
+
+        simd_score_type const * const query_profile_data =
+            select_query_profile<std::ranges::range_value_t<sequence1_t>>(sequence2, segment_length);
+
+        // ----------------------------------------------------------------------------
+        // Initialise the first column.
+        // ----------------------------------------------------------------------------
+
+        simd_score_type const simd_gap_open = simd::fill<simd_score_type>(gap_open_score);
+        simd_score_type const simd_gap_extension = simd::fill<simd_score_type>(gap_extension_score);
+        simd_score_type const simd_minus_infinity = simd::fill<simd_score_type>(minus_infinity);
+
+        current_column.resize(segment_length);
+        next_column.resize(segment_length);
+        horizontal_column.resize(segment_length);
+
+        for (size_t k = 0; k < segment_length; ++k)
+        {
+            if constexpr (traits_type::is_local)
+            {
+                current_column[k] = simd::fill<simd_score_type>(0);
+            }
+            else
+            {
+                for (size_t lane = 0; lane < lane_count; ++lane)
+                    current_column[k][lane] = gap_open_score +
+                                              static_cast<score_type>(lane * segment_length + k) * gap_extension_score;
+            }
+
+            horizontal_column[k] = current_column[k] + simd_gap_open;
+        }
+
+        score_type optimal_score{};
+        simd_score_type simd_optimal_score = simd::fill<simd_score_type>(0);
+        matrix_coordinate optimal_coordinate{row_index_type{0u}, column_index_type{0u}};
+
+        // ----------------------------------------------------------------------------
+        // Compute the columns.
+        // ----------------------------------------------------------------------------
+
+        size_t column_index = 1;
+        for (auto const & symbol1 : sequence1)
+        {
+            simd_score_type const * profile = query_profile_data + to_rank(symbol1) * segment_length;
+
+            // The first cell of the column before and of the current column.
+            score_type const first_cell_previous = first_row_score(column_index - 1);
+            score_type const first_cell_current = first_row_score(column_index);
+
+            // The diagonal of the first cell in a segment is the last cell of the previous segment.
+            simd_score_type diagonal = shift_into_first_lane(current_column[segment_length - 1], first_cell_previous);
+            simd_score_type vertical = simd_minus_infinity;
+            vertical[0] = first_cell_current + gap_open_score;
+            simd_score_type column_maximum = simd::fill<simd_score_type>(0);
+
+            for (size_t k = 0; k < segment_length; ++k)
+            {
+                simd_score_type best = diagonal + profile[k];
+                best = max(best, horizontal_column[k]);
+                best = max(best, vertical);
+
+                if constexpr (traits_type::is_local)
+                {
+                    best = max(best, simd::fill<simd_score_type>(0));
+                    column_maximum = max(column_maximum, best);
+                }
+
+                diagonal = current_column[k];
+                next_column[k] = best;
+
+                simd_score_type const open = best + simd_gap_open;
+                horizontal_column[k] = max(horizontal_column[k] + simd_gap_extension, open);
+                vertical = max(vertical + simd_gap_extension, open);
+            }
+
+            // Lazy loop: propagate the vertical gaps over the segment borders.
+            for (size_t pass = 0; pass < lane_count; ++pass)
+            {
+                vertical = shift_into_first_lane(vertical, minus_infinity);
+
+                bool continue_propagation = true;
+                for (size_t k = 0; k < segment_length && continue_propagation; ++k)
+                {
+                    simd_score_type const best = max(next_column[k], vertical);
+                    next_column[k] = best;
+
+                    if constexpr (traits_type::is_local)
+                        column_maximum = max(column_maximum, best);
+
+                    simd_score_type const open = best + simd_gap_open;
+                    horizontal_column[k] = max(horizontal_column[k], open);
+                    vertical = max(vertical + simd_gap_extension, simd_minus_infinity);
+                    continue_propagation = any_greater(vertical, open);
+                }
+
+                if (!continue_propagation)
+                    break;
+            }
+
+            std::swap(current_column, next_column);
+
+            // Only a column that contains a new optimum is inspected further.
+            if constexpr (traits_type::is_local)
+            {
+                if (any_greater(column_maximum, simd_optimal_score))
+                {
+                    update_local_optimum(optimal_score, optimal_coordinate, column_maximum, column_index,
+                                         segment_length);
+                    simd_optimal_score = simd::fill<simd_score_type>(optimal_score);
+                }
+            }
+
+            ++column_index;
+        }
+
+        if constexpr (traits_type::is_global)
+        {
+            size_t const last_row = sequence2_size - 1;
+            optimal_score = current_column[last_row % segment_length][last_row / segment_length];
+            optimal_coordinate = matrix_coordinate{row_index_type{sequence2_size}, column_index_type{sequence1_size}};
+        }
+
+        return {optimal_score, optimal_coordinate};
+    }
+
+    /*!\brief Returns the query profile of the second sequence for every symbol of the first alphabet.
+     * \tparam alphabet1_t The alphabet type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     *
+     * \param[in] sequence2 The second sequence.
+     * \param[in] segment_length The length of one segment.
+     *
+     * \returns A pointer to the striped scores of the symbol with rank `0`; the scores of the symbol with rank `r`
+     *          begin `r * segment_length` simd vectors later.
+     *
+     * \details
+     *
+     * Returns the precomputed query profile if one was configured and the second sequence is its query. Otherwise
+     * the query profile is computed.
+     */
+    template <typename alphabet1_t, typename sequence2_t>
+    simd_score_type const * select_query_profile(sequence2_t && sequence2, size_t const segment_length)
+    {
+        if constexpr (traits_type::has_query_profile)
+        {
+            using query_profile_t = std::remove_cvref_t<std::remove_pointer_t<query_profile_pointer_type>>;
+
+            static_assert(std::same_as<typename query_profile_t::target_alphabet_type, alphabet1_t> &&
+                          std::same_as<typename query_profile_t::query_alphabet_type,
+                                       std::ranges::range_value_t<sequence2_t>>,
+                          "The alphabets of the query profile must be the alphabets of the sequences.");
+            static_assert(std::same_as<typename query_profile_t::score_type, score_type>,
+                          "The score type of the query profile must be the configured score type.");
+
+            if (precomputed_query_profile != nullptr && precomputed_query_profile->is_profile_of(sequence2))
+            {
+                assert(precomputed_query_profile->segment_length() == segment_length);
+                return precomputed_query_profile->striped_scores(assign_rank_to(0, alphabet1_t{})).data();
+            }
+        }
+
+        initialise_query_profile<alphabet1_t>(sequence2, segment_length);
+        return query_profile.data();
+    }
+
+    /*!\brief Computes the query profile of the second sequence for every symbol of the first alphabet.
+     * \tparam alphabet1_t The alphabet type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     *
+     * \param[in] sequence2 The second sequence.
+     * \param[in] segment_length The length of one segment.
+     *
+     * \details
+     *
+     * The padded cells of the last segment are scored with zero, which can never lead to a score that exceeds the
+     * optimum of the cells that belong to the alignment matrix.
+     */
+    template <typename alphabet1_t, typename sequence2_t>
+    void initialise_query_profile(sequence2_t && sequence2, size_t const segment_length)
+    {
+        constexpr size_t alphabet1_size = alphabet_size<alphabet1_t>;
+
+        query_profile.assign(alphabet1_size * segment_length, simd::fill<simd_score_type>(0));
+
+        for (size_t rank = 0; rank < alphabet1_size; ++rank)
+        {
+            alphabet1_t const symbol1 = assign_rank_to(rank, alphabet1_t{});
+            simd_score_type * profile = query_profile.data() + rank * segment_length;
+
+            size_t row = 0;
+            for (auto const & symbol2 : sequence2)
+            {
+                profile[row % segment_length][row / segment_length] = scoring_scheme.score(symbol1, symbol2);
+                ++row;
+            }
+        }
+    }
+
+    /*!\brief Updates the optimum of the local alignment with the maximum of the last computed column.
+     * \param[out] optimal_score The optimal score; must be less than the maximum of the column.
+     * \param[out] optimal_coordinate The coordinate of the optimal score.
+     * \param[in] column_maximum The cell-wise maximum of the last computed column.
+     * \param[in] column_index The index of the last computed column.
+     * \param[in] segment_length The length of one segment.
+     *
+     * \details
+     *
+     * Only called for a column that contains a new optimum, such that the first optimum in column-major order is
+     * reported. The rows of the lane `l` are `l * segment_length`, ..., `(l + 1) * segment_length - 1`. Hence, the
+     * first row that contains the maximum lies in the first lane whose maximum equals the maximum of the column and
+     * only the segment of this lane is scanned. The padded rows at the end of the last lane never contain a new
+     * optimum.
+     */
+    void update_local_optimum(score_type & optimal_score,
+                              matrix_coordinate & optimal_coordinate,
+                              simd_score_type const & column_maximum,
+                              size_t const column_index,
+                              size_t const segment_length) const noexcept
+    {
+        score_type maximum = column_maximum[0];
+        for (size_t lane = 1; lane < lane_count; ++lane)
+            maximum = std::max<score_type>(maximum, column_maximum[lane]);
+
+        assert(maximum > optimal_score);
+
+        size_t lane = 0;
+        while (column_maximum[lane] != maximum)
+            ++lane;
+
+        size_t k = 0;
+        while (current_column[k][lane] != maximum)
+            ++k;
+
+        assert(k < segment_length);
+
+        optimal_score = maximum;
+        optimal_coordinate = matrix_coordinate{row_index_type{lane * segment_length + k + 1},
+                                               column_index_type{column_index}};
+    }
+
+    /*!\brief Returns the score of the cell in the first row of the given column.
+     * \param[in] column_index The index of the column.
+     */
+    score_type first_row_score(size_t const column_index) const noexcept
+    {
+        if constexpr (traits_type::is_local)
+            return score_type{};
+        else
+            return (column_index == 0) ? score_type{}
+                                       : gap_open_score +
+                                         static_cast<score_type>(column_index - 1) * gap_extension_score;
+    }
+
+    //!\brief Shifts all lanes of the simd vector by one lane and inserts the given value into the first lane.
+    static simd_score_type shift_into_first_lane(simd_score_type const & vector, score_type const value) noexcept
+    {
+        simd_score_type result{};
+        result[0] = value;
+        for (size_t lane = 1; lane < lane_count; ++lane)
+            result[lane] = vector[lane - 1];
+
+        return result;
+    }
+
+    //!\brief Returns the lane-wise maximum of two simd vectors.
+    static simd_score_type max(simd_score_type const & lhs, simd_score_type const & rhs) noexcept
+    {
+        return (lhs > rhs) ? lhs : rhs;
+    }
+
+    //!\brief Returns whether any lane of the first simd vector is greater than the respective lane of the second one.
+    static bool any_greater(simd_score_type const & lhs, simd_score_type const & rhs) noexcept
+    {
+        auto const mask = lhs > rhs;
+        for (size_t lane = 0; lane < lane_count; ++lane)
+        {
+            if (mask[lane])
+                return true;
+        }
+
+        return false;
+    }
+
+    //!\brief The query profile of the second sequence.
+    simd_column_type query_profile{};
+    //!\brief The last computed column of the alignment matrix.
+    simd_column_type current_column{};
+    //!\brief The column of the alignment matrix that is currently computed.
+    simd_column_type next_column{};
+    //!\brief The scores of the horizontal gaps leaving the last computed column.
+    simd_column_type horizontal_column{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,508 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_wavefront.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_path_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the global alignment with the wavefront algorithm.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * This algorithm is selected by seqan3::align_cfg::wavefront and computes the same global alignment score as
+ * seqan3::detail::pairwise_alignment_algorithm. The scores are first converted to penalties with a match penalty of
+ * `0`: for a match score \f$a\f$, a mismatch score \f$-b\f$, a gap open score \f$-q\f$ and a gap extension score
+ * \f$-r\f$ the penalties are \f$x = 2(a + b)\f$ for a mismatch, \f$o = 2q\f$ for a gap opening and \f$e = 2r + a\f$
+ * for a gap extension. The score of a global alignment between sequences of length `n` and `m` with the penalty `p`
+ * is then \f$ (a(n + m) - p) / 2\f$ (Eizenga and Paten, 2022).
+ *
+ * For every penalty `s` and every diagonal `k` the wavefront stores the furthest column that is reachable with
+ * penalty `s` on diagonal `k` for the match, the insertion and the deletion state. A wavefront is computed from the
+ * wavefronts of the penalties `s - x`, `s - o - e` and `s - e` and afterwards extended along the diagonals as long
+ * as the symbols match. The computation stops as soon as the last cell of the alignment matrix is reached. All
+ * wavefronts are kept to trace back the alignment, which is stored in a seqan3::detail::trace_path_linear_memory
+ * and passed to the seqan3::detail::policy_alignment_result_builder in place of the trace matrix.
+ *
+ * The algorithm requires a scoring scheme policy and the seqan3::detail::policy_alignment_result_builder.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_wavefront : protected policies_t...
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global && !traits_type::is_vectorised && !traits_type::is_banded,
+                  "The wavefront alignment only supports the scalar and unbanded global alignment.");
+
+    //!\brief The offset used for cells that cannot be reached with the penalty of the wavefront.
+    static constexpr int32_t invalid_offset = std::numeric_limits<int32_t>::lowest() / 2;
+
+    //!\brief The wavefront of a single penalty storing the furthest reaching offsets of each state per diagonal.
+    struct wavefront
+    {
+        //!\brief The lowest diagonal of this wavefront.
+        int32_t lowest_diagonal{0};
+        //!\brief The highest diagonal of this wavefront; the wavefront is empty if lower than the lowest diagonal.
+        int32_t highest_diagonal{-1};
+        //!\brief The offsets of the match state.
+        std::vector<int32_t> matches{};
+        //!\brief The offsets of the insertion state, i.e. of a gap in the second sequence.
+        std::vector<int32_t> insertions{};
+        //!\brief The offsets of the deletion state, i.e. of a gap in the first sequence.
+        std::vector<int32_t> deletions{};
+
+        //!\brief Resets the wavefront to the given diagonals and invalidates all offsets.
+        void reset(int32_t const lowest, int32_t const highest)
+        {
+            lowest_diagonal = lowest;
+            highest_diagonal = highest;
+            size_t const width = (highest < lowest) ? 0 : highest - lowest + 1;
+            matches.assign(width, invalid_offset);
+            insertions.assign(width, invalid_offset);
+            deletions.assign(width, invalid_offset);
+        }
+
+        //!\brief Returns the offset of the given state and diagonal or seqan3::detail::invalid_offset.
+        int32_t at(std::vector<int32_t> const & state, int32_t const diagonal) const noexcept
+        {
+            return (diagonal < lowest_diagonal || diagonal > highest_diagonal) ? invalid_offset
+                                                                             : state[diagonal - lowest_diagonal];
+        }
+    };
+
+    //!\brief The states of the traceback.
+    enum struct trace_state : uint8_t
+    {
+        match,     //!< The match state.
+        insertion, //!< The insertion state.
+        deletion   //!< The deletion state.
+    };
+
+    //!\brief The match score.
+    int32_t match_score{};
+    //!\brief The mismatch penalty.
+    int32_t mismatch_penalty{};
+    //!\brief The penalty for opening a gap including the gap extension penalty.
+    int32_t gap_open_penalty{};
+    //!\brief The penalty for extending a gap.
+    int32_t gap_extension_penalty{};
+    //!\brief The common factor of all penalties, which is divided out to skip empty wavefronts.
+    int32_t penalty_factor{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_wavefront() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront &&) = default; //!< Defaulted.
+    //!\brief Defaulted.
+    pairwise_alignment_algorithm_wavefront & operator=(pairwise_alignment_algorithm_wavefront const &) = default;
+    //!\brief Defaulted.
+    pairwise_alignment_algorithm_wavefront & operator=(pairwise_alignment_algorithm_wavefront &&) = default;
+    ~pairwise_alignment_algorithm_wavefront() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the scoring scheme has more than one match or mismatch
+     *         score or if the scores cannot be converted to valid penalties.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and converts the scores to penalties.
+     */
+    pairwise_alignment_algorithm_wavefront(alignment_configuration_t const & config) : policies_t(config)...
+    {
+        initialise_penalties(config);
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the wavefronts.
+     *
+     * \details
+     *
+     * Computes the global alignment for every sequence pair with the wavefront algorithm and invokes the given
+     * callback with the respective alignment result. The sequences must model std::ranges::random_access_range and
+     * std::ranges::sized_range.
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee. Might throw std::bad_alloc.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `s` be the penalty
+     * of the optimal alignment. The runtime is in \f$ O((n+m) * s) \f$ and the space is in \f$ O(s^2) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            auto && sequence1 = get<0>(sequence_pair);
+            auto && sequence2 = get<1>(sequence_pair);
+
+            static_assert(std::ranges::random_access_range<decltype(sequence1)> &&
+                          std::ranges::sized_range<decltype(sequence1)> &&
+                          std::ranges::random_access_range<decltype(sequence2)> &&
+                          std::ranges::sized_range<decltype(sequence2)>,
+                          "The wavefront alignment requires sized random access sequences.");
+
+            size_t const sequence1_size = std::ranges::size(sequence1);
+            size_t const sequence2_size = std::ranges::size(sequence2);
+
+            assert(sequence1_size < static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+            assert(sequence2_size < static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+
+            trace_path_linear_memory & trace_path = std::get<1>(acquire_buffers());
+            trace_path.clear();
+
+            int32_t const penalty = compute_wavefronts(sequence1, sequence2);
+
+            if constexpr (traits_type::requires_trace_information)
+                compute_trace(penalty, sequence1_size, sequence2_size);
+
+            int64_t const score = (static_cast<int64_t>(match_score) * (sequence1_size + sequence2_size) -
+                                   static_cast<int64_t>(penalty_factor) * penalty) / 2;
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         static_cast<score_type>(score),
+                                         matrix_coordinate{row_index_type{sequence2_size},
+                                                           column_index_type{sequence1_size}},
+                                         trace_path,
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Acquires the thread local wavefronts and the buffers for the trace path.
+     * \returns A std::tuple storing lvalue references to the wavefronts, the trace path and the reversed trace.
+     */
+    static auto acquire_buffers()
+    {
+        static thread_local std::vector<wavefront> wavefronts{};
+        static thread_local trace_path_linear_memory trace_path{};
+        static thread_local std::vector<trace_directions> reversed_trace{};
+
+        return std::tie(wavefronts, trace_path, reversed_trace);
+    }
+
+    /*!\brief Converts the scores of the configuration to the penalties of the wavefront algorithm.
+     * \param[in] config The alignment configuration.
+     * \throws seqan3::invalid_alignment_configuration if the scores cannot be converted.
+     */
+    void initialise_penalties(alignment_configuration_t const & config)
+    {
+        using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
+        // The conversion requires one match score and one mismatch score for all symbols.
+        match_score = this->scoring_scheme.score(assign_rank_to(0, alphabet_t{}), assign_rank_to(0, alphabet_t{}));
+        int32_t mismatch_score = (alphabet_size<alphabet_t> > 1)
+                               ? this->scoring_scheme.score(assign_rank_to(0, alphabet_t{}),
+                                                            assign_rank_to(1, alphabet_t{}))
+                               : match_score - 1;
+
+        for (size_t lhs_rank = 0; lhs_rank < alphabet_size<alphabet_t>; ++lhs_rank)
+        {
+            for (size_t rhs_rank = 0; rhs_rank < alphabet_size<alphabet_t>; ++rhs_rank)
+            {
+                int32_t const score = this->scoring_scheme.score(assign_rank_to(lhs_rank, alphabet_t{}),
+                                                                 assign_rank_to(rhs_rank, alphabet_t{}));
+                if (score != ((lhs_rank == rhs_rank) ? match_score : mismatch_score))
+                    throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a scoring "
+                                                          "scheme with a single match and a single mismatch score."};
+            }
+        }
+
+        auto const & gap_cost = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                         align_cfg::extension_score{-1}});
+
+        mismatch_penalty = 2 * (match_score - mismatch_score);
+        gap_open_penalty = -2 * gap_cost.open_score;
+        gap_extension_penalty = -2 * gap_cost.extension_score + match_score;
+
+        if (match_score < 0 || mismatch_penalty <= 0 || gap_open_penalty < 0 || gap_extension_penalty <= 0)
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a non-negative "
+                                                  "match score that is larger than the mismatch score and gap scores "
+                                                  "that penalise every gap."};
+
+        // Dividing out the common factor avoids computing wavefronts for penalties that no alignment can have.
+        penalty_factor = std::gcd(std::gcd(mismatch_penalty, gap_extension_penalty), gap_open_penalty);
+        mismatch_penalty /= penalty_factor;
+        gap_extension_penalty /= penalty_factor;
+        gap_open_penalty = gap_open_penalty / penalty_factor + gap_extension_penalty;
+    }
+
+    /*!\brief Returns the wavefront of the given penalty or an empty wavefront if the penalty is negative.
+     * \param[in] wavefronts The computed wavefronts.
+     * \param[in] penalty The penalty of the requested wavefront.
+     */
+    static wavefront const & wavefront_at(std::vector<wavefront> const & wavefronts, int32_t const penalty) noexcept
+    {
+        static wavefront const empty_wavefront{};
+        return (penalty < 0) ? empty_wavefront : wavefronts[penalty];
+    }
+
+    /*!\brief Computes the wavefronts until the last cell of the alignment matrix is reached.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns The penalty of the optimal global alignment.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    int32_t compute_wavefronts(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        std::vector<wavefront> & wavefronts = std::get<0>(acquire_buffers());
+
+        int32_t const sequence1_size = std::ranges::size(sequence1);
+        int32_t const sequence2_size = std::ranges::size(sequence2);
+        int32_t const last_diagonal = sequence1_size - sequence2_size;
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        // A cell is valid if it lies within the alignment matrix.
+        auto is_valid = [&] (int32_t const offset, int32_t const diagonal)
+        {
+            return offset >= 0 && offset >= diagonal &&
+                   offset <= sequence1_size && offset - diagonal <= sequence2_size;
+        };
+
+        for (int32_t penalty = 0; ; ++penalty)
+        {
+            if (wavefronts.size() <= static_cast<size_t>(penalty))
+                wavefronts.emplace_back();
+
+            wavefront & current = wavefronts[penalty];
+
+            // ---------------------------------------------------------------------
+            // Compute the wavefront from the wavefronts with lower penalties.
+            // ---------------------------------------------------------------------
+
+            if (penalty == 0)
+            {
+                current.reset(0, 0);
+                current.matches[0] = 0;
+            }
+            else
+            {
+                wavefront const & mismatch_source = wavefront_at(wavefronts, penalty - mismatch_penalty);
+                wavefront const & open_source = wavefront_at(wavefronts, penalty - gap_open_penalty);
+                wavefront const & extension_source = wavefront_at(wavefronts, penalty - gap_extension_penalty);
+
+                int32_t lowest = std::numeric_limits<int32_t>::max();
+                int32_t highest = std::numeric_limits<int32_t>::lowest();
+                auto widen = [&] (wavefront const & source, int32_t const shift)
+                {
+                    if (source.lowest_diagonal <= source.highest_diagonal)
+                    {
+                        lowest = std::min(lowest, source.lowest_diagonal - shift);
+                        highest = std::max(highest, source.highest_diagonal + shift);
+                    }
+                };
+
+                widen(mismatch_source, 0);
+                widen(open_source, 1);
+                widen(extension_source, 1);
+
+                current.reset(std::max(lowest, -sequence2_size), std::min(highest, sequence1_size));
+
+                for (int32_t diagonal = current.lowest_diagonal; diagonal <= current.highest_diagonal; ++diagonal)
+                {
+                    int32_t insertion = std::max(open_source.at(open_source.matches, diagonal - 1),
+                                                 extension_source.at(extension_source.insertions, diagonal - 1)) + 1;
+                    int32_t deletion = std::max(open_source.at(open_source.matches, diagonal + 1),
+                                                extension_source.at(extension_source.deletions, diagonal + 1));
+                    int32_t mismatch = mismatch_source.at(mismatch_source.matches, diagonal) + 1;
+
+                    insertion = is_valid(insertion, diagonal) ? insertion : invalid_offset;
+                    deletion = is_valid(deletion, diagonal) ? deletion : invalid_offset;
+                    mismatch = is_valid(mismatch, diagonal) ? mismatch : invalid_offset;
+
+                    size_t const index = diagonal - current.lowest_diagonal;
+                    current.insertions[index] = insertion;
+                    current.deletions[index] = deletion;
+                    current.matches[index] = std::max({mismatch, insertion, deletion});
+                }
+            }
+
+            // ---------------------------------------------------------------------
+            // Extend the match state along the diagonals.
+            // ---------------------------------------------------------------------
+
+            for (int32_t diagonal = current.lowest_diagonal; diagonal <= current.highest_diagonal; ++diagonal)
+            {
+                int32_t & offset = current.matches[diagonal - current.lowest_diagonal];
+                if (offset < 0)
+                    continue;
+
+                while (offset < sequence1_size && offset - diagonal < sequence2_size &&
+                       this->scoring_scheme.score(sequence1_it[offset], sequence2_it[offset - diagonal]) == match_score)
+                {
+                    ++offset;
+                }
+            }
+
+            if (current.at(current.matches, last_diagonal) == sequence1_size)
+                return penalty;
+        }
+    }
+
+    /*!\brief Traces back the optimal alignment from the computed wavefronts.
+     * \param[in] penalty The penalty of the optimal alignment.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     *
+     * \details
+     *
+     * Starts in the match state of the last cell and follows the wavefront states back to the origin of the alignment
+     * matrix. The trace directions are collected in reverse order and finally stored in the trace path.
+     */
+    void compute_trace(int32_t penalty, size_t const sequence1_size, size_t const sequence2_size)
+    {
+        auto && [wavefronts, trace_path, reversed_trace] = acquire_buffers();
+        reversed_trace.clear();
+
+        int32_t diagonal = static_cast<int32_t>(sequence1_size) - static_cast<int32_t>(sequence2_size);
+        int32_t offset = sequence1_size;
+        trace_state state = trace_state::match;
+
+        auto is_valid = [&] (int32_t const cell_offset, int32_t const cell_diagonal)
+        {
+            return cell_offset >= 0 && cell_offset >= cell_diagonal &&
+                   cell_offset <= static_cast<int32_t>(sequence1_size) &&
+                   cell_offset - cell_diagonal <= static_cast<int32_t>(sequence2_size);
+        };
+
+        while (true)
+        {
+            if (state == trace_state::match)
+            {
+                if (penalty == 0) // The remaining cells up to the origin are matches.
+                {
+                    assert(diagonal == 0);
+                    reversed_trace.insert(reversed_trace.end(), offset, trace_directions::diagonal);
+                    break;
+                }
+
+                wavefront const & current = wavefronts[penalty];
+                wavefront const & mismatch_source = wavefront_at(wavefronts, penalty - mismatch_penalty);
+
+                int32_t mismatch = mismatch_source.at(mismatch_source.matches, diagonal) + 1;
+                mismatch = is_valid(mismatch, diagonal) ? mismatch : invalid_offset;
+                int32_t const insertion = current.at(current.insertions, diagonal);
+                int32_t const deletion = current.at(current.deletions, diagonal);
+                int32_t const origin = std::max({mismatch, insertion, deletion});
+
+                assert(origin >= 0 && origin <= offset);
+                reversed_trace.insert(reversed_trace.end(), offset - origin, trace_directions::diagonal);
+                offset = origin;
+
+                if (origin == mismatch)
+                {
+                    reversed_trace.push_back(trace_directions::diagonal);
+                    penalty -= mismatch_penalty;
+                    --offset;
+                }
+                else
+                {
+                    state = (origin == insertion) ? trace_state::insertion : trace_state::deletion;
+                }
+            }
+            else if (state == trace_state::insertion)
+            {
+                wavefront const & open_source = wavefront_at(wavefronts, penalty - gap_open_penalty);
+                bool const is_open = open_source.at(open_source.matches, diagonal - 1) + 1 == offset;
+
+                reversed_trace.push_back(trace_directions::left);
+                penalty -= is_open ? gap_open_penalty : gap_extension_penalty;
+                state = is_open ? trace_state::match : trace_state::insertion;
+                --diagonal;
+                --offset;
+            }
+            else // trace_state::deletion
+            {
+                wavefront const & open_source = wavefront_at(wavefronts, penalty - gap_open_penalty);
+                bool const is_open = open_source.at(open_source.matches, diagonal + 1) == offset;
+
+                reversed_trace.push_back(trace_directions::up);
+                penalty -= is_open ? gap_open_penalty : gap_extension_penalty;
+                state = is_open ? trace_state::match : trace_state::deletion;
+                ++diagonal;
+            }
+        }
+
+        for (auto it = reversed_trace.rbegin(); it != reversed_trace.rend(); ++it)
+            trace_path.append(*it);
+    }
+};
+
+} // namespace seqan3::detail
@@ -83,6 +83,7 @@ protected:
      * Initialises the gap open score and gap extension score for this policy.
      * If no gap cost model was provided by the user the default gap costs `-10` and `-1` are set for the gap open score
      * and the gap extension score respectively.
+     * In the local alignment the first row and the first column are always initialised with `0`.
      */
     explicit policy_affine_gap_recursion(alignment_configuration_t const & config)
     {
@@ -94,8 +95,8 @@ protected:
         gap_open_score = maybe_convert_to_simd(selected_gap_scheme.open_score) + gap_extension_score;
 
         auto method_global_config = config.get_or(align_cfg::method_global{});
-        first_row_is_free = method_global_config.free_end_gaps_sequence1_leading;
-        first_column_is_free = method_global_config.free_end_gaps_sequence2_leading;
+        first_row_is_free = method_global_config.free_end_gaps_sequence1_leading || traits_type::is_local;
+        first_column_is_free = method_global_config.free_end_gaps_sequence2_leading || traits_type::is_local;
     }
     //!\}
 
@@ -115,6 +116,8 @@ protected:
      * * \f$ H[i, j] = \max \{M[i, j - 1] + g_o, H[i, j - 1] + g_e\}\f$
      * * \f$ V[i, j] = \max \{M[i - 1, j] + g_o, V[i - 1, j] + g_e\}\f$
      * * \f$ M[i, j] = \max \{M[i - 1, j - 1] + \delta, H[i, j], V[i, j]\}\f$
+     *
+     * In the local alignment \f$ M[i, j]\f$ is additionally bounded from below by `0`.
      */
     template <typename affine_cell_t>
     affine_cell_type compute_inner_cell(score_type diagonal_score,
@@ -128,6 +131,9 @@ protected:
         diagonal_score = (diagonal_score < vertical_score) ? vertical_score : diagonal_score;
         diagonal_score = (diagonal_score < horizontal_score) ? horizontal_score : diagonal_score;
 
+        if constexpr (traits_type::is_local)
+            diagonal_score = (diagonal_score < score_type{}) ? score_type{} : diagonal_score;
+
         score_type tmp = diagonal_score + gap_open_score;
         vertical_score += gap_extension_score;
         horizontal_score += gap_extension_score;
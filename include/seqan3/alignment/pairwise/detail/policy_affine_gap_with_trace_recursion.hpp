@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
 
 namespace seqan3::detail
 {
@@ -35,7 +36,7 @@ protected:
     using typename base_t::affine_score_tuple_t;
 
     //!\brief The trace type to use.
-    using trace_type = typename traits_type::trace_type;
+    using trace_type = typename traits_type::compact_trace_type;
     //!\brief The internal tuple storing the trace directions of an affine cell.
     using affine_trace_tuple_t = std::tuple<trace_type, trace_type, trace_type>;
     //!\brief The affine cell type returned by the functions.
@@ -69,6 +70,18 @@ protected:
     affine_cell_type compute_inner_cell(score_type diagonal_score,
                                         affine_cell_t previous_cell,
                                         score_type const sequence_score) const noexcept
+    {
+        if constexpr (simd_concept<score_type>)
+            return compute_inner_cell_simd(diagonal_score, previous_cell, sequence_score);
+        else
+            return compute_inner_cell_scalar(diagonal_score, previous_cell, sequence_score);
+    }
+
+    //!\copydoc seqan3::detail::policy_affine_gap_recursion::compute_inner_cell
+    template <typename affine_cell_t>
+    affine_cell_type compute_inner_cell_scalar(score_type diagonal_score,
+                                               affine_cell_t previous_cell,
+                                               score_type const sequence_score) const noexcept
     {
         diagonal_score += sequence_score;
         score_type horizontal_score = previous_cell.horizontal_score();
@@ -82,6 +95,11 @@ protected:
                        ? (best_trace = previous_cell.horizontal_trace(), horizontal_score)
                        : (best_trace |= previous_cell.horizontal_trace(), diagonal_score);
 
+        if constexpr (traits_type::is_local)
+            diagonal_score = (diagonal_score < score_type{})
+                           ? (best_trace = trace_directions::none, score_type{})
+                           : diagonal_score;
+
         score_type tmp = diagonal_score + gap_open_score;
         vertical_score += gap_extension_score;
         horizontal_score += gap_extension_score;
@@ -101,13 +119,64 @@ protected:
                 {best_trace, next_horizontal_trace, next_vertical_trace}};
     }
 
+    /*!\copydoc seqan3::detail::policy_affine_gap_recursion::compute_inner_cell
+     *
+     * The trace directions of all alignments are computed with the same compare-and-blend approach as the scores,
+     * i.e. the masks obtained from comparing the scores select the trace directions of the respective lanes. Since
+     * the trace stores only one byte per lane, the masks are narrowed to the lane width of the trace first.
+     */
+    template <typename affine_cell_t>
+    affine_cell_type compute_inner_cell_simd(score_type diagonal_score,
+                                             affine_cell_t previous_cell,
+                                             score_type const sequence_score) const noexcept
+    {
+        diagonal_score += sequence_score;
+        score_type horizontal_score = previous_cell.horizontal_score();
+        score_type vertical_score = previous_cell.vertical_score();
+
+        auto mask = diagonal_score < vertical_score;
+        diagonal_score = (mask) ? vertical_score : diagonal_score;
+        trace_type best_trace = (to_trace_mask(mask))
+                              ? previous_cell.vertical_trace()
+                              : convert_to_trace(trace_directions::diagonal) | previous_cell.vertical_trace();
+
+        mask = diagonal_score < horizontal_score;
+        diagonal_score = (mask) ? horizontal_score : diagonal_score;
+        best_trace = (to_trace_mask(mask)) ? previous_cell.horizontal_trace()
+                                           : best_trace | previous_cell.horizontal_trace();
+
+        if constexpr (traits_type::is_local)
+        {
+            mask = diagonal_score < score_type{};
+            diagonal_score = (mask) ? score_type{} : diagonal_score;
+            best_trace = (to_trace_mask(mask)) ? convert_to_trace(trace_directions::none) : best_trace;
+        }
+
+        score_type tmp = diagonal_score + gap_open_score;
+        vertical_score += gap_extension_score;
+        horizontal_score += gap_extension_score;
+
+        // store the vertical_score and horizontal_score value in the next path
+        mask = vertical_score < tmp;
+        vertical_score = (mask) ? tmp : vertical_score;
+        trace_type next_vertical_trace = (to_trace_mask(mask)) ? convert_to_trace(trace_directions::up_open)
+                                                               : convert_to_trace(trace_directions::up);
+        mask = horizontal_score < tmp;
+        horizontal_score = (mask) ? tmp : horizontal_score;
+        trace_type next_horizontal_trace = (to_trace_mask(mask)) ? convert_to_trace(trace_directions::left_open)
+                                                                 : convert_to_trace(trace_directions::left);
+
+        return {{diagonal_score, horizontal_score, vertical_score},
+                {best_trace, next_horizontal_trace, next_vertical_trace}};
+    }
+
     //!\copydoc seqan3::detail::policy_affine_gap_recursion::initialise_origin_cell
     affine_cell_type initialise_origin_cell() const noexcept
     {
         return {base_t::initialise_origin_cell(),
-                {trace_directions::none,
-                 first_row_is_free ? trace_directions::none : trace_directions::left_open,
-                 first_column_is_free ? trace_directions::none : trace_directions::up_open}};
+                {convert_to_trace(trace_directions::none),
+                 convert_to_trace(first_row_is_free ? trace_directions::none : trace_directions::left_open),
+                 convert_to_trace(first_column_is_free ? trace_directions::none : trace_directions::up_open)}};
     }
 
     //!\copydoc seqan3::detail::policy_affine_gap_recursion::initialise_first_column_cell
@@ -116,8 +185,8 @@ protected:
     {
         return {base_t::initialise_first_column_cell(previous_cell),
                 {previous_cell.vertical_trace(),
-                 trace_directions::left_open,
-                 first_column_is_free ? trace_directions::none : trace_directions::up}};
+                 convert_to_trace(trace_directions::left_open),
+                 convert_to_trace(first_column_is_free ? trace_directions::none : trace_directions::up)}};
     }
 
     //!\copydoc seqan3::detail::policy_affine_gap_recursion::initialise_first_row_cell
@@ -126,8 +195,32 @@ protected:
     {
         return {base_t::initialise_first_row_cell(previous_cell),
                 {previous_cell.horizontal_trace(),
-                 first_row_is_free ? trace_directions::none : trace_directions::left,
-                 trace_directions::up_open}};
+                 convert_to_trace(first_row_is_free ? trace_directions::none : trace_directions::left),
+                 convert_to_trace(trace_directions::up_open)}};
+    }
+
+    /*!\brief Converts the given trace direction to the trace type.
+     * \param[in] direction The trace direction to convert.
+     * \returns The trace direction broadcasted to a simd vector if the alignment is executed in vectorised mode or
+     *          the unmodified trace direction otherwise.
+     */
+    constexpr trace_type convert_to_trace(trace_directions const direction) const noexcept
+    {
+        if constexpr (simd_concept<trace_type>)
+            return simd::fill<trace_type>(static_cast<typename simd_traits<trace_type>::scalar_type>(direction));
+        else // Return unmodified.
+            return direction;
+    }
+
+    /*!\brief Narrows the mask obtained from comparing two score vectors to the lane width of the trace type.
+     * \tparam mask_t The type of the mask; must have as many lanes as the trace type.
+     * \param[in] mask The mask to narrow.
+     * \returns The mask with one byte per lane, whose lanes are either all bits set or zero.
+     */
+    template <typename mask_t>
+    static constexpr trace_type to_trace_mask(mask_t const & mask) noexcept
+    {
+        return __builtin_convertvector(mask, trace_type);
     }
 };
 } // namespace seqan3::detail
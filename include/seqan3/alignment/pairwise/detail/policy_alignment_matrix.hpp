@@ -57,6 +57,10 @@ protected:
     int32_t lower_diagonal{};
     //!\brief The selected upper diagonal.
     int32_t upper_diagonal{};
+    //!\brief A flag indicating whether the leading gaps in the first row are free.
+    bool first_row_is_free{};
+    //!\brief A flag indicating whether the leading gaps in the first column are free.
+    bool first_column_is_free{};
     //!\brief A flag indicating whether the final gaps in the last column are free.
     bool last_column_is_free{};
     //!\brief A flag indicating whether the final gaps in the last row are free.
@@ -93,8 +97,33 @@ protected:
     {
         using seqan3::get;
 
-        auto band = config.get_or(seqan3::align_cfg::band_fixed_size{});
+        if constexpr (traits_t::is_global)
+        {
+            auto method_global_config = get<seqan3::align_cfg::method_global>(config);
+
+            first_row_is_free = method_global_config.free_end_gaps_sequence1_leading;
+            first_column_is_free = method_global_config.free_end_gaps_sequence2_leading;
+            last_row_is_free = method_global_config.free_end_gaps_sequence1_trailing;
+            last_column_is_free = method_global_config.free_end_gaps_sequence2_trailing;
+        }
+
+        select_band(config.get_or(seqan3::align_cfg::band_fixed_size{}));
+    }
+    //!\}
 
+    /*!\brief Selects the band used for the subsequent alignment computations.
+     *
+     * \param[in] band The band to select.
+     *
+     * \details
+     *
+     * Used by the banded alignment to set the band of the current sequence pair if the band is configured with
+     * seqan3::align_cfg::band_per_sequence_pair.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the given band settings are invalid.
+     */
+    void select_band(seqan3::align_cfg::band_fixed_size const & band)
+    {
         lower_diagonal = band.lower_diagonal;
         upper_diagonal = band.upper_diagonal;
 
@@ -103,13 +132,6 @@ protected:
 
         if constexpr (traits_t::is_global)
         {
-            auto method_global_config = get<seqan3::align_cfg::method_global>(config);
-
-            bool first_row_is_free = method_global_config.free_end_gaps_sequence1_leading;
-            bool first_column_is_free = method_global_config.free_end_gaps_sequence2_leading;
-
-            last_row_is_free = method_global_config.free_end_gaps_sequence1_trailing;
-            last_column_is_free = method_global_config.free_end_gaps_sequence2_trailing;
             // band starts in first column without free gaps or band starts in first row without free gaps.
             invalid_band |= (upper_diagonal < 0 && !first_column_is_free) || (lower_diagonal > 0 && !first_row_is_free);
             error_cause += " The band starts in a region without free gaps.";
@@ -120,7 +142,6 @@ protected:
                                                   std::to_string(upper_diagonal) + "] cannot be used with the current "
                                                   "alignment configuration:" + error_cause};
     }
-    //!\}
 
     /*!\brief Acquires a new thread local alignment and index matrix for the given sequence sizes.
      *
@@ -95,7 +95,7 @@ protected:
               typename alignment_matrix_t,
               typename callback_t>
     //!\cond
-        requires std::invocable<callback_t, result_type>
+        requires (!traits_type::is_vectorised) && std::invocable<callback_t, result_type>
     //!\endcond
     void make_result_and_invoke([[maybe_unused]] sequence_pair_t && sequence_pair,
                                 [[maybe_unused]] index_t && id,
@@ -105,6 +105,116 @@ protected:
                                 callback_t && callback)
     {
         using std::get;
+
+        result_type result = make_result(std::forward<index_t>(id), std::move(score), end_positions);
+
+        if constexpr (traits_type::requires_trace_information)
+        {
+            aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
+            auto aligned_sequence_result = builder(alignment_matrix.trace_path(end_positions));
+
+            if constexpr (traits_type::compute_begin_positions)
+            {
+                result.data.begin_positions.first = aligned_sequence_result.first_sequence_slice_positions.first;
+                result.data.begin_positions.second = aligned_sequence_result.second_sequence_slice_positions.first;
+            }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+                result.data.alignment = std::move(aligned_sequence_result.alignment);
+        }
+
+        callback(std::move(result));
+    }
+
+    /*!\brief Builds the seqan3::alignment_result for one alignment of the vectorised alignment and then invokes the
+     *        given callable with the result.
+     *
+     * \tparam sequence_pair_t The type of the sequence pair.
+     * \tparam id_t The type of the id.
+     * \tparam score_t The type of the score.
+     * \tparam matrix_coordinate_t The type of the matrix coordinate.
+     * \tparam alignment_matrix_t The type of the alignment matrix.
+     * \tparam callback_t The type of the callback to invoke.
+     *
+     * \param[in] sequence_pair The indexed sequence pair.
+     * \param[in] id The associated id.
+     * \param[in] score The best alignment score.
+     * \param[in] begin_positions The matrix coordinate of the begin of the best alignment.
+     * \param[in] end_positions The matrix coordinate of the best alignment score.
+     * \param[in] alignment_matrix The alignment matrix to obtain the trace back from.
+     * \param[in] lane The lane of the simd vector in which the alignment was computed.
+     * \param[in] callback The callback to invoke with the generated result.
+     *
+     * \details
+     *
+     * If only the begin positions are requested, they are determined by the alignment algorithm for all alignments of
+     * the simd batch at once and are passed to this function directly. If the alignment is requested, the trace path
+     * of the given lane is followed in the alignment matrix, which stores the trace directions of all alignments
+     * interleaved.
+     */
+    template <typename sequence_pair_t,
+              typename index_t,
+              typename score_t,
+              typename matrix_coordinate_t,
+              typename alignment_matrix_t,
+              typename callback_t>
+    //!\cond
+        requires traits_type::is_vectorised && std::invocable<callback_t, result_type>
+    //!\endcond
+    void make_result_and_invoke([[maybe_unused]] sequence_pair_t && sequence_pair,
+                                [[maybe_unused]] index_t && id,
+                                [[maybe_unused]] score_t score,
+                                [[maybe_unused]] matrix_coordinate_t begin_positions,
+                                [[maybe_unused]] matrix_coordinate_t end_positions,
+                                [[maybe_unused]] alignment_matrix_t const & alignment_matrix,
+                                [[maybe_unused]] size_t const lane,
+                                callback_t && callback)
+    {
+        using std::get;
+
+        result_type result = make_result(std::forward<index_t>(id), std::move(score), end_positions);
+
+        if constexpr (traits_type::requires_trace_information)
+        {
+            aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
+            auto aligned_sequence_result = builder(alignment_matrix.trace_path(end_positions, lane));
+
+            if constexpr (traits_type::compute_begin_positions)
+            {
+                result.data.begin_positions.first = aligned_sequence_result.first_sequence_slice_positions.first;
+                result.data.begin_positions.second = aligned_sequence_result.second_sequence_slice_positions.first;
+            }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+                result.data.alignment = std::move(aligned_sequence_result.alignment);
+        }
+        else if constexpr (traits_type::compute_begin_positions)
+        {
+            result.data.begin_positions.first = begin_positions.col;
+            result.data.begin_positions.second = begin_positions.row;
+        }
+
+        callback(std::move(result));
+    }
+
+private:
+    /*!\brief Creates the seqan3::alignment_result and sets the ids, the score and the end positions if requested.
+     *
+     * \tparam id_t The type of the id.
+     * \tparam score_t The type of the score.
+     * \tparam matrix_coordinate_t The type of the matrix coordinate.
+     *
+     * \param[in] id The associated id.
+     * \param[in] score The best alignment score.
+     * \param[in] end_positions The matrix coordinate of the best alignment score.
+     *
+     * \returns The alignment result with the ids, the score and the end positions set as requested.
+     */
+    template <typename index_t, typename score_t, typename matrix_coordinate_t>
+    result_type make_result([[maybe_unused]] index_t && id,
+                            [[maybe_unused]] score_t score,
+                            [[maybe_unused]] matrix_coordinate_t const & end_positions) const
+    {
         using invalid_t = std::nullopt_t *;
 
         result_type result{};
@@ -131,19 +241,7 @@ protected:
             result.data.end_positions.second = end_positions.row;
         }
 
-        if constexpr (traits_type::requires_trace_information)
-        {
-            aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
-            auto aligned_sequence_result = builder(alignment_matrix.trace_path(end_positions));
-
-            if constexpr (traits_type::compute_begin_positions)
-            {
-                result.data.begin_positions.first = aligned_sequence_result.first_sequence_slice_positions.first;
-                result.data.begin_positions.second = aligned_sequence_result.second_sequence_slice_positions.first;
-            }
-        }
-
-        callback(std::move(result));
+        return result;
     }
 };
 } // namespace seqan3::detail
@@ -0,0 +1,287 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::policy_dual_affine_gap_recursion.
+ */
+
+#pragma once
+
+#include <limits>
+#include <tuple>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/matrix/detail/affine_cell_proxy.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the alignment recursion function for the alignment algorithm using dual affine gap costs.
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The type of the alignment configuration.
+ *
+ * \details
+ *
+ * Implements the functions to initialise and compute the alignment matrix using the recursion formula for the
+ * dual affine (two-piece affine) gap cost model configured with seqan3::align_cfg::gap_cost_dual_affine.
+ * Each gap is scored with the better of two affine gap cost functions, such that two horizontal and two vertical
+ * gap scores are maintained per cell. The policy is used in place of seqan3::detail::policy_affine_gap_recursion and
+ * works with the scalar and the vectorised score type. It requires a score matrix whose cells model
+ * seqan3::detail::dual_affine_score_cell, e.g. seqan3::detail::score_matrix_single_column_dual_affine.
+ *
+ * \note For more information, please refer to the article describing the piecewise affine gap cost function:
+ *       GOTOH, Osamu. Optimal sequence alignment allowing for long gaps.
+ *       Bulletin of Mathematical Biology, 1990, 52. Jg., Nr. 3, S. 359-373.
+ */
+template <typename alignment_configuration_t>
+class policy_dual_affine_gap_recursion
+{
+protected:
+    //!\brief The configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured original score type.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The internal tuple storing the scores of a dual affine cell.
+    using dual_affine_score_tuple_t = std::tuple<score_type, score_type, score_type, score_type, score_type>;
+    //!\brief The dual affine cell type returned by the functions.
+    using affine_cell_type = affine_cell_proxy<dual_affine_score_tuple_t>;
+
+    //!\brief The score for a gap extension of a short gap.
+    score_type gap_extension_score{};
+    //!\brief The score for a gap opening of a short gap including the gap extension.
+    score_type gap_open_score{};
+    //!\brief The score for a gap extension of a long gap.
+    score_type long_gap_extension_score{};
+    //!\brief The score for a gap opening of a long gap including the gap extension.
+    score_type long_gap_open_score{};
+
+    //!\brief Initialisation state of the first row of the alignment.
+    bool first_row_is_free{};
+    //!\brief Initialisation state of the first column of the alignment.
+    bool first_column_is_free{};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    policy_dual_affine_gap_recursion() = default; //!< Defaulted.
+    policy_dual_affine_gap_recursion(policy_dual_affine_gap_recursion const &) = default; //!< Defaulted.
+    policy_dual_affine_gap_recursion(policy_dual_affine_gap_recursion &&) = default; //!< Defaulted.
+    policy_dual_affine_gap_recursion & operator=(policy_dual_affine_gap_recursion const &) = default; //!< Defaulted.
+    policy_dual_affine_gap_recursion & operator=(policy_dual_affine_gap_recursion &&) = default; //!< Defaulted.
+    ~policy_dual_affine_gap_recursion() = default; //!< Defaulted.
+
+    /*!\brief Construction and initialisation using the alignment configuration.
+     * \param[in] config The alignment configuration; must contain seqan3::align_cfg::gap_cost_dual_affine.
+     *
+     * \details
+     *
+     * Initialises the gap open scores and the gap extension scores of the short and the long gaps for this policy.
+     * In the local alignment the first row and the first column are always initialised with `0`.
+     */
+    explicit policy_dual_affine_gap_recursion(alignment_configuration_t const & config)
+    {
+        auto const & selected_gap_scheme = get<align_cfg::gap_cost_dual_affine>(config);
+
+        gap_extension_score = maybe_convert_to_simd(selected_gap_scheme.short_gap_cost.extension_score);
+        gap_open_score = maybe_convert_to_simd(selected_gap_scheme.short_gap_cost.open_score) + gap_extension_score;
+        long_gap_extension_score = maybe_convert_to_simd(selected_gap_scheme.long_gap_cost.extension_score);
+        long_gap_open_score = maybe_convert_to_simd(selected_gap_scheme.long_gap_cost.open_score) +
+                              long_gap_extension_score;
+
+        auto method_global_config = config.get_or(align_cfg::method_global{});
+        first_row_is_free = method_global_config.free_end_gaps_sequence1_leading || traits_type::is_local;
+        first_column_is_free = method_global_config.free_end_gaps_sequence2_leading || traits_type::is_local;
+    }
+    //!\}
+
+    /*!\brief Computes an inner cell of the alignment matrix.
+     *
+     * \tparam affine_cell_t The type of the affine cell; must be an instance of seqan3::detail::affine_cell_proxy
+     *                       over a seqan3::detail::dual_affine_score_cell.
+     *
+     * \param[in] diagonal_score The previous diagonal score, which corresponds to \f$M[i - 1, j - 1]\f$.
+     * \param[in] previous_cell The predecessor cell corresponding to the values \f$V[i - 1, j]\f$,
+     *                          \f$\tilde{V}[i - 1, j]\f$, \f$H[i, j -1]\f$ and \f$\tilde{H}[i, j -1]\f$.
+     * \param[in] sequence_score The score obtained from the scoring scheme for the current cell (\f$ \delta\f$).
+     *
+     * \returns The computed dual affine cell.
+     *
+     * \details
+     *
+     * Computes the current cell according to following recursion formula:
+     * * \f$ H[i, j] = \max \{M[i, j - 1] + g_o, H[i, j - 1] + g_e\}\f$
+     * * \f$ \tilde{H}[i, j] = \max \{M[i, j - 1] + \tilde{g}_o, \tilde{H}[i, j - 1] + \tilde{g}_e\}\f$
+     * * \f$ V[i, j] = \max \{M[i - 1, j] + g_o, V[i - 1, j] + g_e\}\f$
+     * * \f$ \tilde{V}[i, j] = \max \{M[i - 1, j] + \tilde{g}_o, \tilde{V}[i - 1, j] + \tilde{g}_e\}\f$
+     * * \f$ M[i, j] = \max \{M[i - 1, j - 1] + \delta, H[i, j], \tilde{H}[i, j], V[i, j], \tilde{V}[i, j]\}\f$
+     *
+     * In the local alignment \f$ M[i, j]\f$ is additionally bounded from below by `0`.
+     */
+    template <typename affine_cell_t>
+    affine_cell_type compute_inner_cell(score_type diagonal_score,
+                                        affine_cell_t previous_cell,
+                                        score_type const sequence_score) const noexcept
+    {
+        diagonal_score += sequence_score;
+        score_type horizontal_score = previous_cell.horizontal_score();
+        score_type vertical_score = previous_cell.vertical_score();
+        score_type long_horizontal_score = previous_cell.long_horizontal_score();
+        score_type long_vertical_score = previous_cell.long_vertical_score();
+
+        diagonal_score = (diagonal_score < vertical_score) ? vertical_score : diagonal_score;
+        diagonal_score = (diagonal_score < horizontal_score) ? horizontal_score : diagonal_score;
+        diagonal_score = (diagonal_score < long_vertical_score) ? long_vertical_score : diagonal_score;
+        diagonal_score = (diagonal_score < long_horizontal_score) ? long_horizontal_score : diagonal_score;
+
+        if constexpr (traits_type::is_local)
+            diagonal_score = (diagonal_score < score_type{}) ? score_type{} : diagonal_score;
+
+        score_type tmp = diagonal_score + gap_open_score;
+        score_type long_tmp = diagonal_score + long_gap_open_score;
+        vertical_score += gap_extension_score;
+        horizontal_score += gap_extension_score;
+        long_vertical_score += long_gap_extension_score;
+        long_horizontal_score += long_gap_extension_score;
+
+        // store the gap scores of the short and the long gaps in the next path
+        vertical_score = (vertical_score < tmp) ? tmp : vertical_score;
+        horizontal_score = (horizontal_score < tmp) ? tmp : horizontal_score;
+        long_vertical_score = (long_vertical_score < long_tmp) ? long_tmp : long_vertical_score;
+        long_horizontal_score = (long_horizontal_score < long_tmp) ? long_tmp : long_horizontal_score;
+
+        return {diagonal_score, horizontal_score, vertical_score, long_horizontal_score, long_vertical_score};
+    }
+
+    /*!\brief Initialises the first cell of the alignment matrix in the top left corner of the matrix.
+     *
+     * \returns The computed dual affine cell.
+     *
+     * \details
+     *
+     * Initialises the cell at the origin of the alignment matrix (top left corner of the matrix). The optimal score is
+     * initialised to 0, while the values of the gap matrices are initialised with the respective gap open score:
+     * \f$V[0, 0] = H[0, 0] = g_o\f$ and \f$\tilde{V}[0, 0] = \tilde{H}[0, 0] = \tilde{g}_o\f$.
+     */
+    affine_cell_type initialise_origin_cell() const noexcept
+    {
+        return {score_type{},
+                first_row_is_free ? score_type{} : gap_open_score,
+                first_column_is_free ? score_type{} : gap_open_score,
+                first_row_is_free ? score_type{} : long_gap_open_score,
+                first_column_is_free ? score_type{} : long_gap_open_score};
+    }
+
+    /*!\brief Initialises a cell of the first alignment matrix column.
+     *
+     * \tparam affine_cell_t The type of the affine cell; must be an instance of seqan3::detail::affine_cell_proxy
+     *                       over a seqan3::detail::dual_affine_score_cell.
+     *
+     * \param[in] previous_cell The predecessor cell on the same column \f$M[i-1, 0]\f$.
+     *
+     * \returns The computed dual affine cell.
+     *
+     * \details
+     *
+     * Initialises a cell of the first alignment matrix column. The optimal score is the better of the vertical and
+     * the long vertical score, i.e. \f$M[i, 0] = \max \{g_o + g_e * i, \tilde{g}_o + \tilde{g}_e * i\}\f$.
+     * Both horizontal scores are initialised by opening a new gap from \f$M[i, 0]\f$.
+     */
+    template <typename affine_cell_t>
+    affine_cell_type initialise_first_column_cell(affine_cell_t previous_cell) const noexcept
+    {
+        score_type vertical_score = previous_cell.vertical_score();
+        score_type long_vertical_score = previous_cell.long_vertical_score();
+        score_type best_score = (vertical_score < long_vertical_score) ? long_vertical_score : vertical_score;
+
+        return {best_score,
+                best_score + gap_open_score,
+                first_column_is_free ? vertical_score : vertical_score + gap_extension_score,
+                best_score + long_gap_open_score,
+                first_column_is_free ? long_vertical_score : long_vertical_score + long_gap_extension_score};
+    }
+
+    /*!\brief Initialises the first cell of a alignment matrix column.
+     *
+     * \tparam affine_cell_t The type of the affine cell; must be an instance of seqan3::detail::affine_cell_proxy
+     *                       over a seqan3::detail::dual_affine_score_cell.
+     *
+     * \param[in] previous_cell The predecessor cell on the same row \f$M[0, j-1]\f$.
+     *
+     * \returns The computed dual affine cell.
+     *
+     * \details
+     *
+     * Initialises the first cell of a alignment matrix column. The optimal score is the better of the horizontal and
+     * the long horizontal score, i.e. \f$M[0, j] = \max \{g_o + g_e * j, \tilde{g}_o + \tilde{g}_e * j\}\f$.
+     * Both vertical scores are initialised by opening a new gap from \f$M[0, j]\f$.
+     */
+    template <typename affine_cell_t>
+    affine_cell_type initialise_first_row_cell(affine_cell_t previous_cell) const noexcept
+    {
+        score_type horizontal_score = previous_cell.horizontal_score();
+        score_type long_horizontal_score = previous_cell.long_horizontal_score();
+        score_type best_score = (horizontal_score < long_horizontal_score) ? long_horizontal_score : horizontal_score;
+
+        return {best_score,
+                first_row_is_free ? horizontal_score : horizontal_score + gap_extension_score,
+                best_score + gap_open_score,
+                first_row_is_free ? long_horizontal_score : long_horizontal_score + long_gap_extension_score,
+                best_score + long_gap_open_score};
+    }
+
+    /*!\brief Returns the lowest viable score.
+     *
+     * \details
+     *
+     * In some versions of the algorithms a value representing minus infinity is needed. Since the data type is an
+     * signed integral there is no infinity but only the lowest possible value that can be represented by the score
+     * type. The returned value leaves enough room to subtract the gap penalties of the short and the long gaps
+     * without a signed integer underflow.
+     */
+    score_type lowest_viable_score() const noexcept
+    {
+        if constexpr (simd_concept<score_type>)
+        {
+            assert(gap_open_score[0] <= 0 && gap_extension_score[0] <= 0);
+            assert(long_gap_open_score[0] <= 0 && long_gap_extension_score[0] <= 0);
+        }
+        else
+        {
+            assert(gap_open_score <= 0 && gap_extension_score <= 0);
+            assert(long_gap_open_score <= 0 && long_gap_extension_score <= 0);
+        }
+
+        return maybe_convert_to_simd(std::numeric_limits<original_score_type>::lowest()) -
+               (gap_open_score + gap_extension_score) - (long_gap_open_score + long_gap_extension_score);
+    }
+
+    /*!\brief Converts the given score type to a simd vector if the alignment is executed in vectorised mode.
+     *
+     * \tparam score_t The score type to convert; must model seqan3::arithmetic.
+     * \param[in] score The score to convert.
+     *
+     * \returns The score converted to the target simd vector or the unmodified value if in scalar mode.
+     */
+    template <typename score_t>
+    //!\cond
+        requires arithmetic<std::remove_cvref_t<score_t>>
+    //!\endcond
+    constexpr auto maybe_convert_to_simd(score_t && score) const noexcept
+    {
+        if constexpr (simd_concept<score_type>)
+            return simd::fill<score_type>(std::forward<score_t>(score));
+        else // Return unmodified.
+            return std::forward<score_t>(score);
+    }
+};
+} // namespace seqan3::detail
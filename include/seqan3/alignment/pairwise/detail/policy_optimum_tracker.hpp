@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 
 #include <seqan3/alignment/matrix/detail/coordinate_matrix.hpp>
@@ -20,6 +21,7 @@
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 
 namespace seqan3::detail
@@ -180,6 +182,10 @@ public:
  * standard global alignment).
  * The optimum needs to be reset in between alignment computations in order to ensure that the correct result is
  * tracked.
+ *
+ * If seqan3::align_cfg::x_drop is configured, every cell is tracked and additionally the best score of the current
+ * column is recorded. After a column was computed, the algorithm asks the tracker via
+ * seqan3::detail::policy_optimum_tracker::x_drop_reached whether the computation can be terminated.
  */
 template <typename alignment_configuration_t, std::semiregular optimum_updater_t>
 //!\cond
@@ -214,6 +220,11 @@ protected:
     //!\brief Whether cells of the last column shall be tracked.
     bool test_last_column_cell{false};
 
+    //!\brief The maximal score drop below the optimum before the computation is terminated.
+    score_type x_drop_score{};
+    //!\brief The best score of the currently computed column.
+    score_type column_optimal_score{};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -230,13 +241,32 @@ protected:
      * \details
      *
      * Reads the state of seqan3::align_cfg::method_global and enables the tracking of the last row or column if
-     * requested. Otherwise, only the last cell will be tracked.
+     * requested. Otherwise, only the last cell will be tracked. If seqan3::align_cfg::x_drop is configured, every
+     * cell is tracked instead, since the alignment can end anywhere in the matrix.
      */
     policy_optimum_tracker(alignment_configuration_t const & config)
     {
         auto method_global_config = config.get_or(align_cfg::method_global{});
         test_last_row_cell = method_global_config.free_end_gaps_sequence1_trailing;
         test_last_column_cell = method_global_config.free_end_gaps_sequence2_trailing;
+
+        if constexpr (traits_type::is_x_drop)
+        {
+            using seqan3::get;
+            using original_score_t = typename traits_type::original_score_type;
+
+            // The optimum is never negative, such that the threshold can always be subtracted without overflow.
+            auto const x_drop = static_cast<original_score_t>(
+                std::clamp<int64_t>(get<align_cfg::x_drop>(config).value,
+                                    0,
+                                    std::numeric_limits<original_score_t>::max()));
+            test_every_cell = true;
+
+            if constexpr (traits_type::is_vectorised)
+                x_drop_score = simd::fill<score_type>(x_drop);
+            else
+                x_drop_score = x_drop;
+        }
     }
     //!\}
 
@@ -257,6 +287,9 @@ protected:
     template <typename cell_t>
     decltype(auto) track_cell(cell_t && cell, matrix_coordinate_type coordinate) noexcept
     {
+        if constexpr (traits_type::is_x_drop)
+            column_optimal_score = std::max<score_type>(column_optimal_score, cell.best_score());
+
         if (test_every_cell)
             invoke_comparator(cell, std::move(coordinate));
 
@@ -331,6 +364,32 @@ protected:
     {
         optimal_score = std::numeric_limits<score_type>::lowest();
         optimal_coordinate = {};
+        column_optimal_score = std::numeric_limits<score_type>::lowest();
+    }
+
+    /*!\brief Checks whether the computation of the alignment matrix can be terminated after the current column.
+     *
+     * \param[in] column_index The index of the column that was computed last (not used in this context).
+     *
+     * \returns `true` if seqan3::align_cfg::x_drop is configured and the best score of the current column fell more
+     *          than the configured value below the optimum, `false` otherwise.
+     *
+     * \details
+     *
+     * Afterwards, the best score of the column is reset such that the next column can be tracked.
+     */
+    bool x_drop_reached([[maybe_unused]] size_t const column_index) noexcept
+    {
+        if constexpr (traits_type::is_x_drop)
+        {
+            bool const is_dropped = column_optimal_score < optimal_score - x_drop_score;
+            column_optimal_score = std::numeric_limits<score_type>::lowest();
+            return is_dropped;
+        }
+        else
+        {
+            return false;
+        }
     }
 
     /*!\brief Handles the invocation of the optimum comparator and updater.
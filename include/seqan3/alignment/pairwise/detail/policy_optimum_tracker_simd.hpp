@@ -80,9 +80,90 @@ struct max_score_updater_simd_global
     }
 };
 
-/*!\brief Implements the tracker to store the global optimum for a particular alignment computation.
+/*!\brief Function object that compares and updates the alignment optimum for the vectorised local alignment algorithm.
+ * \ingroup pairwise_alignment
+ * \tparam matrix_index_t The type of the simd matrix index; must model seqan3::simd::simd_index.
+ *
+ * \details
+ *
+ * In the local alignment every cell of the alignment matrix is a candidate for the optimum. Within the
+ * inter-sequence vectorisation layout the matrices of the shorter sequence pairs are embedded in the encompassing
+ * matrix defined by the longest sequences of the batch. The cells outside of a contained matrix are computed with
+ * the padding symbols and must not be considered as an optimum for the respective alignment.
+ * Thus, the updater stores the last row and column index of every contained matrix and masks out all lanes whose
+ * current coordinate exceeds these indices. Since the cells of a contained matrix depend only on cells of the same
+ * contained matrix, no further correction of the tracked score is required.
+ * The score is only updated if it is strictly greater than the current optimum, such that the first optimum found in
+ * column-major order is reported, which is consistent with the scalar local alignment.
+ */
+template <typename matrix_index_t>
+struct max_score_updater_simd_local
+{
+private:
+    //!\brief The row indices of the last row of every contained alignment matrix.
+    matrix_index_t target_row_index{};
+    //!\brief The column indices of the last column of every contained alignment matrix.
+    matrix_index_t target_col_index{};
+
+public:
+    /*!\brief Compares and updates the optimal score-coordinate pair.
+     * \tparam score_t The type of the score to track; must model std::assignable_from `const & score_t`.
+     * \tparam coordinate_t The type of the coordinate to track; must be a seqan3::matrix_index type with members that
+     *                      model seqan3::simd::simd_concept.
+     *
+     * \param[in,out] optimal_score The optimal score to update.
+     * \param[in,out] optimal_coordinate The optimal coordinate to update.
+     * \param[in] current_score The score of the current cell.
+     * \param[in] current_coordinate The coordinate of the current cell.
+     *
+     * \details
+     *
+     * Updates every lane whose current score is greater than the optimal score and whose current coordinate lies
+     * within the contained matrix of the respective sequence pair.
+     */
+    template <typename score_t, typename coordinate_t>
+    //!\cond
+        requires (std::assignable_from<score_t &, score_t const &> &&
+                  requires (coordinate_t coordinate)
+                  {
+                      requires simd_concept<decltype(coordinate.col)>;
+                      requires simd_concept<decltype(coordinate.row)>;
+                  })
+    //!\endcond
+    void operator()(score_t & optimal_score,
+                    coordinate_t & optimal_coordinate,
+                    score_t current_score,
+                    coordinate_t const & current_coordinate) const noexcept
+    {
+        auto mask = (current_score > optimal_score) &&
+                    (current_coordinate.col <= target_col_index) &&
+                    (current_coordinate.row <= target_row_index);
+        optimal_score = (mask) ? std::move(current_score) : optimal_score;
+        optimal_coordinate.col = (mask) ? current_coordinate.col : optimal_coordinate.col;
+        optimal_coordinate.row = (mask) ? current_coordinate.row : optimal_coordinate.row;
+    }
+
+    /*!\brief Sets the target index for the last row and column of every contained matrix.
+     * \param row_index The target indices of the last rows.
+     * \param col_index The target indices of the last columns.
+     */
+    void set_target_indices(row_index_type<matrix_index_t> row_index,
+                            column_index_type<matrix_index_t> col_index) noexcept
+    {
+        target_row_index = row_index.get();
+        target_col_index = col_index.get();
+    }
+};
+
+/*!\brief Implements the tracker to store the optimum for a particular vectorised alignment computation.
  * \ingroup pairwise_alignment
  * \copydetails seqan3::detail::policy_optimum_tracker
+ *
+ * For the global alignment the optimum updater must be seqan3::detail::max_score_updater_simd_global and for the local
+ * alignment it must be seqan3::detail::max_score_updater_simd_local.
+ * If seqan3::align_cfg::x_drop is configured, the global alignment may end in any cell and is tracked like the local
+ * alignment. In this case the computation of a sequence pair ends individually for every lane, while the simd
+ * vector is computed until all lanes are terminated.
  */
 template <typename alignment_configuration_t, std::semiregular optimum_updater_t>
 //!\cond
@@ -111,12 +192,29 @@ protected:
 
     static_assert(simd_concept<score_type>, "Must be a simd type!");
 
+    //!\brief The simd type of the matrix indices.
+    using matrix_index_type = typename traits_type::matrix_index_type;
+    //!\brief The matrix coordinate type that is used to locate a cell inside of the alignment matrix.
+    using typename base_policy_t::matrix_coordinate_type;
+
     // Import base variables into class scope.
     using base_policy_t::compare_and_set_optimum;
     using base_policy_t::optimal_score;
     using base_policy_t::optimal_coordinate;
+    using base_policy_t::x_drop_score;
+    using base_policy_t::column_optimal_score;
     //!\brief The individual offsets used for padding the sequences.
     std::array<original_score_type, simd_traits<score_type>::length> padding_offsets{};
+    //!\brief The index of the last row of every contained matrix (only used with seqan3::align_cfg::x_drop).
+    matrix_index_type last_row_index{};
+    //!\brief The index of the last column to compute for every contained matrix (only used with
+    //!\      seqan3::align_cfg::x_drop).
+    matrix_index_type last_column_index{};
+    //!\brief The largest score of every lane (only used with seqan3::align_cfg::detail::saturation_check).
+    score_type largest_score{};
+    //!\brief The largest score that can be extended by any substitution without an overflow (only used with
+    //!\      seqan3::align_cfg::detail::saturation_check).
+    scalar_type saturation_limit{};
 
     /*!\name Constructors, destructor and assignment
      * \{
@@ -129,24 +227,149 @@ protected:
     ~policy_optimum_tracker_simd() = default; //!< Defaulted.
 
     /*!\brief Construction and initialisation using the alignment configuration.
-     * \param[in] config The alignment configuration (not used in this context).
+     * \param[in] config The alignment configuration.
      *
      * \details
      *
      * Initialises the object to always track the last row and column, since this is needed for the vectorised global
-     * alignment.
+     * alignment. For the vectorised local alignment every cell is tracked instead.
+     * If seqan3::align_cfg::detail::saturation_check is configured, the saturation limit is set to the largest value
+     * of the score type reduced by the maximal substitution score.
      */
     policy_optimum_tracker_simd(alignment_configuration_t const & config) : base_policy_t{config}
     {
-        base_policy_t::test_last_row_cell = true;
-        base_policy_t::test_last_column_cell = true;
+        if constexpr (traits_type::is_saturation_checked)
+        {
+            saturation_limit = std::numeric_limits<scalar_type>::max() -
+                               get<align_cfg::detail::saturation_check>(config).max_sequence_score;
+        }
+
+        if constexpr (traits_type::is_local || traits_type::is_x_drop)
+        {
+            base_policy_t::test_every_cell = true;
+        }
+        else
+        {
+            base_policy_t::test_last_row_cell = true;
+            base_policy_t::test_last_column_cell = true;
+        }
     }
     //!\}
 
-    //!\copydoc seqan3::detail::policy_optimum_tracker::reset_optimum
+    /*!\brief Resets the optimum such that a new alignment can be computed.
+     *
+     * \details
+     *
+     * In the global alignment the optimal coordinate stores the precomputed projections of the last cells and is
+     * therefore not reset. In the local alignment the coordinate is reset to the origin of the matrix.
+     */
     void reset_optimum()
     {
         optimal_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+
+        if constexpr (traits_type::is_local || traits_type::is_x_drop)
+            optimal_coordinate = {};
+
+        if constexpr (traits_type::is_x_drop)
+            column_optimal_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+    }
+
+    /*!\brief Tracks any cell within the alignment matrix.
+     * \copydetails seqan3::detail::policy_optimum_tracker::track_cell
+     *
+     * If seqan3::align_cfg::x_drop is configured, the best score of the current column is only updated in the lanes
+     * whose contained matrix covers the cell and whose computation was not yet terminated.
+     * If seqan3::align_cfg::detail::saturation_check is configured, the largest score of every lane is updated.
+     */
+    template <typename cell_t>
+    decltype(auto) track_cell(cell_t && cell, matrix_coordinate_type coordinate) noexcept
+    {
+        if constexpr (traits_type::is_saturation_checked)
+            largest_score = (largest_score < cell.best_score()) ? cell.best_score() : largest_score;
+
+        if constexpr (traits_type::is_x_drop)
+        {
+            auto is_better_score = (column_optimal_score < cell.best_score()) &&
+                                   (coordinate.col <= last_column_index) &&
+                                   (coordinate.row <= last_row_index);
+            column_optimal_score = (is_better_score) ? cell.best_score() : column_optimal_score;
+        }
+
+        if (base_policy_t::test_every_cell)
+            base_policy_t::invoke_comparator(cell, std::move(coordinate));
+
+        return std::forward<cell_t>(cell);
+    }
+
+    /*!\brief Checks whether the computation of the alignment matrix can be terminated after the current column.
+     *
+     * \param[in] column_index The index of the column that was computed last.
+     *
+     * \returns `true` if seqan3::align_cfg::x_drop is configured and the computation of every lane is terminated,
+     *          `false` otherwise.
+     *
+     * \details
+     *
+     * A lane is terminated if the best score of its current column fell more than the configured value below its
+     * optimum or if its contained matrix has no further columns. The last column of a terminated lane is set to the
+     * current column, such that neither the optimum nor the best column score of this lane are updated afterwards.
+     * This gives the same result as if the sequence pair was computed on its own.
+     */
+    bool x_drop_reached([[maybe_unused]] size_t const column_index) noexcept
+    {
+        if constexpr (traits_type::is_x_drop)
+        {
+            using scalar_index_t = typename simd_traits<matrix_index_type>::scalar_type;
+
+            matrix_index_type const current_column_index =
+                simd::fill<matrix_index_type>(static_cast<scalar_index_t>(column_index));
+            auto is_dropped = (column_optimal_score < optimal_score - x_drop_score) &&
+                              (current_column_index < last_column_index);
+            last_column_index = (is_dropped) ? current_column_index : last_column_index;
+            column_optimal_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+
+            compare_and_set_optimum.set_target_indices(row_index_type{last_row_index},
+                                                       column_index_type{last_column_index});
+
+            for (size_t lane = 0; lane < simd_traits<matrix_index_type>::length; ++lane)
+            {
+                if (current_column_index[lane] < last_column_index[lane])
+                    return false;
+            }
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /*!\brief Checks whether a score of the current batch may have exceeded the score type.
+     *
+     * \returns `true` if seqan3::align_cfg::detail::saturation_check is configured and the largest score of any lane is
+     *          greater than the saturation limit, `false` otherwise.
+     *
+     * \details
+     *
+     * The score of a cell can only grow by adding a substitution score to its diagonal predecessor. The gap scores
+     * cannot be positive and the scores of the gap matrices never exceed the best score of a preceding cell. Thus,
+     * as long as no best score is greater than the saturation limit, no score of the alignment matrix has overflowed.
+     * The first score that exceeds the limit is computed correctly and keeps the largest score above the limit, even
+     * if subsequent scores overflow.
+     */
+    bool is_saturated() const noexcept
+    {
+        if constexpr (traits_type::is_saturation_checked)
+        {
+            for (size_t lane = 0; lane < simd_traits<score_type>::length; ++lane)
+            {
+                if (largest_score[lane] > saturation_limit)
+                    return true;
+            }
+        }
+
+        return false;
     }
 
     /*!\brief Initialises the tracker and possibly the binary update operation.
@@ -194,6 +417,12 @@ protected:
      * In the global alignment it is suffcient to only track the optimal score in the last row and column of the
      * encompassing matrix and only at the precomputed coordinate projections. Eventually, the score offset is
      * subtracted to obtain the original score.
+     *
+     * In the local alignment no projection is needed. Instead, the last row and column index of every contained matrix
+     * is passed to the optimum updater, which ignores all cells outside of the respective matrix. The padding offsets
+     * remain `0`. The same holds for the global alignment with seqan3::align_cfg::x_drop.
+     *
+     * If seqan3::align_cfg::detail::saturation_check is configured, the largest score of every lane is reset as well.
      */
     template <std::ranges::input_range sequence1_collection_t, std::ranges::input_range sequence2_collection_t>
     void initialise_tracker(sequence1_collection_t & sequence1_collection,
@@ -202,6 +431,9 @@ protected:
         using index_t = typename traits_type::matrix_index_type;
         using scalar_index_t = typename simd_traits<index_t>::scalar_type;
 
+        if constexpr (traits_type::is_saturation_checked)
+            largest_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+
         scalar_index_t largest_sequence1_size{};
         scalar_index_t largest_sequence2_size{};
         alignas(alignof(index_t)) std::array<scalar_index_t, traits_type::alignments_per_vector> sequence1_sizes{};
@@ -218,6 +450,15 @@ protected:
             ++sequence_count;
         }
 
+        if constexpr (traits_type::is_local || traits_type::is_x_drop)
+        {
+            last_row_index = simd::load<index_t>(sequence2_sizes.data());
+            last_column_index = simd::load<index_t>(sequence1_sizes.data());
+            compare_and_set_optimum.set_target_indices(row_index_type{last_row_index},
+                                                       column_index_type{last_column_index});
+            return;
+        }
+
         // Second, determine the offset for each individual end-coordinate which is used to project the cell to the
         // last row or column of the global alignment matrix. Choose the smallest distance as the correct offset
         // to the projected cell.
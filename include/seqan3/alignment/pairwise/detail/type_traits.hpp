@@ -18,13 +18,20 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_packed_trace_matrix.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_saturation_check.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_unordered_results.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -99,6 +106,12 @@ private:
     template <arithmetic score_t>
     using select_scalar_index_t = min_viable_uint_t<1ull << (bits_of<score_t> - 1)>;
 
+    /*!\brief The 8 bit simd vector type with as many lanes as the given simd vector type.
+     * \tparam simd_t The simd vector type of the scores; must model seqan3::simd::simd_concept.
+     */
+    template <typename simd_t>
+    using select_compact_trace_t = simd_type_t<int8_t, simd_traits<simd_t>::length>;
+
     //!\brief Helper function to determine the alignment result type.
     static constexpr auto determine_alignment_result_type() noexcept
     {
@@ -119,19 +132,43 @@ private:
 public:
     //!\brief Flag to indicate vectorised mode.
     static constexpr bool is_vectorised = configuration_t::template exists<align_cfg::vectorised>();
+    //!\brief Flag indicating whether the vectorised alignment selects the score width for every sequence pair.
+    static constexpr bool is_score_type_adaptive = configuration_t::template exists<align_cfg::score_type_adaptive>();
+    //!\brief Flag indicating whether the vectorised alignment detects scores that may exceed the score type.
+    static constexpr bool is_saturation_checked =
+        configuration_t::template exists<align_cfg::detail::saturation_check>();
     //!\brief Flag indicating whether parallel alignment mode is enabled.
-    static constexpr bool is_parallel = configuration_t::template exists<align_cfg::parallel>();
+    static constexpr bool is_parallel = configuration_t::template exists<align_cfg::parallel>() ||
+                                        configuration_t::template exists<align_cfg::parallel_work_stealing>();
+    //!\brief Flag indicating whether the results of the parallel alignment are streamed in completion order.
+    static constexpr bool is_unordered =
+        is_parallel && configuration_t::template exists<align_cfg::unordered_results>();
     //!\brief Flag indicating whether global alignment method is enabled.
     static constexpr bool is_global =
         configuration_t::template exists<seqan3::align_cfg::method_global>();
     //!\brief Flag indicating whether local alignment mode is enabled.
     static constexpr bool is_local = configuration_t::template exists<seqan3::align_cfg::method_local>();
+    //!\brief Flag indicating whether every sequence pair is aligned within its own band.
+    static constexpr bool is_banded_per_sequence_pair =
+        configuration_t::template exists<align_cfg::band_per_sequence_pair>();
     //!\brief Flag indicating whether banded alignment mode is enabled.
-    static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>();
+    static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>() ||
+                                      is_banded_per_sequence_pair;
+    //!\brief Flag indicating whether the computation terminates early once the score drops too far.
+    static constexpr bool is_x_drop = configuration_t::template exists<align_cfg::x_drop>();
+    //!\brief Flag indicating whether the alignment is traced back in linear memory.
+    static constexpr bool is_linear_memory_traceback =
+        configuration_t::template exists<align_cfg::linear_memory_traceback>();
+    //!\brief Flag indicating whether the trace matrix stores four bits per cell.
+    static constexpr bool is_packed_trace_matrix = configuration_t::template exists<align_cfg::packed_trace_matrix>();
+    //!\brief Flag indicating whether the dual affine gap cost model is used.
+    static constexpr bool is_dual_affine = configuration_t::template exists<align_cfg::gap_cost_dual_affine>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = configuration_t::template exists<detail::debug_mode>();
     //!\brief Flag indicating whether a user provided callback was given.
     static constexpr bool is_one_way_execution = configuration_t::template exists<align_cfg::on_result>();
+    //!\brief Flag indicating whether a precomputed query profile was given.
+    static constexpr bool has_query_profile = configuration_t::template exists<align_cfg::query_profile>();
     //!\brief The selected scoring scheme.
     using scoring_scheme_type = decltype(get<align_cfg::scoring_scheme>(std::declval<configuration_t>()).scheme);
     //!\brief The alphabet of the selected scoring scheme.
@@ -143,6 +180,13 @@ public:
     using score_type = std::conditional_t<is_vectorised, simd_type_t<original_score_type>, original_score_type>;
     //!\brief The trace directions type for the alignment algorithm.
     using trace_type = std::conditional_t<is_vectorised, simd_type_t<original_score_type>, trace_directions>;
+    /*!\brief The trace directions type for the new alignment algorithm.
+     * \details In the vectorised alignment the trace directions of every lane are stored in a single byte, i.e. the
+     *          trace type is an 8 bit simd vector with as many lanes as the score type, independent of the score width.
+     */
+    using compact_trace_type = lazy_conditional_t<is_vectorised,
+                                                  lazy<select_compact_trace_t, simd_type_t<original_score_type>>,
+                                                  trace_directions>;
     //!\brief The alignment result type if present. Otherwise seqan3::detail::empty_type.
     using alignment_result_type = decltype(determine_alignment_result_type());
     //!\brief The type of the matrix index.
@@ -154,14 +198,23 @@ public:
                                                       lazy<simd_matrix_coordinate, matrix_index_type>,
                                                       matrix_coordinate>;
 
-    //!\brief The number of alignments that can be computed in one simd vector.
+    /*!\brief The number of alignments that can be computed in one simd vector.
+     * \details If the score type is adaptive, this is the number of alignments for the narrowest score type.
+     */
     static constexpr size_t alignments_per_vector = [] () constexpr
                                                     {
-                                                        if constexpr (is_vectorised)
+                                                        if constexpr (is_vectorised && is_score_type_adaptive)
+                                                            return simd_traits<simd_type_t<int8_t>>::length;
+                                                        else if constexpr (is_vectorised)
                                                             return simd_traits<score_type>::length;
                                                         else
                                                             return 1;
                                                     }();
+    /*!\brief The number of alignments that are passed to the alignment algorithm at once.
+     * \details In vectorised mode a chunk spans several simd vectors, such that the sequence pairs of similar length
+     *          can be computed in the same simd vector, see seqan3::detail::pairwise_alignment_algorithm_lane_packing.
+     */
+    static constexpr size_t alignments_per_chunk = (is_vectorised) ? alignments_per_vector * 8 : 1;
     //!\brief Flag indicating whether the score shall be computed.
     static constexpr bool compute_score = configuration_t::template exists<align_cfg::output_score>();
     //!\brief Flag indicating whether the end positions shall be computed.
@@ -187,7 +240,9 @@ public:
                                                      output_sequence1_id ||
                                                      output_sequence2_id;
     //!\brief Flag indicating whether the trace matrix needs to be computed.
-    static constexpr bool requires_trace_information = compute_begin_positions || compute_sequence_alignment;
+    //!\details The vectorised alignment computes the begin positions without a trace matrix.
+    static constexpr bool requires_trace_information = (compute_begin_positions && !is_vectorised) ||
+                                                       compute_sequence_alignment;
 };
 
 //------------------------------------------------------------------------------
@@ -12,11 +12,19 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
 #include <tuple>
 
+#include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/matrix_concept.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
+#include <seqan3/utility/simd/simd.hpp>
 
 namespace seqan3::detail
 {
@@ -46,6 +54,20 @@ private:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    /*!\brief Whether the sequence pairs are aligned with seqan3::detail::edit_distance_unbanded_simd.
+     *
+     * \details
+     *
+     * The inter-query vectorisation is used if seqan3::align_cfg::vectorised is configured and only the score,
+     * the end positions or the ids are requested, since the begin positions and the alignment require a trace matrix.
+     * Banded alignments are always computed with seqan3::detail::edit_distance_banded.
+     */
+    static constexpr bool use_inter_query_simd = !configuration_traits_type::is_banded &&
+                                                 configuration_traits_type::is_vectorised &&
+                                                 !configuration_traits_type::compute_begin_positions &&
+                                                 !configuration_traits_type::compute_sequence_alignment &&
+                                                 !configuration_traits_type::is_debug;
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -87,7 +109,13 @@ public:
      * \details
      *
      * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
-     * alignment result.
+     * alignment result. If seqan3::align_cfg::vectorised is configured, the sequence pairs whose second sequence is
+     * not empty and fits into a single machine word are computed in the lanes of a simd vector, see
+     * seqan3::detail::edit_distance_unbanded_simd. If seqan3::align_cfg::band_fixed_size is configured, the sequence
+     * pairs are computed within the band, see seqan3::detail::edit_distance_banded. All other sequence pairs are
+     * computed one after another. If seqan3::align_cfg::all_hits is configured, the callback is invoked once for every
+     * reported hit of a sequence pair.
+     * The callback is always invoked in the order of the given sequence pairs.
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
     //!\cond
@@ -97,14 +125,162 @@ public:
     {
         using std::get;
 
-        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
-            compute_single_pair(index,
-                                get<0>(sequence_pair),
-                                get<1>(sequence_pair),
-                                std::forward<callback_t>(callback));
+        if constexpr (config_t::template exists<align_cfg::band_fixed_size>())
+        {
+            edit_distance_banded<traits_t::is_semi_global_type::value> algorithm{
+                get<align_cfg::band_fixed_size>(*cfg_ptr)};
+
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+            {
+                algorithm.compute(get<0>(sequence_pair), get<1>(sequence_pair));
+                invoke_result(index,
+                              algorithm.score(),
+                              algorithm.end_column(),
+                              std::ranges::distance(get<0>(sequence_pair)),
+                              std::ranges::distance(get<1>(sequence_pair)),
+                              callback);
+            }
+        }
+        else if constexpr (use_inter_query_simd)
+        {
+            // Queries of up to 32 symbols fit into the 32 bit lanes, which hold twice as many queries.
+            bool const fits_32_bit_lanes = std::ranges::all_of(indexed_sequence_pairs, [] (auto && indexed_pair)
+            {
+                return std::ranges::distance(get<1>(get<0>(indexed_pair))) <= 32;
+            });
+
+            if (fits_32_bit_lanes)
+                compute_vectorised<simd_type_t<uint32_t>>(indexed_sequence_pairs, callback);
+            else
+                compute_vectorised<simd_type_t<uint64_t>>(indexed_sequence_pairs, callback);
+        }
+        else
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+                compute_single_pair(index,
+                                    get<0>(sequence_pair),
+                                    get<1>(sequence_pair),
+                                    std::forward<callback_t>(callback));
+        }
     }
 private:
 
+    /*!\brief Computes the sequence pairs in batches of seqan3::detail::edit_distance_unbanded_simd.
+     * \tparam word_simd_t The simd vector type storing the bit-vectors of the queries.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs.
+     * \tparam callback_t The callback to call on the computed alignment result.
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     * \param[in] callback The callback to invoke on an alignment result.
+     *
+     * \details
+     *
+     * Sequence pairs whose query is empty or does not fit into a lane are computed with
+     * seqan3::detail::edit_distance_unbanded when the results of their batch are reported.
+     */
+    template <typename word_simd_t, typename indexed_sequence_pairs_t, typename callback_t>
+    void compute_vectorised(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t & callback)
+    {
+        using std::get;
+        using indexed_pair_t = std::ranges::range_reference_t<indexed_sequence_pairs_t>;
+        using query_t = decltype(get<1>(get<0>(std::declval<indexed_pair_t>())));
+        using query_alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+        using kernel_t = edit_distance_unbanded_simd<word_simd_t,
+                                                     query_alphabet_t,
+                                                     traits_t::is_semi_global_type::value>;
+
+        auto fits_lane = [] (auto && query)
+        {
+            size_t const query_size = std::ranges::distance(query);
+            return query_size > 0 && query_size <= kernel_t::max_query_size;
+        };
+
+        static thread_local kernel_t kernel{};
+        auto batch_end = std::ranges::begin(indexed_sequence_pairs);
+        while (batch_end != std::ranges::end(indexed_sequence_pairs))
+        {
+            auto batch_begin = batch_end;
+
+            kernel.clear();
+            for (; batch_end != std::ranges::end(indexed_sequence_pairs) && !kernel.full(); ++batch_end)
+            {
+                auto && [sequence_pair, index] = *batch_end;
+                if (fits_lane(get<1>(sequence_pair)))
+                    kernel.add_lane(get<0>(sequence_pair), get<1>(sequence_pair));
+            }
+
+            kernel.compute();
+
+            size_t lane = 0;
+            for (; batch_begin != batch_end; ++batch_begin)
+            {
+                auto && [sequence_pair, index] = *batch_begin;
+                if (fits_lane(get<1>(sequence_pair)))
+                {
+                    invoke_result(index,
+                                  kernel.score(lane),
+                                  kernel.end_column(lane),
+                                  std::ranges::distance(get<0>(sequence_pair)),
+                                  std::ranges::distance(get<1>(sequence_pair)),
+                                  callback);
+                    ++lane;
+                }
+                else
+                {
+                    compute_single_pair(index, get<0>(sequence_pair), get<1>(sequence_pair), callback);
+                }
+            }
+        }
+    }
+
+    /*!\brief Builds the alignment result of a sequence pair computed by a bit-vector kernel and invokes the callback.
+     * \tparam callback_t The callback to call on the computed alignment result.
+     * \param[in] idx The index of the sequence pair.
+     * \param[in] edit_distance The computed edit distance.
+     * \param[in] end_column The computed end position in the first sequence.
+     * \param[in] database_size The size of the first sequence.
+     * \param[in] query_size The size of the second sequence.
+     * \param[in] callback The callback to invoke on the alignment result.
+     *
+     * \details
+     *
+     * Sets the same values as seqan3::detail::edit_distance_unbanded, including the invalid score and end positions
+     * if the edit distance exceeds the configured seqan3::align_cfg::min_score.
+     */
+    template <typename callback_t>
+    void invoke_result([[maybe_unused]] size_t const idx,
+                       [[maybe_unused]] size_t const edit_distance,
+                       [[maybe_unused]] size_t const end_column,
+                       [[maybe_unused]] size_t const database_size,
+                       [[maybe_unused]] size_t const query_size,
+                       callback_t & callback) const
+    {
+        using score_t = typename configuration_traits_type::original_score_type;
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        bool is_valid = true;
+        if constexpr (config_t::template exists<align_cfg::min_score>())
+            is_valid = static_cast<score_t>(edit_distance) <= -get<align_cfg::min_score>(*cfg_ptr).score;
+
+        result_value_type res_vt{};
+
+        if constexpr (configuration_traits_type::output_sequence1_id)
+            res_vt.sequence1_id = idx;
+
+        if constexpr (configuration_traits_type::output_sequence2_id)
+            res_vt.sequence2_id = idx;
+
+        if constexpr (configuration_traits_type::compute_score)
+            res_vt.score = is_valid ? -static_cast<score_t>(edit_distance) : matrix_inf<score_t>;
+
+        if constexpr (configuration_traits_type::compute_end_positions)
+        {
+            res_vt.end_positions = alignment_coordinate{column_index_type{is_valid ? end_column : database_size},
+                                                        row_index_type{query_size}};
+        }
+
+        callback(alignment_result_type{std::move(res_vt)});
+    }
+
     /*!\brief Invokes the actual alignment computation for a single pair of sequences.
      * \tparam    first_range_t  The type of the first sequence (or packed sequences); must model
      *                           std::ranges::forward_range.
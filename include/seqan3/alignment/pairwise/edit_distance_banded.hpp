@@ -0,0 +1,348 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_banded.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the edit distance within a band of diagonals with Myers' bit-vector algorithm.
+ * \ingroup pairwise_alignment
+ *
+ * \tparam is_semi_global Whether leading and trailing gaps in the database sequence are free.
+ * \tparam word_t The type of the machine word storing the bit-vectors; must be an unsigned integral type.
+ *
+ * \details
+ *
+ * The database sequence (first sequence) spans the columns and the query sequence (second sequence) the rows of the
+ * alignment matrix. Like in seqan3::align_cfg::band_fixed_size, a cell in column `j` and row `i` belongs to the band
+ * if `lower_diagonal <= j - i <= upper_diagonal`. Cells outside of the band are treated as infinity.
+ *
+ * Following Hyyrö's banded bit-vector algorithm, only the blocks of the current column that overlap the band are
+ * computed, such that the runtime is proportional to the number of columns times the band width divided by the word
+ * size instead of the full matrix size. The band boundaries are handled exactly:
+ *
+ * * The cell above the first band cell of a column is set to its left neighbour plus one. This value can never be
+ *   smaller than the diagonal predecessor of the first band cell, so it does not change the result.
+ * * A row entering the band from below starts with a vertical delta of plus one, i.e. its left neighbour is never
+ *   smaller than the diagonal predecessor either.
+ *
+ * The score is tracked along the lower band boundary until it reaches the last row and along the last row
+ * afterwards. Like seqan3::detail::edit_distance_unbanded, the last column with the optimal score is reported in the
+ * semi-global case.
+ */
+template <bool is_semi_global, typename word_t = uint64_t>
+class edit_distance_banded
+{
+public:
+    static_assert(std::is_unsigned_v<word_t>, "The word type of edit_distance_banded must be unsigned.");
+
+    //!\brief The type of the machine word.
+    using word_type = word_t;
+
+private:
+    //!\brief The number of bits of the machine word.
+    static constexpr int64_t word_size = bits_of<word_type>;
+    //!\brief The horizontal delta of the first row: 0 in the semi-global and +1 in the global alignment.
+    static constexpr word_type hp0 = is_semi_global ? 0u : 1u;
+
+    //!\brief The lower diagonal of the band.
+    int64_t lower_diagonal{std::numeric_limits<int32_t>::lowest()};
+    //!\brief The upper diagonal of the band.
+    int64_t upper_diagonal{std::numeric_limits<int32_t>::max()};
+
+    //!\brief The vertical positive delta of all blocks.
+    std::vector<word_type> vp{};
+    //!\brief The vertical negative delta of all blocks.
+    std::vector<word_type> vn{};
+    //!\brief The match masks of every symbol for all blocks.
+    std::vector<word_type> bit_masks{};
+    //!\brief The number of blocks covering the query.
+    size_t block_count{};
+
+    //!\brief The computed edit distance.
+    size_t score_value{};
+    //!\brief The computed end column.
+    size_t end_column_value{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_banded() = default; //!< Defaulted.
+    edit_distance_banded(edit_distance_banded const &) = default; //!< Defaulted.
+    edit_distance_banded(edit_distance_banded &&) = default; //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded const &) = default; //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded &&) = default; //!< Defaulted.
+    ~edit_distance_banded() = default; //!< Defaulted.
+
+    /*!\brief Constructs the algorithm for the given band.
+     * \param[in] band The band to compute.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band cannot be used with the edit distance.
+     */
+    explicit edit_distance_banded(align_cfg::band_fixed_size const & band) :
+        lower_diagonal{band.lower_diagonal},
+        upper_diagonal{band.upper_diagonal}
+    {
+        bool invalid_band = upper_diagonal < lower_diagonal;
+        std::string error_cause = invalid_band ? " The upper diagonal is smaller than the lower diagonal." : "";
+
+        // The first column is never free, the first row only in the semi-global alignment.
+        invalid_band |= (upper_diagonal < 0) || (lower_diagonal > 0 && !is_semi_global);
+        error_cause += " The band starts in a region without free gaps.";
+
+        if (invalid_band)
+            throw_invalid_band(error_cause);
+    }
+    //!\}
+
+    /*!\brief Computes the banded edit distance of the given sequences.
+     * \tparam database_t The type of the database sequence; must model std::ranges::forward_range.
+     * \tparam query_t The type of the query sequence; must model std::ranges::forward_range.
+     * \param[in] database The database sequence.
+     * \param[in] query The query sequence.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not cover the last cell of the alignment
+     *         matrix and the respective end gaps are not free.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * \f$O(N \cdot \lceil (u - l + 1) / w \rceil)\f$, where \f$N\f$ is the size of the database sequence, \f$l\f$
+     * and \f$u\f$ are the lower and the upper diagonal and \f$w\f$ is the number of bits of the machine word.
+     */
+    template <std::ranges::forward_range database_t, std::ranges::forward_range query_t>
+    void compute(database_t && database, query_t && query)
+    {
+        using alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+
+        int64_t const database_size = std::ranges::distance(database);
+        int64_t const query_size = std::ranges::distance(query);
+
+        check_valid_band(database_size, query_size);
+        initialise(query, alphabet_size<alphabet_t>);
+
+        // The row and the score of the last band cell in the current column, which is the cell on the lower
+        // diagonal until it reaches the last row. The first column is always i for row i.
+        int64_t bottom_row = std::min(query_size, -lower_diagonal);
+        int64_t bottom_score = bottom_row;
+
+        size_t best_score = std::numeric_limits<size_t>::max();
+        size_t best_column = 0;
+        auto update_best_score = [&] (int64_t const column)
+        {
+            if (bottom_row == query_size && column <= query_size + upper_diagonal &&
+                static_cast<size_t>(bottom_score) <= best_score)
+            {
+                best_score = bottom_score;
+                best_column = column;
+            }
+        };
+
+        if constexpr (is_semi_global)
+            update_best_score(0);
+
+        int64_t column = 0;
+        for (auto && symbol : database)
+        {
+            ++column;
+
+            // The rows of the current column within the band; the first row is not part of the bit-vectors.
+            int64_t const first_row = std::max<int64_t>(1, column - upper_diagonal);
+            int64_t const last_row = std::min(query_size, column - lower_diagonal);
+
+            column_delta delta{};
+            if (first_row <= last_row)
+            {
+                // The first row only provides its own horizontal delta if it is still inside the band.
+                word_type const hin = (column <= upper_diagonal) ? hp0 : 1u;
+                delta = compute_column(seqan3::to_rank(static_cast<alphabet_t>(symbol)), first_row, last_row, hin);
+            }
+
+            if (last_row >= 0)
+            {
+                if (bottom_row < 0) // The band enters the first row, which is free in the semi-global alignment.
+                    bottom_score = 0;
+                else if (last_row > bottom_row) // Follow the lower diagonal.
+                    bottom_score += delta.diagonal;
+                else if (query_size == 0)
+                    bottom_score += hp0;
+                else if (first_row <= last_row) // Follow the last row.
+                    bottom_score += delta.horizontal;
+            }
+            bottom_row = last_row;
+
+            if constexpr (is_semi_global)
+            {
+                update_best_score(column);
+
+                if (column > query_size + upper_diagonal) // The band left the last row.
+                    break;
+            }
+        }
+
+        if constexpr (is_semi_global)
+        {
+            score_value = best_score;
+            end_column_value = best_column;
+        }
+        else
+        {
+            score_value = bottom_score;
+            end_column_value = database_size;
+        }
+    }
+
+    //!\brief Returns the computed edit distance.
+    size_t score() const noexcept
+    {
+        return score_value;
+    }
+
+    //!\brief Returns the column of the end position in the database sequence.
+    size_t end_column() const noexcept
+    {
+        return end_column_value;
+    }
+
+private:
+    //!\brief The deltas of the last band cell of a column.
+    struct column_delta
+    {
+        //!\brief The difference to the diagonal predecessor, i.e. 0 or 1.
+        int64_t diagonal{};
+        //!\brief The difference to the left neighbour, i.e. -1, 0 or 1.
+        int64_t horizontal{};
+    };
+
+    //!\brief Throws seqan3::invalid_alignment_configuration for the current band and the given cause.
+    [[noreturn]] void throw_invalid_band(std::string const & error_cause) const
+    {
+        throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower_diagonal) + ":" +
+                                              std::to_string(upper_diagonal) + "] cannot be used with the current "
+                                              "alignment configuration:" + error_cause};
+    }
+
+    //!\brief Checks whether the band reaches the end of the alignment matrix.
+    void check_valid_band(int64_t const database_size, int64_t const query_size) const
+    {
+        // The last column is never free, the last row only in the semi-global alignment.
+        if ((query_size - database_size > -lower_diagonal) ||
+            (!is_semi_global && database_size - query_size > upper_diagonal))
+            throw_invalid_band(" The band ends in a region without free gaps.");
+    }
+
+    //!\brief Encodes the query as bit-vectors and resets the vertical deltas.
+    template <typename query_t>
+    void initialise(query_t && query, size_t const symbol_count)
+    {
+        using alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+
+        size_t const query_size = std::ranges::distance(query);
+        block_count = (query_size + word_size - 1) / word_size;
+
+        // Initially, and whenever a row enters the band from below, the vertical delta is +1.
+        vp.assign(block_count, ~word_type{0u});
+        vn.assign(block_count, 0u);
+        bit_masks.assign(symbol_count * block_count, 0u);
+
+        size_t position = 0;
+        for (auto && symbol : query)
+        {
+            bit_masks[seqan3::to_rank(static_cast<alphabet_t>(symbol)) * block_count + position / word_size] |=
+                word_type{1u} << (position % word_size);
+            ++position;
+        }
+    }
+
+    /*!\brief Computes the rows `[first_row, last_row]` of the next column.
+     * \param[in] rank The rank of the current database symbol.
+     * \param[in] first_row The first row of the band in this column; must be at least 1.
+     * \param[in] last_row The last row of the band in this column.
+     * \param[in] hin The horizontal delta above the first row, i.e. 0 or 1.
+     * \returns The deltas of the cell in the last row.
+     */
+    column_delta compute_column(size_t const rank, int64_t const first_row, int64_t const last_row, word_type const hin)
+    {
+        size_t const first_block = (first_row - 1) / word_size;
+        size_t const last_block = (last_row - 1) / word_size;
+
+        column_delta delta{};
+        word_type carry_d0 = 0u;
+        word_type carry_hp = 0u;
+        word_type carry_hn = 0u;
+
+        for (size_t block = first_block; block <= last_block; ++block)
+        {
+            word_type b = bit_masks[rank * block_count + block];
+            word_type & vp_block = vp[block];
+            word_type & vn_block = vn[block];
+            word_type hin_mask = 0u;
+
+            if (block == first_block)
+            {
+                // Rows above the band neither produce a carry nor a horizontal delta for the first band row, which
+                // receives hin instead.
+                size_t const shift = (first_row - 1) % word_size;
+                word_type const above_band = (word_type{1u} << shift) - 1u;
+                vp_block |= above_band;
+                vn_block &= ~above_band;
+                b &= ~above_band;
+                hin_mask = hin << shift;
+            }
+
+            word_type x = b | vn_block;
+            word_type const t = vp_block + (x & vp_block) + carry_d0;
+            word_type const d0 = (t ^ vp_block) | x;
+            word_type const hn = vp_block & d0;
+            word_type const hp = vn_block | ~(vp_block | d0);
+
+            carry_d0 = carry_d0 ? t <= vp_block : t < vp_block;
+
+            x = (hp << 1u) | carry_hp | hin_mask;
+            vn_block = x & d0;
+            vp_block = (hn << 1u) | ~(x | d0) | carry_hn;
+
+            carry_hp = hp >> (word_size - 1);
+            carry_hn = hn >> (word_size - 1);
+
+            if (block == last_block)
+            {
+                size_t const shift = (last_row - 1) % word_size;
+                word_type const last_row_mask = word_type{1u} << shift;
+                delta.diagonal = (d0 & last_row_mask) ? 0 : 1;
+                delta.horizontal = (hp & last_row_mask) ? 1 : ((hn & last_row_mask) ? -1 : 0);
+
+                // Rows below the band must enter it with a vertical delta of +1.
+                word_type const below_band = (shift + 1 == word_size) ? 0u : ~word_type{0u} << (shift + 1);
+                vp_block |= below_band;
+                vn_block &= ~below_band;
+            }
+        }
+
+        return delta;
+    }
+};
+
+} // namespace seqan3::detail
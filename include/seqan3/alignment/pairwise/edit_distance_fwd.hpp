@@ -15,6 +15,7 @@
 #include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
+#include <seqan3/alignment/configuration/align_config_all_hits.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
@@ -93,6 +94,8 @@ struct default_edit_distance_trait_type
     //!\brief When true the computation will use the ukkonen trick with the last active cell and bounds the error to
     //!       config.max_errors.
     static constexpr bool use_max_errors = align_config_type::template exists<align_cfg::min_score>();
+    //!\brief When true every end position in the last row whose score is within config.max_errors is reported.
+    static constexpr bool report_all_hits = align_config_type::template exists<align_cfg::all_hits>();
     //!\brief Whether the alignment is a semi-global alignment or not.
     static constexpr bool is_semi_global = is_semi_global_t::value;
     //!\brief Whether the alignment is a global alignment or not.
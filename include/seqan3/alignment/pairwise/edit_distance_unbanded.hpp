@@ -146,9 +146,12 @@ protected:
     }
 
     /*!\brief Use the ukkonen trick and update the last active cell.
+     * \tparam hit_sink_t The type of the hit sink.
+     * \param[in] hit_sink The sink that is passed to the derived type if a hit was found.
      * \returns `true` if computation should be aborted, `false` if computation should continue.
      */
-    bool update_last_active_cell() noexcept
+    template <typename hit_sink_t>
+    bool update_last_active_cell(hit_sink_t & hit_sink)
     {
         derived_t * self = static_cast<derived_t *>(this);
         // update the last active cell
@@ -172,7 +175,7 @@ protected:
             if constexpr(edit_traits::is_semi_global)
                 self->update_best_score();
 
-            return self->on_hit();
+            return self->on_hit(hit_sink);
         }
         else
         {
@@ -409,6 +412,117 @@ protected:
     //!\}
 };
 
+/*!\brief Only available when default_edit_distance_trait_type::report_all_hits is true.
+ * \extends default_edit_distance_trait_type
+ *
+ * \details
+ *
+ * Reports every column of the last row whose score is within the max_errors. If only the local maxima are requested,
+ * a hit is held back until the score of the next column is known.
+ */
+template <typename derived_t, typename edit_traits>
+class edit_distance_unbanded_all_hits_policy :
+//!\cond
+    edit_traits
+//!\endcond
+{
+protected:
+    static_assert(edit_traits::report_all_hits, "This policy assumes that edit_traits::report_all_hits is true.");
+    static_assert(edit_traits::is_semi_global && edit_traits::use_max_errors,
+                  "This policy assumes that edit_traits::is_semi_global and edit_traits::use_max_errors are true.");
+
+    //!\brief Befriends the derived type.
+    friend derived_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_all_hits_policy() noexcept = default;  //!< Defaulted.
+    edit_distance_unbanded_all_hits_policy(edit_distance_unbanded_all_hits_policy const &) noexcept
+        = default; //!< Defaulted.
+    edit_distance_unbanded_all_hits_policy(edit_distance_unbanded_all_hits_policy &&) noexcept
+        = default; //!< Defaulted.
+    edit_distance_unbanded_all_hits_policy & operator=(edit_distance_unbanded_all_hits_policy const &) noexcept
+        = default; //!< Defaulted.
+    edit_distance_unbanded_all_hits_policy & operator=(edit_distance_unbanded_all_hits_policy &&) noexcept
+        = default; //!< Defaulted.
+    ~edit_distance_unbanded_all_hits_policy() noexcept = default; //!< Defaulted.
+    //!\}
+
+    //!\copydoc default_edit_distance_trait_type::score_type
+    using typename edit_traits::score_type;
+
+    /*!\name All Hits Policy: Protected Attributes
+     * \copydoc edit_distance_unbanded_all_hits_policy
+     * \{
+     */
+    //!\brief The index of the column in which a hit is found next; advanced with every computed column.
+    size_t current_column{};
+    //!\brief Whether only the local maxima of the score are reported.
+    bool local_maxima_only{false};
+    //!\brief Whether a hit was found before.
+    bool has_last_hit{false};
+    //!\brief Whether the last hit is a local maximum if the next column is no better hit.
+    bool has_pending_hit{false};
+    //!\brief The column of the last hit.
+    size_t last_hit_column{};
+    //!\brief The score of the last hit.
+    score_type last_hit_score{};
+    //!\}
+
+    /*!\name All Hits Policy: Protected Member Functions
+     * \copydoc edit_distance_unbanded_all_hits_policy
+     * \{
+     */
+    //!\brief Initialises all hits policy.
+    void all_hits_init() noexcept
+    {
+        derived_t const * self = static_cast<derived_t const *>(this);
+        local_maxima_only = get<align_cfg::all_hits>(self->config).local_maxima_only;
+    }
+
+    /*!\brief Reports the hit in the given column, or holds it back until the next column is known.
+     * \tparam hit_sink_t The type of the hit sink; must model std::invocable with the column and the score.
+     * \param[in] column The column of the hit.
+     * \param[in] score The score of the hit.
+     * \param[in] hit_sink The sink that is invoked with the column and the score of every reported hit.
+     */
+    template <typename hit_sink_t>
+    void report_hit(size_t const column, score_type const score, hit_sink_t & hit_sink)
+    {
+        if (!local_maxima_only)
+        {
+            hit_sink(column, score);
+            return;
+        }
+
+        // The previous hit is a local maximum if the current column is not its neighbour or has a higher edit distance.
+        bool const is_neighbour = has_last_hit && last_hit_column + 1u == column;
+        if (has_pending_hit && (!is_neighbour || last_hit_score < score))
+            hit_sink(last_hit_column, last_hit_score);
+
+        has_pending_hit = !is_neighbour || score <= last_hit_score;
+        has_last_hit = true;
+        last_hit_column = column;
+        last_hit_score = score;
+    }
+
+    /*!\brief Reports the hit that was held back for the last column.
+     * \tparam hit_sink_t The type of the hit sink; must model std::invocable with the column and the score.
+     * \param[in] hit_sink The sink that is invoked with the column and the score of the held back hit.
+     */
+    template <typename hit_sink_t>
+    void finish_hits(hit_sink_t & hit_sink)
+    {
+        if (has_pending_hit)
+            hit_sink(last_hit_column, last_hit_score);
+
+        has_last_hit = false;
+        has_pending_hit = false;
+    }
+    //!\}
+};
+
 /*!\brief Only available when default_edit_distance_trait_type::compute_score_matrix is true.
  * \extends default_edit_distance_trait_type
  */
@@ -676,6 +790,7 @@ private:
  * \extends edit_distance_unbanded_score_matrix_policy
  * \extends edit_distance_unbanded_trace_matrix_policy
  * \extends edit_distance_unbanded_max_errors_policy
+ * \extends edit_distance_unbanded_all_hits_policy
  */
 template <std::ranges::viewable_range database_t,
           std::ranges::viewable_range query_t,
@@ -708,6 +823,11 @@ class edit_distance_unbanded :
         edit_traits::compute_trace_matrix,
         edit_distance_unbanded_trace_matrix_policy,
         edit_traits,
+        edit_distance_unbanded<database_t, query_t, align_config_t, edit_traits>>,
+    public edit_distance_base<
+        edit_traits::report_all_hits,
+        edit_distance_unbanded_all_hits_policy,
+        edit_traits,
         edit_distance_unbanded<database_t, query_t, align_config_t, edit_traits>>
 //!\endcond
 {
@@ -735,11 +855,15 @@ private:
     //!\brief Allows seqan3::detail::edit_distance_unbanded_trace_matrix_policy to access this class.
     template <typename other_derived_t, typename other_edit_traits>
     friend class edit_distance_unbanded_trace_matrix_policy;
+    //!\brief Allows seqan3::detail::edit_distance_unbanded_all_hits_policy to access this class.
+    template <typename other_derived_t, typename other_edit_traits>
+    friend class edit_distance_unbanded_all_hits_policy;
 
     using typename edit_traits::database_iterator;
     using typename edit_traits::query_alphabet_type;
     using typename edit_traits::alignment_result_type;
     using edit_traits::use_max_errors;
+    using edit_traits::report_all_hits;
     using edit_traits::is_semi_global;
     using edit_traits::is_global;
     using edit_traits::compute_score;
@@ -830,6 +954,9 @@ private:
     //!\brief Add a computation step
     void add_state()
     {
+        if constexpr(report_all_hits)
+            ++this->current_column;
+
         if constexpr(!use_max_errors && compute_score_matrix)
             this->_score_matrix.add_column(vp, vn);
 
@@ -885,6 +1012,9 @@ public:
         if constexpr(use_max_errors)
             this->max_errors_init(block_count);
 
+        if constexpr(report_all_hits)
+            this->all_hits_init();
+
         if constexpr(compute_score_matrix)
             this->score_matrix_init();
 
@@ -964,21 +1094,30 @@ private:
             _score--;
     }
 
-    //!\brief Will be called if a hit was found (e.g., score <= max_errors).
-    bool on_hit() noexcept
+    /*!\brief Will be called if a hit was found (e.g., score <= max_errors).
+     * \tparam hit_sink_t The type of the hit sink.
+     * \param[in] hit_sink The sink that is invoked with the column and the score of every reported hit.
+     */
+    template <typename hit_sink_t>
+    bool on_hit([[maybe_unused]] hit_sink_t & hit_sink)
     {
-        // TODO: call external on_hit functor
+        if constexpr(report_all_hits)
+            this->report_hit(this->current_column, _score, hit_sink);
+
         return false;
     }
 
     //!\brief Pattern is small enough that it fits into one machine word. Use faster computation with less overhead.
-    inline bool small_patterns();
+    template <typename hit_sink_t>
+    inline bool small_patterns(hit_sink_t & hit_sink);
 
     //!\brief Pattern is larger than one machine word. Use overflow aware computation.
-    inline bool large_patterns();
+    template <typename hit_sink_t>
+    inline bool large_patterns(hit_sink_t & hit_sink);
 
     //!\brief Special case if query sequence is empty.
-    inline void compute_empty_query_sequence()
+    template <typename hit_sink_t>
+    inline void compute_empty_query_sequence([[maybe_unused]] hit_sink_t & hit_sink)
     {
         assert(std::ranges::empty(query));
 
@@ -993,7 +1132,7 @@ private:
 
             // call on_hit
             if constexpr(use_max_errors)
-                abort_computation = on_hit();
+                abort_computation = on_hit(hit_sink);
 
             this->add_state();
             if (abort_computation)
@@ -1001,8 +1140,13 @@ private:
         }
     }
 
-    //!\brief Compute the alignment.
-    void compute()
+    /*!\brief Compute the alignment.
+     * \tparam hit_sink_t The type of the hit sink.
+     * \param[in] hit_sink The sink that is invoked with the column and the score of every reported hit; only used if
+     *                     #report_all_hits is `true`.
+     */
+    template <typename hit_sink_t>
+    void compute([[maybe_unused]] hit_sink_t & hit_sink)
     {
         // limit search width for prefix search (if no matrix needs to be computed)
         if constexpr(use_max_errors && is_global && !compute_matrix)
@@ -1022,15 +1166,22 @@ private:
             database_it_end -= std::ranges::size(database) - haystack_length;
         }
 
+        // The first column is a hit if the entire query can be deleted within max_errors.
+        if constexpr(report_all_hits)
+        {
+            if (std::ranges::size(query) <= static_cast<size_t>(this->max_errors))
+                this->report_hit(0u, std::ranges::size(query), hit_sink);
+        }
+
         // distinguish between the version for needles not longer than
         // one machine word and the version for longer needles
         // A special cases is if the second sequence is empty (vp.size() == 0u).
         if (vp.size() == 0u) // [[unlikely]]
-            compute_empty_query_sequence();
+            compute_empty_query_sequence(hit_sink);
         else if (vp.size() == 1u)
-            small_patterns();
+            small_patterns(hit_sink);
         else
-            large_patterns();
+            large_patterns(hit_sink);
 
         if constexpr(is_global)
             this->update_best_score();
@@ -1047,7 +1198,37 @@ public:
         using traits_type = alignment_configuration_traits<align_config_t>;
         using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
 
-        compute();
+        // Every hit is reported as a separate alignment result while the matrix is computed.
+        if constexpr (report_all_hits)
+        {
+            auto hit_sink = [&] (size_t const column, score_type const score)
+            {
+                result_value_type res_vt{};
+
+                if constexpr (traits_type::output_sequence1_id)
+                    res_vt.sequence1_id = idx;
+
+                if constexpr (traits_type::output_sequence2_id)
+                    res_vt.sequence2_id = idx;
+
+                if constexpr (traits_type::compute_score)
+                    res_vt.score = -score;
+
+                if constexpr (traits_type::compute_end_positions)
+                    res_vt.end_positions = alignment_coordinate{column_index_type{column},
+                                                                row_index_type{std::ranges::size(query)}};
+
+                callback(alignment_result_type{std::move(res_vt)});
+            };
+
+            compute(hit_sink);
+            this->finish_hits(hit_sink);
+            return;
+        }
+
+        // Without report_all_hits no hit is passed to the sink.
+        auto no_hit_sink = [] (size_t, score_type) {};
+        compute(no_hit_sink);
 
         // First cache the begin and end positions if enabled by the edit distance traits.
         // Note, that they might be activated even if the user did not configure them, but in order to
@@ -1101,7 +1282,9 @@ public:
 };
 
 template <typename database_t, typename query_t, typename align_config_t, typename traits_t>
-bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::small_patterns()
+template <typename hit_sink_t>
+bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::small_patterns(
+    [[maybe_unused]] hit_sink_t & hit_sink)
 {
     bool abort_computation = false;
 
@@ -1120,7 +1303,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::smal
 
         // updating the last active cell
         if constexpr(use_max_errors)
-            abort_computation = this->update_last_active_cell();
+            abort_computation = this->update_last_active_cell(hit_sink);
 
         add_state();
         ++database_it;
@@ -1132,7 +1315,9 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::smal
 }
 
 template <typename database_t, typename query_t, typename align_config_t, typename traits_t>
-bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::large_patterns()
+template <typename hit_sink_t>
+bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::large_patterns(
+    [[maybe_unused]] hit_sink_t & hit_sink)
 {
     bool abort_computation = false;
 
@@ -1174,7 +1359,7 @@ bool edit_distance_unbanded<database_t, query_t, align_config_t, traits_t>::larg
             }
 
             // updating the last active cell
-            abort_computation = this->update_last_active_cell();
+            abort_computation = this->update_last_active_cell(hit_sink);
         }
 
         add_state();
@@ -0,0 +1,259 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_unbanded_simd.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the edit distance of several short queries at once with Myers' bit-vector algorithm.
+ * \ingroup pairwise_alignment
+ *
+ * \tparam word_simd_t The simd vector type whose lanes store the bit-vectors; must model seqan3::simd::simd_concept
+ *                     with an unsigned scalar type.
+ * \tparam alphabet_t The alphabet type of the query sequences; must model seqan3::semialphabet.
+ * \tparam is_semi_global Whether leading and trailing gaps in the database sequence are free.
+ *
+ * \details
+ *
+ * Every lane of the simd vectors holds the bit-vectors of one query, such that the query must not be longer than the
+ * number of bits of the scalar type. Myers' recurrence is then computed for all lanes with the same sequence of simd
+ * instructions. Each lane is aligned against its own database sequence, whose symbols are selected per lane when the
+ * match masks of the current column are gathered. Lanes with a shorter database sequence keep their score once their
+ * last column is reached.
+ *
+ * The lanes are filled with seqan3::detail::edit_distance_unbanded_simd::add_lane and evaluated with
+ * seqan3::detail::edit_distance_unbanded_simd::compute. Afterwards, the edit distance and the column of the optimal
+ * end position can be queried per lane. Like seqan3::detail::edit_distance_unbanded, the last column with the optimal
+ * score is reported in the semi-global case.
+ */
+template <simd::simd_concept word_simd_t, semialphabet alphabet_t, bool is_semi_global>
+class edit_distance_unbanded_simd
+{
+public:
+    //!\brief The scalar type of one lane.
+    using word_type = typename simd_traits<word_simd_t>::scalar_type;
+
+    static_assert(std::is_unsigned_v<word_type>, "The word type of edit_distance_unbanded_simd must be unsigned.");
+
+    //!\brief The number of queries that are computed at once.
+    static constexpr size_t lane_count = simd_traits<word_simd_t>::length;
+    //!\brief The maximal size of a query.
+    static constexpr size_t max_query_size = bits_of<word_type>;
+
+private:
+    //!\brief The number of symbols; the additional symbol marks columns after the end of a database sequence.
+    static constexpr size_t symbol_count = alphabet_size<alphabet_t> + 1;
+    //!\brief The rank that is stored for columns after the end of a database sequence.
+    static constexpr size_t padding_rank = alphabet_size<alphabet_t>;
+
+    //!\brief The match masks of every symbol for all lanes.
+    std::vector<word_simd_t> bit_masks{};
+    //!\brief The ranks of the database symbols stored column by column with one entry per lane.
+    std::vector<uint32_t> database_ranks{};
+    //!\brief The ranks of the query symbols of all lanes.
+    std::array<std::array<uint32_t, max_query_size>, lane_count> query_ranks{};
+    //!\brief The database sizes of all lanes.
+    std::array<size_t, lane_count> database_sizes{};
+    //!\brief The query sizes of all lanes.
+    std::array<size_t, lane_count> query_sizes{};
+    //!\brief The computed edit distances of all lanes.
+    std::array<size_t, lane_count> scores{};
+    //!\brief The computed end columns of all lanes.
+    std::array<size_t, lane_count> end_columns{};
+    //!\brief The number of lanes that are in use.
+    size_t used_lanes{};
+    //!\brief The maximal database size of all lanes.
+    size_t max_database_size{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_simd() = default; //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd const &) = default; //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd &&) = default; //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd const &) = default; //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd &&) = default; //!< Defaulted.
+    ~edit_distance_unbanded_simd() = default; //!< Defaulted.
+    //!\}
+
+    //!\brief Removes all lanes.
+    void clear() noexcept
+    {
+        used_lanes = 0;
+        max_database_size = 0;
+        database_sizes.fill(0);
+        query_sizes.fill(0);
+        database_ranks.clear();
+    }
+
+    //!\brief Returns `true` if all lanes are in use.
+    bool full() const noexcept
+    {
+        return used_lanes == lane_count;
+    }
+
+    /*!\brief Adds a sequence pair to the next free lane.
+     * \tparam database_t The type of the database sequence; must model std::ranges::forward_range.
+     * \tparam query_t The type of the query sequence; must model std::ranges::forward_range.
+     * \param[in] database The database sequence.
+     * \param[in] query The query sequence; must not be empty and not be longer than
+     *                  seqan3::detail::edit_distance_unbanded_simd::max_query_size.
+     * \returns The lane of the added sequence pair.
+     */
+    template <std::ranges::forward_range database_t, std::ranges::forward_range query_t>
+    size_t add_lane(database_t && database, query_t && query)
+    {
+        assert(!full());
+
+        size_t const lane = used_lanes++;
+
+        // Store the database ranks transposed, such that one column of all lanes is stored contiguously.
+        size_t database_size = 0;
+        for (auto && symbol : database)
+        {
+            if (database_size == max_database_size)
+            {
+                database_ranks.resize(database_ranks.size() + lane_count, padding_rank);
+                ++max_database_size;
+            }
+
+            database_ranks[database_size * lane_count + lane] = seqan3::to_rank(static_cast<alphabet_t>(symbol));
+            ++database_size;
+        }
+        database_sizes[lane] = database_size;
+
+        size_t query_size = 0;
+        for (auto && symbol : query)
+        {
+            assert(query_size < max_query_size);
+            query_ranks[lane][query_size] = seqan3::to_rank(static_cast<alphabet_t>(symbol));
+            ++query_size;
+        }
+
+        assert(query_size > 0 && query_size <= max_query_size);
+        query_sizes[lane] = query_size;
+
+        return lane;
+    }
+
+    /*!\brief Computes the edit distance for all lanes.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the maximal database size of all lanes.
+     */
+    void compute()
+    {
+        initialise_bit_masks();
+
+        word_simd_t const zero = simd::fill<word_simd_t>(0);
+        word_simd_t const one = simd::fill<word_simd_t>(1);
+        // The first row is 0 in the semi-global alignment and increases by one per column in the global alignment.
+        word_simd_t const hp0 = is_semi_global ? zero : one;
+
+        word_simd_t vp = ~zero;
+        word_simd_t vn = zero;
+        word_simd_t score_mask{};
+        word_simd_t score{};
+        word_simd_t database_size{};
+        for (size_t lane = 0; lane < lane_count; ++lane)
+        {
+            score_mask[lane] = (lane < used_lanes) ? word_type{1u} << (query_sizes[lane] - 1u) : 0u;
+            score[lane] = query_sizes[lane];
+            database_size[lane] = database_sizes[lane];
+        }
+
+        word_simd_t best_score = score;
+        word_simd_t best_column = zero;
+        word_simd_t column = zero;
+
+        for (size_t current_column = 0; current_column < max_database_size; ++current_column)
+        {
+            // Gather the match masks of the current database symbol of every lane.
+            word_simd_t b{};
+            uint32_t const * ranks = database_ranks.data() + current_column * lane_count;
+            for (size_t lane = 0; lane < lane_count; ++lane)
+                b[lane] = bit_masks[ranks[lane]][lane];
+
+            word_simd_t x = b | vn;
+            word_simd_t const t = vp + (x & vp);
+            word_simd_t const d0 = (t ^ vp) | x;
+            word_simd_t const hn = vp & d0;
+            word_simd_t const hp = vn | ~(vp | d0);
+
+            x = (hp << 1u) | hp0;
+            vn = x & d0;
+            vp = (hn << 1u) | ~(x | d0);
+
+            // Only lanes whose database sequence is not exhausted update their score.
+            auto const is_active = column < database_size;
+            score = (is_active && ((hp & score_mask) != zero)) ? score + one : score;
+            score = (is_active && ((hn & score_mask) != zero)) ? score - one : score;
+            column = column + one;
+
+            if constexpr (is_semi_global)
+            {
+                auto const is_better = is_active && (score <= best_score);
+                best_score = is_better ? score : best_score;
+                best_column = is_better ? column : best_column;
+            }
+        }
+
+        for (size_t lane = 0; lane < lane_count; ++lane)
+        {
+            scores[lane] = is_semi_global ? best_score[lane] : score[lane];
+            end_columns[lane] = is_semi_global ? best_column[lane] : database_sizes[lane];
+        }
+    }
+
+    //!\brief Returns the edit distance of the given lane.
+    size_t score(size_t const lane) const noexcept
+    {
+        assert(lane < used_lanes);
+        return scores[lane];
+    }
+
+    //!\brief Returns the column of the end position in the database sequence of the given lane.
+    size_t end_column(size_t const lane) const noexcept
+    {
+        assert(lane < used_lanes);
+        return end_columns[lane];
+    }
+
+private:
+    //!\brief Encodes the symbols of all queries as bit-vectors.
+    void initialise_bit_masks()
+    {
+        bit_masks.assign(symbol_count, simd::fill<word_simd_t>(0));
+
+        for (size_t lane = 0; lane < used_lanes; ++lane)
+            for (size_t position = 0; position < query_sizes[lane]; ++position)
+                bit_masks[query_ranks[lane][position]][lane] |= word_type{1u} << position;
+    }
+};
+
+} // namespace seqan3::detail
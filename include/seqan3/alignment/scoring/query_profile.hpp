@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::query_profile.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Stores the substitution scores of a query sequence against every symbol of the target alphabet.
+ * \ingroup scoring
+ * \tparam query_alphabet_t The alphabet type of the query sequence; must model seqan3::semialphabet.
+ * \tparam target_alphabet_t The alphabet type of the target sequences; must model seqan3::semialphabet.
+ * \tparam score_t The type of the scores; must model seqan3::arithmetic.
+ *
+ * \details
+ *
+ * The query profile stores for every symbol of the target alphabet the scores against all positions of the query
+ * sequence, such that an alignment algorithm can look up the scores of one target symbol contiguously instead of
+ * invoking the scoring scheme for every cell. The profile is stored in two layouts:
+ *
+ *  * The scalar layout stores for every target symbol the scores of the query positions in their natural order
+ *    (see seqan3::query_profile::scalar_scores).
+ *  * The striped layout stores the scores in the simd layout of the striped alignment of Farrar: the query is
+ *    divided into `L` segments of length `s = ceil(m / L)`, where `L` is the number of lanes of the simd vector over
+ *    `score_t` and `m` is the length of the query, and the `k`-th simd vector contains the scores of the positions
+ *    `k`, `s + k`, ..., `(L-1)s + k` (see seqan3::query_profile::striped_scores). The positions beyond the end of
+ *    the query are scored with `0`.
+ *
+ * Computing the profile costs \f$ O(σ*m) \f$ time and space, where σ is the size of the target alphabet.
+ * The striped alignment (seqan3::align_cfg::vectorised_striped) usually computes the profile for every sequence pair.
+ * When one query is aligned against many targets, e.g. when scanning a protein database, the profile can be computed
+ * once and passed to the alignment with seqan3::align_cfg::query_profile instead.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * seqan3::aminoacid_scoring_scheme scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62};
+ * seqan3::query_profile profile{query, scheme};
+ *
+ * auto cfg = seqan3::align_cfg::method_local{} |
+ *            seqan3::align_cfg::scoring_scheme{scheme} |
+ *            seqan3::align_cfg::vectorised_striped{} |
+ *            seqan3::align_cfg::query_profile{profile} |
+ *            seqan3::align_cfg::output_score{};
+ *
+ * // The query is the second sequence of every pair.
+ * for (auto && target : database)
+ *     auto results = seqan3::align_pairwise(std::tie(target, query), cfg);
+ * ```
+ */
+template <semialphabet query_alphabet_t,
+          semialphabet target_alphabet_t = query_alphabet_t,
+          arithmetic score_t = int32_t>
+class query_profile
+{
+public:
+    //!\brief The alphabet type of the query sequence.
+    using query_alphabet_type = query_alphabet_t;
+    //!\brief The alphabet type of the target sequences.
+    using target_alphabet_type = target_alphabet_t;
+    //!\brief The type of the scores.
+    using score_type = score_t;
+    //!\brief The simd vector type of the striped layout.
+    using simd_score_type = simd_type_t<score_t>;
+
+    //!\brief The number of lanes of the simd vector of the striped layout.
+    static constexpr size_t lane_count = simd_traits<simd_score_type>::length;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    query_profile() = default; //!< Defaulted.
+    query_profile(query_profile const &) = default; //!< Defaulted.
+    query_profile(query_profile &&) = default; //!< Defaulted.
+    query_profile & operator=(query_profile const &) = default; //!< Defaulted.
+    query_profile & operator=(query_profile &&) = default; //!< Defaulted.
+    ~query_profile() = default; //!< Defaulted.
+
+    /*!\brief Computes the profile of the given query with the given scoring scheme.
+     * \tparam query_t The type of the query; must model std::ranges::forward_range over `query_alphabet_t`.
+     * \tparam scoring_scheme_t The type of the scoring scheme; must model seqan3::scoring_scheme_for the target
+     *                          and the query alphabet.
+     *
+     * \param[in] query The query sequence; a copy is stored in the profile.
+     * \param[in] scoring_scheme The scoring scheme used to compute the scores.
+     *
+     * \throws std::invalid_argument if a score of the scoring scheme cannot be represented by `score_t`.
+     */
+    template <std::ranges::forward_range query_t, typename scoring_scheme_t>
+    //!\cond
+        requires std::same_as<std::ranges::range_value_t<query_t>, query_alphabet_t> &&
+                 scoring_scheme_for<scoring_scheme_t, target_alphabet_t, query_alphabet_t>
+    //!\endcond
+    query_profile(query_t && query, scoring_scheme_t const & scoring_scheme)
+    {
+        std::ranges::copy(query, std::cpp20::back_inserter(query_sequence));
+        size_t const query_size = query_sequence.size();
+
+        scalar_profile.resize(target_alphabet_size * query_size);
+        striped_segment_length = (query_size + lane_count - 1) / lane_count;
+        striped_profile.assign(target_alphabet_size * striped_segment_length, simd::fill<simd_score_type>(0));
+
+        for (size_t rank = 0; rank < target_alphabet_size; ++rank)
+        {
+            target_alphabet_t const target_symbol = assign_rank_to(rank, target_alphabet_t{});
+            score_t * scalar_scores = scalar_profile.data() + rank * query_size;
+            simd_score_type * striped_scores = striped_profile.data() + rank * striped_segment_length;
+
+            for (size_t row = 0; row < query_size; ++row)
+            {
+                score_t const score = convert_score(scoring_scheme.score(target_symbol, query_sequence[row]));
+                scalar_scores[row] = score;
+                striped_scores[row % striped_segment_length][row / striped_segment_length] = score;
+            }
+        }
+    }
+    //!\}
+
+    //!\brief Returns the length of the query sequence.
+    size_t size() const noexcept
+    {
+        return query_sequence.size();
+    }
+
+    //!\brief Returns the stored query sequence.
+    std::span<query_alphabet_t const> query() const noexcept
+    {
+        return query_sequence;
+    }
+
+    /*!\brief Returns the scores of the given target symbol against all query positions in the scalar layout.
+     * \param[in] symbol The target symbol.
+     * \returns A span over seqan3::query_profile::size many scores.
+     */
+    std::span<score_t const> scalar_scores(target_alphabet_t const symbol) const noexcept
+    {
+        return {scalar_profile.data() + to_rank(symbol) * size(), size()};
+    }
+
+    //!\brief Returns the number of simd vectors per target symbol in the striped layout.
+    size_t segment_length() const noexcept
+    {
+        return striped_segment_length;
+    }
+
+    /*!\brief Returns the scores of the given target symbol against all query positions in the striped layout.
+     * \param[in] symbol The target symbol.
+     * \returns A span over seqan3::query_profile::segment_length many simd vectors.
+     */
+    std::span<simd_score_type const> striped_scores(target_alphabet_t const symbol) const noexcept
+    {
+        return {striped_profile.data() + to_rank(symbol) * striped_segment_length, striped_segment_length};
+    }
+
+    /*!\brief Returns whether this profile was computed for the given query.
+     * \param[in] query The query to compare with the stored query.
+     *
+     * \details
+     *
+     * Linear in the size of the query, which is cheaper than computing the profile by a factor of the size of the
+     * target alphabet.
+     */
+    template <std::ranges::forward_range query_t>
+    bool is_profile_of(query_t && query) const
+    {
+        return std::ranges::equal(query, query_sequence);
+    }
+
+private:
+    //!\brief The size of the target alphabet.
+    static constexpr size_t target_alphabet_size = alphabet_size<target_alphabet_t>;
+
+    //!\brief Converts the score of the scoring scheme into `score_t`.
+    template <typename original_score_t>
+    static score_t convert_score(original_score_t const score)
+    {
+        // The score can only exceed the value range if score_t is smaller than the score type of the scoring scheme.
+        if constexpr (sizeof(score_t) < sizeof(original_score_t))
+        {
+            if (score > static_cast<original_score_t>(std::numeric_limits<score_t>::max()) ||
+                score < static_cast<original_score_t>(std::numeric_limits<score_t>::lowest()))
+                throw std::invalid_argument{"The selected scoring scheme score overflows the score type of the "
+                                            "query profile."};
+        }
+
+        return static_cast<score_t>(score);
+    }
+
+    //!\brief The query sequence.
+    std::vector<query_alphabet_t> query_sequence{};
+    //!\brief The scores in the scalar layout.
+    std::vector<score_t> scalar_profile{};
+    //!\brief The scores in the striped layout.
+    std::vector<simd_score_type, aligned_allocator<simd_score_type, alignof(simd_score_type)>> striped_profile{};
+    //!\brief The number of simd vectors per target symbol in the striped layout.
+    size_t striped_segment_length{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::query_profile
+ * \{
+ */
+
+//!\brief Deduces the query alphabet from the query; the target alphabet is the query alphabet.
+template <std::ranges::forward_range query_t, typename scoring_scheme_t>
+query_profile(query_t &&, scoring_scheme_t const &) -> query_profile<std::ranges::range_value_t<query_t>>;
+//!\}
+
+} // namespace seqan3
@@ -22,6 +22,7 @@
   #pragma warning "Remove #include <seqan3/core/algorithm/bound.hpp> from this header."
 #endif
 #include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/algorithm/thread_pool.hpp>
 #include <seqan3/core/configuration/all.hpp>
 #if SEQAN3_VERSION_MAJOR == 3 && SEQAN3_VERSION_MINOR == 1
   #pragma warning "Remove #include <seqan3/core/configuration/all.hpp> from this header."
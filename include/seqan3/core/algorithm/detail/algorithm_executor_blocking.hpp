@@ -19,6 +19,7 @@
 
 #include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
 
 namespace seqan3::detail
 {
@@ -162,7 +163,7 @@ public:
         resource_it{std::ranges::begin(this->resource)},
         algorithm{std::move(algorithm)}
     {
-        if constexpr (std::same_as<execution_handler_t, execution_handler_parallel>)
+        if constexpr (!std::same_as<execution_handler_t, execution_handler_sequential>)
             buffer_size = static_cast<size_t>(std::ranges::distance(resource));
 
         buffer.resize(buffer_size);
@@ -0,0 +1,273 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::algorithm_executor_streaming.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <seqan3/std/concepts>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <seqan3/std/ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief An algorithm executor that streams the algorithm results in the order in which they are completed.
+ * \ingroup algorithm
+ * \tparam resource_t The underlying range of elements to be computed; must model std::ranges::viewable_range
+ *                    and std::ranges::forward_range.
+ * \tparam algorithm_t The algorithm to be invoked on the elements of the given resource; must model std::semiregular.
+ * \tparam algorithm_result_t The result type generated by the algorithm; must model std::semiregular.
+ * \tparam execution_handler_t The execution handler managing the parallel execution of the algorithms.
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::algorithm_executor_blocking, this executor does not preserve the order of the
+ * results. On the first call to seqan3::detail::algorithm_executor_streaming::next_result, a producer thread submits
+ * all elements of the resource to the execution handler. The callback passed to the algorithm pushes every result
+ * into a queue of a fixed size, from which seqan3::detail::algorithm_executor_streaming::next_result pops the results
+ * as soon as they are available. A full queue blocks the threads of the execution handler, such that at most
+ * `buffer_size` results are buffered at any time.
+ *
+ * With seqan3::detail::execution_handler_work_stealing, the threads may belong to a seqan3::thread_pool that is shared
+ * with other algorithm invocations, which are computed one after the other. A thread of the pool must therefore never
+ * wait for the consumer of this executor, since the consumer might wait for another invocation on the same pool. The
+ * producer thread submits the resource in batches of at most `buffer_size` elements instead. A result that does not
+ * fit into the full queue is parked and pushed into the queue by the producer thread after the batch has been
+ * computed, i.e. after the pool has been released. At most the results of one batch are parked at any time.
+ *
+ * \note Every batch ends with a barrier: the threads of the pool idle while the producer thread waits for the
+ *       slowest element of the batch and pushes the parked results. The execution handler computes a batch within
+ *       seqan3::detail::execution_handler_work_stealing::wait, which blocks the producer thread, so the next batch
+ *       cannot be submitted before the current one is completed. A larger `buffer_size` reduces the number of
+ *       barriers at the cost of more buffered results.
+ *
+ * If the executor is destroyed before all results have been consumed, the queue is closed and the elements of the
+ * resource whose computation has not been started yet are skipped.
+ *
+ * ### Exception
+ *
+ * An exception thrown by the algorithm is rethrown by seqan3::detail::algorithm_executor_streaming::next_result after
+ * all results computed before have been consumed.
+ */
+template <std::ranges::viewable_range resource_t,
+          std::semiregular algorithm_t,
+          std::semiregular algorithm_result_t,
+          typename execution_handler_t = execution_handler_work_stealing>
+//!\cond
+    requires std::ranges::forward_range<resource_t> &&
+             std::invocable<algorithm_t, std::ranges::range_reference_t<resource_t>,
+                                         std::function<void(algorithm_result_t)>>
+//!\endcond
+class algorithm_executor_streaming
+{
+private:
+    //!\brief The underlying resource type.
+    using resource_type = std::views::all_t<resource_t>;
+
+    /*!\brief The state shared with the producer thread; stored on the heap to allow moving the executor.
+     *
+     * \details
+     *
+     * The destructor closes the queue, such that the waiting threads return, and joins the producer thread.
+     */
+    struct internal_state
+    {
+        //!\brief Closes the queue and waits for the producer thread.
+        ~internal_state()
+        {
+            queue.close();
+
+            if (producer.joinable())
+                producer.join();
+        }
+
+        //!\brief Submits all elements of the resource to the execution handler and closes the queue afterwards.
+        void produce()
+        {
+            try
+            {
+                // Every thread copies this algorithm; elements not yet started are skipped once the queue is closed.
+                auto skipping_algorithm = [this, algorithm = algorithm] (auto && input, auto && callback)
+                {
+                    if (!queue.is_closed())
+                        algorithm(std::forward<decltype(input)>(input), std::forward<decltype(callback)>(callback));
+                };
+
+                if constexpr (std::same_as<execution_handler_t, execution_handler_work_stealing>)
+                {
+                    // The threads of the pool never wait for the consumer, see class documentation.
+                    auto parking_callback = [this] (auto && algorithm_result)
+                    {
+                        algorithm_result_t result{std::forward<decltype(algorithm_result)>(algorithm_result)};
+
+                        // A failed push leaves the result untouched.
+                        if (queue.try_push(std::move(result)) == contrib::queue_op_status::full)
+                        {
+                            std::scoped_lock lock{parked_results_mutex};
+                            parked_results.push_back(std::move(result));
+                        }
+                    };
+
+                    auto resource_it = std::ranges::begin(resource);
+                    auto resource_end = std::ranges::end(resource);
+                    while (resource_it != resource_end && !queue.is_closed())
+                    {
+                        for (size_t count = 0; count < batch_size && resource_it != resource_end; ++count)
+                            exec_handler.execute(skipping_algorithm, *resource_it++, parking_callback);
+
+                        // Blocks until the batch is completed; the pool idles while the parked results are pushed.
+                        exec_handler.wait();
+                        push_parked_results();
+                    }
+                }
+                else // The threads belong to the execution handler of this executor.
+                {
+                    exec_handler.bulk_execute(skipping_algorithm, resource, [this] (auto && algorithm_result)
+                    {
+                        queue.wait_push(std::forward<decltype(algorithm_result)>(algorithm_result));
+                    });
+                }
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+                push_parked_results();
+            }
+
+            queue.close();
+        }
+
+        //!\brief Pushes the parked results into the queue; waits for the consumer if the queue is full.
+        void push_parked_results()
+        {
+            for (algorithm_result_t & result : parked_results)
+                queue.wait_push(std::move(result));
+
+            parked_results.clear();
+        }
+
+        //!\brief The underlying resource.
+        resource_type resource;
+        //!\brief The algorithm to invoke.
+        algorithm_t algorithm;
+        //!\brief The execution handler.
+        execution_handler_t exec_handler;
+        //!\brief The queue of computed results.
+        contrib::fixed_buffer_queue<algorithm_result_t> queue;
+        //!\brief The maximal number of elements of the resource that are submitted at once.
+        size_t batch_size{};
+        //!\brief The results that did not fit into the queue while the current batch was computed.
+        std::vector<algorithm_result_t> parked_results{};
+        //!\brief Guards the parked results.
+        std::mutex parked_results_mutex{};
+        //!\brief The thread submitting the elements of the resource.
+        std::thread producer{};
+        //!\brief The exception thrown by the algorithm.
+        std::exception_ptr exception{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only, i.e. it is not copy-constructible or copy-assignable.
+     * \{
+     */
+    //!\brief Deleted default constructor because this class manages an external resource.
+    algorithm_executor_streaming() = delete;
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_streaming(algorithm_executor_streaming const &) = delete;
+    //!\brief Defaulted.
+    algorithm_executor_streaming(algorithm_executor_streaming &&) = default;
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming const &) = delete;
+    //!\brief Defaulted.
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming &&) = default;
+    //!\brief Defaulted.
+    ~algorithm_executor_streaming() = default;
+
+    /*!\brief Constructs this executor with the given resource range.
+     *
+     * \param[in] resource The underlying resource.
+     * \param[in] algorithm The algorithm to invoke on the elements of the underlying resource.
+     * \param[in] result A dummy result object to deduce the type of the underlying buffer value.
+     * \param[in] exec_handler The execution handler to use.
+     * \param[in] buffer_size The maximal number of buffered results; must be greater than `0`.
+     *
+     * \details
+     *
+     * The computation starts with the first call to seqan3::detail::algorithm_executor_streaming::next_result.
+     */
+    algorithm_executor_streaming(resource_t resource,
+                                 algorithm_t algorithm,
+                                 algorithm_result_t const SEQAN3_DOXYGEN_ONLY(result),
+                                 execution_handler_t && exec_handler,
+                                 size_t const buffer_size) :
+        state{new internal_state{std::views::all(resource),
+                                 std::move(algorithm),
+                                 std::move(exec_handler),
+                                 contrib::fixed_buffer_queue<algorithm_result_t>{std::max<size_t>(buffer_size, 1u)},
+                                 std::max<size_t>(buffer_size, 1u)}}
+    {}
+    //!\}
+
+    /*!\brief Returns the next available algorithm result.
+     * \returns A std::optional that either contains the next algorithm result or is empty, i.e. all results have
+     *          been consumed.
+     * \throws Rethrows the exception of the algorithm if one was thrown.
+     *
+     * \details
+     *
+     * Blocks until the next result is available or all results have been consumed.
+     */
+    std::optional<algorithm_result_t> next_result()
+    {
+        assert(state != nullptr);
+
+        if (!started)
+        {
+            started = true;
+            state->producer = std::thread{[state = state.get()] () { state->produce(); }};
+        }
+
+        algorithm_result_t algorithm_result{};
+        if (state->queue.wait_pop(algorithm_result) == contrib::queue_op_status::success)
+            return {std::move(algorithm_result)};
+
+        // The queue is closed and empty, i.e. the producer has finished.
+        if (state->producer.joinable())
+            state->producer.join();
+
+        if (state->exception)
+            std::rethrow_exception(std::exchange(state->exception, nullptr));
+
+        return {std::nullopt};
+    }
+
+private:
+    //!\brief The state shared with the producer thread.
+    std::unique_ptr<internal_state> state{};
+    //!\brief Whether the computation was started.
+    bool started{false};
+};
+
+} // namespace seqan3::detail
@@ -13,5 +13,7 @@
 #pragma once
 
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
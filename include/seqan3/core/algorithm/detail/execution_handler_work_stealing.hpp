@@ -0,0 +1,268 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_work_stealing.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <seqan3/std/concepts>
+#include <memory>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/algorithm/thread_pool.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Handles the parallel execution of algorithms with work stealing.
+ * \ingroup algorithm
+ *
+ * \details
+ *
+ * This execution handler offers the same interface as seqan3::detail::execution_handler_parallel and is used for the
+ * parallel execution of the alignment and the search algorithms.
+ * A call to seqan3::detail::execution_handler_work_stealing::execute only stores the algorithm task. The stored tasks
+ * are computed by the threads of the thread pool when seqan3::detail::execution_handler_work_stealing::wait is
+ * called. All tasks of the same algorithm, input and callback type are stored in one typed batch, such that no
+ * type-erased function object must be allocated per task. Every thread works with its own copy of the algorithm,
+ * which is created once per batch instead of once per task.
+ *
+ * ### Work stealing
+ *
+ * The tasks of a batch are evenly distributed to the threads as contiguous ranges of task positions. Every thread
+ * takes the tasks from the front of its own range. A thread whose range is exhausted steals the back half of the
+ * range of another thread. The ranges are stored as a pair of 32 bit positions in a single atomic word per thread,
+ * such that taking and stealing tasks is a single compare-and-swap without any shared queue.
+ *
+ * ### Concurrency
+ *
+ * The handler either owns a seqan3::thread_pool, which is created on construction, or computes the tasks with a
+ * seqan3::thread_pool that is shared with other invocations. In both cases the handler can be used for several
+ * batches of tasks. If an algorithm task throws an exception, the first exception is rethrown by
+ * seqan3::detail::execution_handler_work_stealing::wait.
+ *
+ * \note Instances of this class are not copyable.
+ *
+ * \warning This class is only thread-safe in a single producer context. Multiple consumers are allowed.
+ *          Concurrent invocation of the interfaces are undefined behaviour.
+ */
+class execution_handler_work_stealing
+{
+private:
+    /*!\brief A batch of tasks with the same algorithm, input and callback type.
+     * \tparam algorithm_t The type of the algorithm.
+     * \tparam algorithm_input_t The type of the algorithm input; either a lvalue reference or a value type.
+     * \tparam callback_t The type of the callback.
+     */
+    template <typename algorithm_t, typename algorithm_input_t, typename callback_t>
+    class task_batch : public thread_pool::task_batch_base
+    {
+    public:
+        /*!\brief Constructs the batch for the given algorithm.
+         * \param[in] algorithm The algorithm to copy for every thread.
+         */
+        explicit task_batch(algorithm_t const & algorithm) : algorithm{algorithm}
+        {}
+
+        //!\brief Stores a new task.
+        template <typename input_t, typename other_callback_t>
+        void push(input_t && input, other_callback_t && callback)
+        {
+            tasks.emplace_back(std::tuple<algorithm_input_t>{std::forward<input_t>(input)},
+                               std::forward<other_callback_t>(callback));
+        }
+
+        //!\brief Computes tasks of this batch until no task is left to take or to steal.
+        void process(thread_pool & pool, size_t const thread_id) override
+        {
+            using forward_input_t = std::tuple_element_t<0, std::tuple<algorithm_input_t>>;
+
+            algorithm_t thread_algorithm{algorithm};
+            size_t task_position{};
+
+            // The input is either a lvalue reference or moved into the algorithm, since every task is executed once.
+            while (pool.next_task(thread_id, task_position))
+            {
+                auto & [input_tuple, callback] = tasks[task_position];
+                thread_algorithm(std::forward<forward_input_t>(std::get<0>(input_tuple)), std::move(callback));
+            }
+        }
+
+        //!\brief Returns the number of tasks.
+        size_t size() const noexcept override
+        {
+            return tasks.size();
+        }
+
+    private:
+        //!\brief The algorithm from which every thread creates its own copy.
+        algorithm_t algorithm;
+        //!\brief The stored tasks.
+        std::vector<std::pair<std::tuple<algorithm_input_t>, callback_t>> tasks{};
+    };
+
+    /*!\brief A distinct address for every type of task batch.
+     * \tparam task_batch_t The type of the task batch.
+     *
+     * \details
+     *
+     * The pending batch is identified by the address of this variable, such that no dynamic_cast is needed to check
+     * whether a new task can be added to it.
+     */
+    template <typename task_batch_t>
+    static constexpr char task_batch_key{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Instances of this class are not copyable.
+     * \{
+     */
+
+    /*!\brief Constructs the execution handler spawning `thread_count` many threads.
+     * \param thread_count The number of threads to spawn; at least one thread is spawned.
+     */
+    execution_handler_work_stealing(size_t const thread_count) :
+        own_pool{std::make_unique<thread_pool>(thread_count)},
+        pool{own_pool.get()}
+    {}
+
+    /*!\brief Constructs the execution handler computing the tasks with the given thread pool.
+     * \param shared_pool The thread pool to use; must outlive the execution handler.
+     */
+    execution_handler_work_stealing(thread_pool & shared_pool) : pool{&shared_pool}
+    {}
+
+    /*!\brief Constructs the execution handler spawning 1 thread.
+     * \details See seqan3::detail::execution_handler_parallel::execution_handler_parallel().
+     */
+    execution_handler_work_stealing() : execution_handler_work_stealing{1u}
+    {}
+
+    execution_handler_work_stealing(execution_handler_work_stealing const &) = delete; //!< Deleted.
+    execution_handler_work_stealing(execution_handler_work_stealing &&) = default; //!< Defaulted.
+    execution_handler_work_stealing & operator=(execution_handler_work_stealing const &) = delete; //!< Deleted.
+    execution_handler_work_stealing & operator=(execution_handler_work_stealing &&) = default; //!< Defaulted.
+    ~execution_handler_work_stealing() = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief Stores a new algorithm task with the given input and callback.
+     * \tparam algorithm_t The type of the algorithm; must model std::copy_constructible and std::invocable with
+     *                     the given input type as first argument and the callback type as second argument.
+     * \tparam algorithm_input_t The input type to invoke the algorithm with; must either be a lvalue reference or
+     *                           model std::move_constructible.
+     * \tparam callback_t The type of the callable invoked by the algorithm after generating a new result; must model
+     *                    std::copy_constructible.
+     *
+     * \param[in] algorithm The algorithm to invoke.
+     * \param[in] input The input of the algorithm.
+     * \param[in] callback A callable which will be invoked on each result generated by the algorithm.
+     *
+     * \details
+     *
+     * The task is appended to the pending batch and is computed on the next call to
+     * seqan3::detail::execution_handler_work_stealing::wait. The pending batch is identified by the types of the
+     * algorithm, the input and the callback: if it was created for other types, it is computed before a new batch is
+     * started. All tasks of a batch are computed with the algorithm passed with the first task, i.e. the tasks of the
+     * same types that are stored before the next call to seqan3::detail::execution_handler_work_stealing::wait must
+     * be given equal algorithms.
+     */
+    template <std::copy_constructible algorithm_t,
+              typename algorithm_input_t,
+              std::copy_constructible callback_t>
+    //!\cond
+        requires std::invocable<algorithm_t, algorithm_input_t, callback_t> &&
+                 (std::is_lvalue_reference_v<algorithm_input_t> || std::move_constructible<algorithm_input_t>)
+    //!\endcond
+    void execute(algorithm_t && algorithm, algorithm_input_t && input, callback_t && callback)
+    {
+        using task_batch_t = task_batch<std::remove_cvref_t<algorithm_t>,
+                                        algorithm_input_t,
+                                        std::remove_cvref_t<callback_t>>;
+
+        if (pending_batch == nullptr || pending_batch_key != &task_batch_key<task_batch_t>)
+        {
+            wait();
+            pending_batch = std::make_unique<task_batch_t>(algorithm);
+            pending_batch_key = &task_batch_key<task_batch_t>;
+        }
+
+        static_cast<task_batch_t &>(*pending_batch).push(std::forward<algorithm_input_t>(input),
+                                                         std::forward<callback_t>(callback));
+    }
+
+    /*!\brief Executes the algorithm for every element of the given input range in parallel.
+     * \tparam algorithm_t The type of the algorithm.
+     * \tparam algorithm_input_range_t The input range type.
+     * \tparam callback_t The type of the callable invoked by the algorithm after generating a new result.
+     *
+     * \param[in] algorithm The algorithm to invoke.
+     * \param[in] input_range The input range to process.
+     * \param[in] callback A callable which will be invoked on each result generated by the algorithm for a given input.
+     *
+     * \details
+     *
+     * Computes the pending tasks first. Then all elements of the given input range are stored in a single batch,
+     * which is computed as one by the threads of the thread pool. The call blocks until all elements have been
+     * processed.
+     */
+    template <std::copy_constructible algorithm_t,
+              std::ranges::input_range algorithm_input_range_t,
+              std::copy_constructible callback_t>
+    //!\cond
+        requires std::invocable<algorithm_t, std::ranges::range_reference_t<algorithm_input_range_t>, callback_t>
+    //!\endcond
+    void bulk_execute(algorithm_t && algorithm, algorithm_input_range_t && input_range, callback_t && callback)
+    {
+        using algorithm_input_t = std::ranges::range_reference_t<algorithm_input_range_t>;
+        using task_batch_t = task_batch<std::remove_cvref_t<algorithm_t>,
+                                        algorithm_input_t,
+                                        std::remove_cvref_t<callback_t>>;
+
+        wait();
+
+        task_batch_t batch{algorithm};
+        for (auto && input : input_range)
+            batch.push(std::forward<decltype(input)>(input), callback);
+
+        assert(pool != nullptr);
+        pool->compute(batch);
+    }
+
+    //!\brief Computes all stored tasks and waits until they have been completed.
+    void wait()
+    {
+        assert(pool != nullptr);
+
+        if (pending_batch == nullptr)
+            return;
+
+        // Release the tasks even if one of them has thrown.
+        std::unique_ptr<thread_pool::task_batch_base> batch = std::move(pending_batch);
+        pending_batch_key = nullptr;
+        pool->compute(*batch);
+    }
+
+private:
+    //!\brief The thread pool owned by this handler if no shared thread pool is used.
+    std::unique_ptr<thread_pool> own_pool{};
+    //!\brief The thread pool computing the tasks.
+    thread_pool * pool{nullptr};
+    //!\brief The batch of tasks that is computed on the next call to wait.
+    std::unique_ptr<thread_pool::task_batch_base> pending_batch{};
+    //!\brief The key of the type of the pending batch or `nullptr` if there is none.
+    char const * pending_batch_key{nullptr};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,297 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::thread_pool.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+//!\cond
+class execution_handler_work_stealing;
+//!\endcond
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A pool of threads that can be shared by several parallel algorithm invocations.
+ * \ingroup algorithm
+ *
+ * \details
+ *
+ * By default, every parallel invocation of seqan3::align_pairwise or seqan3::search spawns the configured number of
+ * threads and joins them again when the computation is finished. If many small batches are computed, the thread
+ * creation becomes a noticeable part of the runtime. Instead, a thread pool can be created once and passed to
+ * seqan3::align_cfg::parallel_work_stealing or seqan3::search_cfg::parallel_work_stealing, such that all
+ * invocations use the threads of the pool.
+ *
+ * The threads are spawned on construction and joined on destruction. Work is distributed to the threads with work
+ * stealing (see seqan3::detail::execution_handler_work_stealing).
+ *
+ * ### Thread safety
+ *
+ * Several algorithm invocations can use the same pool concurrently; their batches of work are computed one after
+ * the other. A batch never waits for the consumer of a result range, such that result ranges over unordered results
+ * (see seqan3::align_cfg::unordered_results) can be interleaved with each other and with other invocations on the
+ * same pool. The pool must outlive every algorithm result range that was configured with it, since the results are
+ * computed while iterating over the range. Do not use a pool from within a task that is computed by the same pool.
+ *
+ * \note Instances of this class are neither copyable nor movable.
+ */
+class thread_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Instances of this class are neither copyable nor movable, since the threads refer to it.
+     * \{
+     */
+    thread_pool() = delete; //!< Deleted.
+    thread_pool(thread_pool const &) = delete; //!< Deleted.
+    thread_pool(thread_pool &&) = delete; //!< Deleted.
+    thread_pool & operator=(thread_pool const &) = delete; //!< Deleted.
+    thread_pool & operator=(thread_pool &&) = delete; //!< Deleted.
+
+    /*!\brief Spawns the given number of threads.
+     * \param thread_count The number of threads to spawn; at least one thread is spawned.
+     */
+    explicit thread_pool(uint32_t const thread_count) :
+        ranges{std::make_unique<task_range[]>(std::max<uint32_t>(thread_count, 1u))}
+    {
+        for (size_t thread_id = 0; thread_id < std::max<uint32_t>(thread_count, 1u); ++thread_id)
+            threads.emplace_back([this, thread_id] () { work(thread_id); });
+    }
+
+    //!\brief Stops and joins the threads.
+    ~thread_pool()
+    {
+        {
+            std::unique_lock lock{mutex};
+            stop = true;
+        }
+        start_condition.notify_all();
+
+        for (auto & thread : threads)
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+    //!\}
+
+    //!\brief Returns the number of threads.
+    uint32_t size() const noexcept
+    {
+        return threads.size();
+    }
+
+private:
+    //!\brief Befriend the execution handler that computes its tasks with this pool.
+    friend class detail::execution_handler_work_stealing;
+
+    //!\brief The type-erased interface of a batch of tasks.
+    class task_batch_base
+    {
+    public:
+        //!\brief Virtual destructor.
+        virtual ~task_batch_base() = default;
+
+        //!\brief Computes tasks of this batch until no task is left to take or to steal.
+        virtual void process(thread_pool & pool, size_t const thread_id) = 0;
+
+        //!\brief Returns the number of tasks.
+        virtual size_t size() const noexcept = 0;
+    };
+
+    //!\brief The range of task positions owned by a thread, placed on its own cache line.
+    struct alignas(64) task_range
+    {
+        //!\brief The begin position in the lower and the end position in the upper 32 bits.
+        std::atomic<uint64_t> value{0u};
+    };
+
+    /*!\brief Distributes the tasks of the given batch to the threads and waits until they are completed.
+     * \param[in] batch The batch to compute.
+     * \throws Rethrows the first exception thrown by a task.
+     *
+     * \details
+     *
+     * Concurrent calls are computed one after the other.
+     */
+    void compute(task_batch_base & batch)
+    {
+        std::unique_lock submit_lock{submit_mutex};
+
+        size_t const task_count = batch.size();
+        size_t const thread_count = threads.size();
+        assert(task_count < std::numeric_limits<uint32_t>::max());
+
+        if (task_count == 0)
+            return;
+
+        for (size_t thread_id = 0; thread_id < thread_count; ++thread_id)
+            ranges[thread_id].value.store(pack(task_count * thread_id / thread_count,
+                                               task_count * (thread_id + 1) / thread_count),
+                                          std::memory_order_relaxed);
+
+        {
+            std::unique_lock lock{mutex};
+            current_batch = &batch;
+            active_threads = thread_count;
+            ++generation;
+        }
+        start_condition.notify_all();
+
+        std::exception_ptr batch_exception{};
+        {
+            std::unique_lock lock{mutex};
+            done_condition.wait(lock, [this] () { return active_threads == 0; });
+            current_batch = nullptr;
+            batch_exception = std::exchange(exception, nullptr);
+        }
+
+        if (batch_exception)
+            std::rethrow_exception(batch_exception);
+    }
+
+    /*!\brief Returns the position of the next task for the given thread.
+     * \param[in] thread_id The id of the thread asking for a task.
+     * \param[out] task_position The position of the taken task.
+     * \returns `true` if a task was taken, `false` if no task is left.
+     */
+    bool next_task(size_t const thread_id, size_t & task_position) noexcept
+    {
+        // Take the task from the front of the own range.
+        std::atomic<uint64_t> & own_range = ranges[thread_id].value;
+        uint64_t range = own_range.load(std::memory_order_acquire);
+        while (range_begin(range) < range_end(range))
+        {
+            if (own_range.compare_exchange_weak(range, pack(range_begin(range) + 1, range_end(range))))
+            {
+                task_position = range_begin(range);
+                return true;
+            }
+        }
+
+        // Steal the back half of the range of another thread.
+        size_t const thread_count = threads.size();
+        for (size_t offset = 1; offset < thread_count; ++offset)
+        {
+            std::atomic<uint64_t> & victim_range = ranges[(thread_id + offset) % thread_count].value;
+            range = victim_range.load(std::memory_order_acquire);
+            while (range_begin(range) < range_end(range))
+            {
+                size_t const middle = range_begin(range) + (range_end(range) - range_begin(range)) / 2;
+                if (victim_range.compare_exchange_weak(range, pack(range_begin(range), middle)))
+                {
+                    // The own range is empty, so no other thread can modify it concurrently.
+                    task_position = middle;
+                    own_range.store(pack(middle + 1, range_end(range)), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    //!\brief Packs the begin and end position of a task range.
+    static constexpr uint64_t pack(uint64_t const begin, uint64_t const end) noexcept
+    {
+        return (end << 32) | begin;
+    }
+
+    //!\brief Returns the begin position of a packed task range.
+    static constexpr size_t range_begin(uint64_t const range) noexcept
+    {
+        return range & std::numeric_limits<uint32_t>::max();
+    }
+
+    //!\brief Returns the end position of a packed task range.
+    static constexpr size_t range_end(uint64_t const range) noexcept
+    {
+        return range >> 32;
+    }
+
+    //!\brief The loop of every thread: computes the tasks of every new batch until the pool is destructed.
+    void work(size_t const thread_id)
+    {
+        size_t seen_generation{0};
+
+        for (;;)
+        {
+            std::unique_lock lock{mutex};
+            start_condition.wait(lock, [&] () { return stop || generation != seen_generation; });
+
+            if (stop)
+                return;
+
+            seen_generation = generation;
+            task_batch_base * batch = current_batch;
+            lock.unlock();
+
+            std::exception_ptr task_exception{};
+            try
+            {
+                batch->process(*this, thread_id);
+            }
+            catch (...)
+            {
+                task_exception = std::current_exception();
+            }
+
+            lock.lock();
+            if (task_exception && !exception)
+                exception = task_exception;
+
+            if (--active_threads == 0)
+                done_condition.notify_one();
+        }
+    }
+
+    //!\brief The threads.
+    std::vector<std::thread> threads{};
+    //!\brief The task range of every thread.
+    std::unique_ptr<task_range[]> ranges{};
+    //!\brief Serialises the batches of concurrent algorithm invocations.
+    std::mutex submit_mutex{};
+    //!\brief Protects the batch state shared with the threads.
+    std::mutex mutex{};
+    //!\brief Signals the threads that a new batch is available or that they shall stop.
+    std::condition_variable start_condition{};
+    //!\brief Signals that all threads have completed the current batch.
+    std::condition_variable done_condition{};
+    //!\brief The batch computed by the threads.
+    task_batch_base * current_batch{nullptr};
+    //!\brief The number of threads still working on the current batch.
+    size_t active_threads{0};
+    //!\brief Incremented for every new batch.
+    size_t generation{0};
+    //!\brief Whether the threads shall stop.
+    bool stop{false};
+    //!\brief The first exception thrown by a task of the current batch.
+    std::exception_ptr exception{};
+};
+
+} // namespace seqan3
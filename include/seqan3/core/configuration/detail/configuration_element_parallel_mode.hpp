@@ -14,20 +14,27 @@
 #pragma once
 
 #include <optional>
+
 #include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/algorithm/thread_pool.hpp>
 
 namespace seqan3::detail
 {
 /*!\brief A global configuration type used to enable parallel execution of algorithms.
  * \ingroup algorithm
  * \tparam wrapped_config_id_t The algorithm specific configuration id wrapped in a std::integral_constant.
+ * \tparam work_stealing Whether the tasks are distributed with seqan3::detail::execution_handler_work_stealing
+ *                       instead of seqan3::detail::execution_handler_parallel [default: `false`].
  *
  * \details
  *
- * This type is used to enable the parallel mode of the algorithms.
+ * This type is used to enable the parallel mode of the algorithms. It is constructed with the number of threads, in
+ * which case every algorithm invocation spawns its own threads. With work stealing, it can alternatively be
+ * constructed with a seqan3::thread_pool, whose threads are shared by all algorithm invocations configured with it.
+ * The thread pool is referenced and must outlive the computation of the algorithm.
  */
-template <typename wrapped_config_id_t>
-class parallel_mode : public pipeable_config_element<parallel_mode<wrapped_config_id_t>>
+template <typename wrapped_config_id_t, bool work_stealing = false>
+class parallel_mode : public pipeable_config_element<parallel_mode<wrapped_config_id_t, work_stealing>>
 {
 public:
     /*!\name Constructors, assignment and destructor
@@ -45,11 +52,24 @@ public:
      */
     explicit parallel_mode(uint32_t thread_count_) noexcept : thread_count{thread_count_}
     {}
+
+    /*!\brief Uses the threads of the given thread pool.
+     * \param[in] pool_ The thread pool to compute the algorithm with; must outlive the computation.
+     */
+    explicit parallel_mode(thread_pool & pool_) noexcept
+    //!\cond
+        requires work_stealing
+    //!\endcond
+        : thread_count{pool_.size()}, pool{&pool_}
+    {}
     //!\}
 
     //!\brief The maximum number of threads the algorithm can use.
     std::optional<uint32_t> thread_count{std::nullopt};
 
+    //!\brief The shared thread pool or `nullptr` if the algorithm spawns its own threads.
+    thread_pool * pool{nullptr};
+
     /*!\privatesection
      * \brief Internal id to check for consistent configuration settings.
      */
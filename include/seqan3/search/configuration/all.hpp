@@ -14,6 +14,7 @@
 #pragma once
 
 #include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
 #include <seqan3/search/configuration/detail.hpp>
 #include <seqan3/search/configuration/hit.hpp>
@@ -58,15 +59,16 @@
  * into one search configuration. In general, the same configuration element cannot occur more than once inside of
  * a configuration specification. The following table shows which combinations are possible.
  *
- * | **Configuration group**                                                     | **0** | **1** | **2** | **3** | **4** | **5** | **6** |
- * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|
- * | \ref seqan3::search_cfg::max_error_total  "0: Max error total"              |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_substitution "1: Max error substitution" |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_insertion "2: Max error insertion"       |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_deletion "3: Max error deletion"         |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |
- * | \ref search_configuration_subsection_output "4: Output"                     |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |
- * | \ref search_configuration_subsection_hit_strategy "5: Hit"                  |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |
- * | \ref seqan3::search_cfg::parallel "6: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |
+ * | **Configuration group**                                                     | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** |
+ * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|
+ * | \ref seqan3::search_cfg::max_error_total  "0: Max error total"              |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_substitution "1: Max error substitution" |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_insertion "2: Max error insertion"       |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_deletion "3: Max error deletion"         |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref search_configuration_subsection_output "4: Output"                     |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |  ✅   |
+ * | \ref search_configuration_subsection_hit_strategy "5: Hit"                  |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::parallel "6: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |  ✅   |
+ * | \ref seqan3::search_cfg::batch "7: Batch"                                   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ❌   |
  *
  * \subsection search_configuration_subsection_error 0 - 3: Max Error Configuration
  *
@@ -172,6 +174,17 @@
  *
  * \include test/snippet/search/configuration_parallel.cpp
  *
+ * \subsection search_configuration_subsection_batch 7: Batch Configuration
+ *
+ * This configuration searches the queries in batches of the given size. The queries of a batch are searched in
+ * lock-step and the memory accesses of the next step are prefetched for all of them, such that the cache misses of
+ * the queries overlap. This is most effective for many short queries that are searched without errors or for the
+ * best hits. The results are the same as without this configuration.
+ *
+ * The seqan3::search_cfg::batch configuration element can be combined with any other search configuration.
+ *
+ * \include test/snippet/search/configuration_batch.cpp
+ *
  * ### User callback
  *
  * In the default case, a call to seqan3::search returns a lazy range over the results of the search. This lazy range
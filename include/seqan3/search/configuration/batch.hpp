@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::search_cfg::batch configuration.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to search the queries in batches.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * By default, every query is searched on its own. Every extension of the search cursor by one character requires
+ * rank queries on the index, which are random accesses into a large data structure and almost always miss the CPU
+ * cache. Searching one query after another thus spends most of its time waiting for the memory.
+ *
+ * With this configuration element, the queries are split into batches of seqan3::search_cfg::batch::size queries.
+ * The queries of a batch are searched in lock-step: in every round, the cursors of all queries are extended by one
+ * character. Before the cursors are extended, the memory accessed by the extensions is prefetched for all queries,
+ * such that the memory latencies of the queries of a batch overlap instead of adding up.
+ *
+ * The lock-step search is used for all queries that are searched without errors, and for the first, error-free, step
+ * of the search for the best hits (seqan3::search_cfg::hit_all_best and seqan3::search_cfg::hit_single_best).
+ * Queries that are not found without errors in the latter case, as well as all queries that are searched with
+ * seqan3::search_cfg::hit_strata or with errors and seqan3::search_cfg::hit_all, are searched one by one afterwards.
+ * The results are the same as without this configuration element and are reported in the same order.
+ *
+ * This configuration element can be combined with any other search configuration.
+ * Together with seqan3::search_cfg::parallel, the batches are distributed to the threads.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_batch.cpp
+ */
+class batch : public pipeable_config_element<batch>
+{
+public:
+    //!\brief The number of queries that are searched together [default: 32].
+    size_t size{32};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr batch() = default; //!< Defaulted.
+    constexpr batch(batch const &) = default; //!< Defaulted.
+    constexpr batch(batch &&) = default; //!< Defaulted.
+    constexpr batch & operator=(batch const &) = default; //!< Defaulted.
+    constexpr batch & operator=(batch &&) = default; //!< Defaulted.
+    ~batch() = default; //!< Defaulted.
+
+    /*!\brief Initialises the batch config.
+     * \param[in] size The number of queries that are searched together; must be greater than `0`.
+     */
+    constexpr explicit batch(size_t const size) : size{size}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::batch};
+};
+
+} // namespace seqan3::search_cfg
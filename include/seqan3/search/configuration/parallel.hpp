@@ -25,6 +25,8 @@ namespace seqan3::search_cfg
  * With this configuration you can enable the parallel execution of the search algorithm.
  *
  * The config element takes the number of threads as a parameter, which must be greater than `0`.
+ * To distribute the queries with work stealing or to share a seqan3::thread_pool between several invocations, use
+ * seqan3::search_cfg::parallel_work_stealing instead.
  *
  * ### Example
  *
@@ -33,4 +35,23 @@ namespace seqan3::search_cfg
 using parallel = seqan3::detail::parallel_mode<std::integral_constant<detail::search_config_id,
                                                                       detail::search_config_id::parallel>>;
 
+/*!\brief Enables the parallel execution of the search algorithm with work stealing.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * Like seqan3::search_cfg::parallel, but the queries are distributed to the threads with work stealing, such that
+ * threads which finish their share early take over queries from busy threads.
+ *
+ * The config element takes the number of threads as a parameter, which must be greater than `0`.
+ * Alternatively, a seqan3::thread_pool can be given, whose threads are reused by every invocation of
+ * seqan3::search configured with it instead of spawning new threads for every invocation.
+ * The thread pool must outlive the returned seqan3::algorithm_result_generator_range.
+ *
+ * This configuration element cannot be combined with seqan3::search_cfg::parallel.
+ */
+using parallel_work_stealing = seqan3::detail::parallel_mode<std::integral_constant<detail::search_config_id,
+                                                                                    detail::search_config_id::parallel>,
+                                                             true>;
+
 } // namespace seqan3::search_cfg
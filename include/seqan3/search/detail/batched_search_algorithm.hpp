@@ -0,0 +1,211 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::batched_search_algorithm.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <memory>
+#include <seqan3/std/ranges>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup search
+ * \{
+ */
+
+/*!\brief The algorithm that searches a batch of queries with interleaved memory accesses.
+ * \tparam configuration_t The search configuration type.
+ * \tparam index_t The type of index; must model seqan3::fm_index_specialisation.
+ * \tparam search_algorithm_t The algorithm that searches a single query, e.g. seqan3::detail::search_scheme_algorithm.
+ *
+ * \details
+ *
+ * Every extension of an index cursor performs rank queries that almost always miss the CPU cache. This algorithm
+ * searches the queries of a batch that do not need to consider errors in lock-step: in every round, the memory that is
+ * read by the next extension is prefetched for all cursors before any of them is extended. The memory accesses of
+ * the cursors thus overlap instead of being serialised.
+ *
+ * Queries that need to be searched with errors are delegated to `search_algorithm_t`, as well as all queries of the
+ * strata search. For the search of the best hits only the queries that were not found without errors are delegated,
+ * since the error-free search is the first step of the search with errors. The results of a batch are reported in
+ * the order of the queries.
+ */
+template <typename configuration_t, fm_index_specialisation index_t, typename search_algorithm_t>
+class batched_search_algorithm : protected search_algorithm_t
+{
+private:
+    //!\brief The search configuration traits.
+    using traits_t = search_traits<configuration_t>;
+    //!\brief The search result type.
+    using search_result_type = typename traits_t::search_result_type;
+    //!\brief The cursor type of the index.
+    using cursor_type = typename index_t::cursor_type;
+
+    static_assert(!std::same_as<search_result_type, empty_type>, "The search result type was not configured.");
+
+    //!\brief The state of a query within the lock-step search.
+    enum struct query_state : uint8_t
+    {
+        searching, //!< The query is being searched.
+        found,     //!< The query was found without errors.
+        not_found, //!< The query was not found without errors.
+        delegated  //!< The query is searched with the algorithm for a single query.
+    };
+
+    //!\brief A query of the current batch within the lock-step search.
+    struct batch_entry
+    {
+        //!\brief The cursor that is extended by the characters of the query.
+        cursor_type cursor;
+        //!\brief The state of the query.
+        query_state state;
+        //!\brief Whether the query must be searched with errors if it is not found without errors.
+        bool search_with_errors;
+    };
+
+    /*!\brief Whether the search with errors is skipped for queries that are found without errors.
+     *
+     * \details
+     *
+     * The search for the best hits searches without errors first. The search for all hits needs to consider errors for
+     * all queries and the strata search continues with errors for the queries that are found without errors.
+     */
+    static constexpr bool error_free_search_first = traits_t::search_all_best_hits || traits_t::search_single_best_hit;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    batched_search_algorithm() = default; //!< Defaulted.
+    batched_search_algorithm(batched_search_algorithm const &) = default; //!< Defaulted.
+    batched_search_algorithm(batched_search_algorithm &&) = default; //!< Defaulted.
+    batched_search_algorithm & operator=(batched_search_algorithm const &) = default; //!< Defaulted.
+    batched_search_algorithm & operator=(batched_search_algorithm &&) = default; //!< Defaulted.
+    ~batched_search_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs from a configuration object and an index.
+     * \param[in] cfg The configuration object that guides the search algorithm.
+     * \param[in] index The index used in the algorithm.
+     */
+    batched_search_algorithm(configuration_t const & cfg, index_t const & index) :
+        search_algorithm_t{cfg, index},
+        index_ptr{std::addressof(index)}
+    {}
+    //!\}
+
+    /*!\brief Searches a batch of query sequences in an FM index.
+     *
+     * \tparam indexed_query_batch_t The type of the batch; must model std::ranges::forward_range over indexed
+     *                               queries, which must model seqan3::tuple_like with exactly two elements and the
+     *                               second tuple element must model std::ranges::random_access_range over the
+     *                               index's alphabet.
+     * \tparam callback_t The callback type to be invoked on a search result; must model std::invocable with the
+     *                    search result.
+     *
+     * \param[in] indexed_query_batch The batch of indexed query sequences to be searched in the index.
+     * \param[in] callback The callback to call on a search result.
+     *
+     * ### Complexity
+     *
+     * \f$O(|query|)\f$ for every query that is searched without errors, the complexity of `search_algorithm_t`
+     * otherwise.
+     */
+    template <typename indexed_query_batch_t, typename callback_t>
+    //!\cond
+        requires std::ranges::forward_range<indexed_query_batch_t> &&
+                 std::invocable<callback_t, search_result_type>
+    //!\endcond
+    void operator()(indexed_query_batch_t && indexed_query_batch, callback_t && callback)
+    {
+        batch_entries.clear();
+
+        size_t searching_count{0};
+
+        for (auto && indexed_query : indexed_query_batch)
+        {
+            auto && query = std::get<1>(indexed_query);
+            bool const search_with_errors = this->max_error_counts(query).total > 0; // see policy_max_error
+
+            if (!std::ranges::empty(query) &&
+                !traits_t::search_strata_hits &&
+                (!search_with_errors || error_free_search_first))
+            {
+                batch_entries.push_back({index_ptr->cursor(), query_state::searching, search_with_errors});
+                ++searching_count;
+            }
+            else
+            {
+                batch_entries.push_back({index_ptr->cursor(), query_state::delegated, search_with_errors});
+            }
+        }
+
+        for (size_t position = 0; searching_count > 0; ++position)
+        {
+            // Issue the memory accesses of all queries before the first extension waits for its memory.
+            for (batch_entry const & entry : batch_entries)
+                if (entry.state == query_state::searching)
+                    entry.cursor.prefetch_extend_right();
+
+            auto entry_it = batch_entries.begin();
+            for (auto && indexed_query : indexed_query_batch)
+            {
+                batch_entry & entry = *entry_it++;
+
+                if (entry.state != query_state::searching)
+                    continue;
+
+                auto && query = std::get<1>(indexed_query);
+
+                if (!entry.cursor.extend_right(query[position]))
+                    entry.state = query_state::not_found;
+                else if (position + 1 == std::ranges::size(query))
+                    entry.state = query_state::found;
+
+                searching_count -= (entry.state != query_state::searching);
+            }
+        }
+
+        auto entry_it = batch_entries.begin();
+        for (auto && indexed_query : indexed_query_batch)
+        {
+            batch_entry & entry = *entry_it++;
+
+            if (entry.state == query_state::found)
+            {
+                // see policy_search_result_builder
+                this->make_results(std::vector<cursor_type>{std::move(entry.cursor)},
+                                   std::get<0>(indexed_query),
+                                   callback);
+            }
+            else if (entry.state == query_state::delegated || entry.search_with_errors)
+            {
+                search_algorithm_t::operator()(std::move(indexed_query), callback);
+            }
+        }
+    }
+
+private:
+    //!\brief A pointer to the fm index which is used to perform the search.
+    index_t const * index_ptr{nullptr};
+    //!\brief The queries of the current batch; kept as member to reuse the memory for the next batch.
+    std::vector<batch_entry> batch_entries{};
+};
+
+//!\}
+
+} // namespace seqan3::detail
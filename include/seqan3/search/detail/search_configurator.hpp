@@ -12,11 +12,15 @@
 
 #pragma once
 
+#include <seqan3/std/ranges>
+
 #include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/output.hpp>
 #include <seqan3/search/configuration/result_type.hpp>
+#include <seqan3/search/detail/batched_search_algorithm.hpp>
 #include <seqan3/search/detail/policy_max_error.hpp>
 #include <seqan3/search/detail/policy_search_result_builder.hpp>
 #include <seqan3/search/detail/search_scheme_algorithm.hpp>
@@ -83,6 +87,24 @@ private:
                                lazy<unidirectional_search_algorithm, configuration_t, index_t, policies_t...>>;
     };
 
+    /*!\brief Extracts the type of a single indexed query from the type the search algorithm is invoked with.
+     * \tparam query_t The type of an indexed query or of a batch of indexed queries.
+     */
+    template <typename query_t>
+    struct indexed_query_type
+    {
+        //!\brief The type of the indexed query.
+        using type = query_t;
+    };
+
+    //!\copydoc seqan3::detail::search_configurator::indexed_query_type
+    template <std::ranges::input_range query_t>
+    struct indexed_query_type<query_t>
+    {
+        //!\brief The type of an indexed query of the batch.
+        using type = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+    };
+
 public:
     /*!\brief Add seqan3::search_cfg::hit_all to the configuration if no search strategy (hit configuration) was chosen.
      * \tparam configuration_t The type of the search configuration.
@@ -150,7 +172,8 @@ public:
 
     /*!\brief Chooses the appropriate search algorithm depending on the index.
      *
-     * \tparam query_t An explicit template argument for the query type the search algorithm is invoked with.
+     * \tparam query_t An explicit template argument for the query type the search algorithm is invoked with; either
+     *                 an indexed query or a batch of indexed queries if seqan3::search_cfg::batch is configured.
      * \tparam configuration_t The type of the search configuration.
      * \tparam index_t The type of the index.
      * \param[in] cfg The search configuration object that is passed to the algorithm.
@@ -161,12 +184,13 @@ public:
      *
      * If the `index_t` models seqan3::bi_fm_index_specialisation, then the
      * seqan3::detail::search_scheme_algorithm is chosen. Otherwise, the
-     * seqan3::detail::unidirectional_search_algorithm is chosen.
+     * seqan3::detail::unidirectional_search_algorithm is chosen. If seqan3::search_cfg::batch is configured, the chosen
+     * algorithm is wrapped into the seqan3::detail::batched_search_algorithm.
      */
     template <typename query_t, typename configuration_t, typename index_t>
     static auto configure_algorithm(configuration_t const & cfg, index_t const & index)
     {
-        using query_index_t = std::tuple_element_t<0, query_t>;
+        using query_index_t = std::tuple_element_t<0, typename indexed_query_type<query_t>::type>;
         using search_result_t = typename select_search_result<configuration_t, index_t, query_index_t>::type;
         using callback_t = std::function<void(search_result_t)>;
         using type_erased_algorithm_t = std::function<void(query_t, callback_t)>;
@@ -201,7 +225,10 @@ public:
                                              policy_max_error,
                                              policy_search_result_builder<configuration_t>>::type;
 
-        return selected_algorithm_t{config, index};
+        if constexpr (configuration_t::template exists<search_cfg::batch>())
+            return batched_search_algorithm<configuration_t, index_t, selected_algorithm_t>{config, index};
+        else
+            return selected_algorithm_t{config, index};
     }
 };
 
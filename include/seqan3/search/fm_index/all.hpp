@@ -47,3 +47,4 @@
 
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
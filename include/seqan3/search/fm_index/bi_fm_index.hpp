@@ -104,6 +104,7 @@ private:
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
      * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options.
      *
      * \details
      * \if DEV
@@ -120,12 +121,12 @@ private:
      * No guarantee. \if DEV \todo Ensure strong exception guarantee. \endif
      */
     template <std::ranges::range text_t>
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options)
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
-        fwd_fm = fm_index_type{text};
-        rev_fm = rev_fm_index_type{text};
+        fwd_fm = fm_index_type{text, options};
+        rev_fm = rev_fm_index_type{text, options};
     }
 
 public:
@@ -167,15 +168,17 @@ public:
     /*!\brief Constructor that immediately constructs the index given a range. The range cannot be empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
      * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options, which are used for the construction of both the
+     *                    index of the text and the index of the reversed text.
      *
      * ### Complexity
      *
      * \if DEV \todo \endif At least linear.
      */
     template <std::ranges::range text_t>
-    bi_fm_index(text_t && text)
+    bi_fm_index(text_t && text, fm_index_construction_options const & options = {})
     {
-        construct(std::forward<text_t>(text));
+        construct(std::forward<text_t>(text), options);
     }
     //!\}
 
@@ -301,6 +304,11 @@ public:
 //! \brief Deduces the dimensions of the text.
 template <std::ranges::range text_t>
 bi_fm_index(text_t &&) -> bi_fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//! \brief Deduces the dimensions of the text.
+template <std::ranges::range text_t>
+bi_fm_index(text_t &&, fm_index_construction_options const &)
+    -> bi_fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
 //!\}
 
 //!\}
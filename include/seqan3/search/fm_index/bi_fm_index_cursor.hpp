@@ -463,6 +463,31 @@ public:
         return extend_right(std::basic_string_view<char_type>{cstring});
     }
 
+    /*!\brief Prefetches the memory of the index that is read by the next call to extend_right(char_t const c).
+     *
+     * \details
+     *
+     * Extending the cursor by a character performs rank queries on the index, which are random accesses into a large
+     * data structure and rarely hit the CPU cache. When many cursors are extended in lock-step, calling this function
+     * for all cursors before extending them lets the memory accesses of the cursors overlap.
+     * The result of the extension does not depend on whether this function was called.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void prefetch_extend_right() const noexcept
+    {
+        assert(index != nullptr);
+
+        detail::prefetch_rank(index->fwd_fm.index.wavelet_tree, fwd_lb);
+        detail::prefetch_rank(index->fwd_fm.index.wavelet_tree, fwd_rb + 1);
+    }
+
     /*!\brief Tries to extend the query by the character `c` to the left.
      * \tparam char_t Type of the character needs to be convertible to the character type `char_type` of the index.
      * \param[in] c Character to extend the query with to the left.
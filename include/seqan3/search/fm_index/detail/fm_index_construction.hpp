@@ -0,0 +1,300 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the parallel and disk-backed construction of the seqan3::fm_index.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <seqan3/std/concepts>
+#include <seqan3/std/filesystem>
+#include <limits>
+#include <numeric>
+#include <seqan3/std/ranges>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sdsl/suffix_trees.hpp>
+
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Invokes the given job once per thread and waits until all invocations have finished.
+ * \ingroup search
+ * \param[in] thread_count The number of threads to use.
+ * \param[in] job The job to invoke with the index of the invoking thread.
+ */
+template <std::invocable<size_t> job_t>
+void invoke_in_parallel(size_t const thread_count, job_t && job)
+{
+    std::vector<std::thread> threads{};
+    threads.reserve(thread_count);
+
+    for (size_t thread_id = 0; thread_id < thread_count; ++thread_id)
+        threads.emplace_back(job, thread_id);
+
+    for (std::thread & thread : threads)
+        thread.join();
+}
+
+/*!\brief Sorts the given range with the given number of threads.
+ * \ingroup search
+ * \param[in] first The begin of the range to sort.
+ * \param[in] last The end of the range to sort.
+ * \param[in] compare The comparator.
+ * \param[in] thread_count The number of threads to use.
+ *
+ * \details
+ *
+ * Every thread sorts one chunk of the range, afterwards the sorted chunks are merged pairwise in parallel.
+ */
+template <std::random_access_iterator iterator_t, typename compare_t>
+void parallel_sort(iterator_t first, iterator_t last, compare_t compare, size_t const thread_count)
+{
+    size_t const size = std::ranges::distance(first, last);
+    size_t const chunk_count = std::clamp<size_t>(size / (1u << 14), 1u, thread_count);
+
+    std::vector<iterator_t> chunk_begin(chunk_count + 1);
+    for (size_t chunk = 0; chunk <= chunk_count; ++chunk)
+        chunk_begin[chunk] = first + size * chunk / chunk_count;
+
+    invoke_in_parallel(chunk_count, [&] (size_t const chunk)
+    {
+        std::sort(chunk_begin[chunk], chunk_begin[chunk + 1], compare);
+    });
+
+    for (size_t width = 1; width < chunk_count; width *= 2)
+    {
+        size_t const merge_count = (chunk_count + 2 * width - 1) / (2 * width);
+        invoke_in_parallel(merge_count, [&] (size_t const merge)
+        {
+            size_t const left = merge * 2 * width;
+            size_t const middle = std::min(left + width, chunk_count);
+            size_t const right = std::min(left + 2 * width, chunk_count);
+            std::inplace_merge(chunk_begin[left], chunk_begin[middle], chunk_begin[right], compare);
+        });
+    }
+}
+
+/*!\brief Builds the suffix array of the given text with the given number of threads.
+ * \ingroup search
+ * \tparam index_t The type of the suffix array entries; must be able to represent the size of the text.
+ * \param[in] text The text; its last symbol must be the unique smallest symbol.
+ * \param[in] thread_count The number of threads to use.
+ * \returns The suffix array of the text.
+ *
+ * \details
+ *
+ * The suffix array is built by prefix doubling as proposed by Larsson and Sadakane: in round `h` all groups of
+ * suffixes that share the same prefix of length `h` are sorted by the group of the suffix `h` positions to the right,
+ * which sorts them by their prefix of length `2h`. Only groups of more than one suffix are sorted again, and the
+ * construction ends when every suffix forms its own group.
+ *
+ * Within one round the groups are independent, such that large groups are sorted with all threads and the remaining
+ * groups are distributed among the threads.
+ *
+ * ### Complexity
+ *
+ * \f$O(n \log n \log L)\f$ work, where \f$L\f$ is the length of the longest repeated substring of the text.
+ * Besides the text, \f$2n\f$ entries of `index_t` and \f$n\f$ bytes are allocated.
+ */
+template <std::unsigned_integral index_t, std::ranges::random_access_range text_t>
+std::vector<index_t> parallel_suffix_array(text_t const & text, size_t const thread_count)
+{
+    using group_t = std::pair<size_t, size_t>;
+
+    size_t const text_size = std::ranges::size(text);
+    assert(text_size <= std::numeric_limits<index_t>::max());
+
+    // The rank of a suffix is the position of the last suffix of its group in the suffix array.
+    std::vector<index_t> suffix_array(text_size);
+    std::vector<index_t> rank(text_size);
+    // Marks the positions in the suffix array where a new group begins after sorting a group.
+    std::vector<uint8_t> is_group_begin(text_size);
+    std::vector<group_t> groups{};
+
+    // Bucket the suffixes by their first symbol.
+    std::array<size_t, 257> bucket_begin{};
+    for (auto const symbol : text)
+        ++bucket_begin[static_cast<uint8_t>(symbol) + 1];
+
+    std::partial_sum(bucket_begin.begin(), bucket_begin.end(), bucket_begin.begin());
+
+    for (size_t symbol = 0; symbol < 256; ++symbol)
+        if (bucket_begin[symbol + 1] - bucket_begin[symbol] > 1)
+            groups.emplace_back(bucket_begin[symbol], bucket_begin[symbol + 1]);
+
+    std::array<size_t, 257> bucket_position{bucket_begin};
+    for (size_t position = 0; position < text_size; ++position)
+    {
+        uint8_t const symbol = static_cast<uint8_t>(text[position]);
+        suffix_array[bucket_position[symbol]++] = position;
+        rank[position] = bucket_begin[symbol + 1] - 1;
+    }
+
+    for (size_t prefix_length = 1; !groups.empty(); prefix_length *= 2)
+    {
+        // Suffixes in groups of more than one suffix do not contain the unique last symbol within the first
+        // prefix_length symbols, so the suffix prefix_length positions to the right always exists.
+        auto sort_key = [&] (index_t const suffix) { return rank[suffix + prefix_length]; };
+        auto compare = [&] (index_t const lhs, index_t const rhs) { return sort_key(lhs) < sort_key(rhs); };
+
+        auto mark_group_begins = [&] (group_t const & group)
+        {
+            for (size_t position = group.first + 1; position < group.second; ++position)
+                is_group_begin[position] = sort_key(suffix_array[position - 1]) != sort_key(suffix_array[position]);
+        };
+
+        // Phase 1: Sort the groups and mark the begin of the refined groups, while all ranks are still stable.
+        size_t const large_group_size = std::max<size_t>(text_size / (4 * thread_count), 1u << 16);
+        auto small_groups_end = std::partition(groups.begin(), groups.end(), [&] (group_t const & group)
+        {
+            return group.second - group.first < large_group_size;
+        });
+
+        for (auto group_it = small_groups_end; group_it != groups.end(); ++group_it)
+        {
+            parallel_sort(suffix_array.begin() + group_it->first,
+                          suffix_array.begin() + group_it->second,
+                          compare,
+                          thread_count);
+            mark_group_begins(*group_it);
+        }
+
+        std::atomic<size_t> next_group{0};
+        size_t const small_group_count = std::ranges::distance(groups.begin(), small_groups_end);
+        invoke_in_parallel(thread_count, [&] (size_t const)
+        {
+            for (size_t group_id = next_group++; group_id < small_group_count; group_id = next_group++)
+            {
+                group_t const & group = groups[group_id];
+                std::sort(suffix_array.begin() + group.first, suffix_array.begin() + group.second, compare);
+                mark_group_begins(group);
+            }
+        });
+
+        // Phase 2: Update the ranks of the refined groups and collect the groups that need to be sorted again.
+        std::vector<std::vector<group_t>> refined_groups(thread_count);
+        next_group = 0;
+        invoke_in_parallel(thread_count, [&] (size_t const thread_id)
+        {
+            for (size_t group_id = next_group++; group_id < groups.size(); group_id = next_group++)
+            {
+                auto [group_begin, group_end] = groups[group_id];
+
+                for (size_t refined_begin = group_begin; refined_begin < group_end;)
+                {
+                    size_t refined_end = refined_begin + 1;
+                    while (refined_end < group_end && !is_group_begin[refined_end])
+                        ++refined_end;
+
+                    for (size_t position = refined_begin; position < refined_end; ++position)
+                        rank[suffix_array[position]] = refined_end - 1;
+
+                    if (refined_end - refined_begin > 1)
+                        refined_groups[thread_id].emplace_back(refined_begin, refined_end);
+
+                    refined_begin = refined_end;
+                }
+            }
+        });
+
+        groups.clear();
+        for (std::vector<group_t> const & thread_groups : refined_groups)
+            groups.insert(groups.end(), thread_groups.begin(), thread_groups.end());
+    }
+
+    return suffix_array;
+}
+
+/*!\brief Constructs the SDSL index over the given text according to the given options.
+ * \ingroup search
+ * \tparam sdsl_index_t The type of the SDSL index.
+ * \param[out] index The index to construct.
+ * \param[in] text The text, which does not contain the symbol 0 yet; it is changed by this function.
+ * \param[in] options The seqan3::fm_index_construction_options.
+ *
+ * \details
+ *
+ * With the default options the index is constructed with `sdsl::construct_im`. Otherwise, the construction uses the
+ * cached construction of the SDSL: the text and, if more than one thread is used, the suffix array built with
+ * seqan3::detail::parallel_suffix_array are stored in the cache, from which the SDSL builds the Burrows-Wheeler
+ * transform and the index. The cache is kept in the RAM file system of the SDSL if the expected memory footprint
+ * of the construction does not exceed the disk threshold and in the temporary directory otherwise.
+ * All cached files are deleted after the construction.
+ *
+ * \throws std::filesystem::filesystem_error if the temporary directory cannot be determined.
+ */
+template <typename sdsl_index_t>
+void construct_sdsl_index(sdsl_index_t & index,
+                          sdsl::int_vector<8> & text,
+                          fm_index_construction_options const & options)
+{
+    size_t const text_size = text.size() + 1; // Including the symbol 0 added by the SDSL.
+    bool const is_small_text = text_size <= std::numeric_limits<uint32_t>::max();
+
+    // The text, the suffix array with the ranks of the parallel construction, and the Burrows-Wheeler transform.
+    size_t const expected_memory = text_size * (2 + 2 * (is_small_text ? sizeof(uint32_t) : sizeof(uint64_t)));
+    bool const use_disk = expected_memory > options.disk_threshold;
+
+    size_t const thread_count = std::max<size_t>(options.thread_count, 1u);
+
+    if (thread_count == 1 && !use_disk)
+    {
+        sdsl::construct_im(index, text, 0);
+        return;
+    }
+
+    std::string const cache_id = std::to_string(sdsl::util::pid()) + "_" + std::to_string(sdsl::util::id());
+    std::string cache_directory{"@"}; // The prefix of the RAM file system of the SDSL.
+    if (use_disk)
+    {
+        cache_directory = options.temporary_directory.empty() ? std::filesystem::temp_directory_path().string()
+                                                              : options.temporary_directory.string();
+    }
+
+    sdsl::cache_config config{true, cache_directory, cache_id};
+
+    text.resize(text_size);
+    text[text_size - 1] = 0;
+    sdsl::store_to_cache(text, sdsl::conf::KEY_TEXT, config);
+
+    // If the suffix array is not cached, the SDSL builds it sequentially.
+    if (thread_count > 1)
+    {
+        sdsl::int_vector_buffer<> suffix_array_buffer(sdsl::cache_file_name(sdsl::conf::KEY_SA, config),
+                                                      std::ios::out,
+                                                      1024 * 1024,
+                                                      sdsl::bits::hi(text_size) + 1);
+
+        auto store_suffix_array = [&] (auto && suffix_array)
+        {
+            for (auto const suffix : suffix_array)
+                suffix_array_buffer.push_back(suffix);
+        };
+
+        if (is_small_text)
+            store_suffix_array(parallel_suffix_array<uint32_t>(text, thread_count));
+        else
+            store_suffix_array(parallel_suffix_array<uint64_t>(text, thread_count));
+    } // Closing the buffer writes the suffix array to the cache.
+
+    // Builds the Burrows-Wheeler transform and the index from the cache and deletes the cached files afterwards.
+    sdsl::construct(index, sdsl::cache_file_name(sdsl::conf::KEY_TEXT, config), config, 0);
+}
+
+} // namespace seqan3::detail
@@ -80,6 +80,25 @@ struct fm_index_cursor_node
     }
     //!\endcond
 };
+
+/*!\brief Prefetches the memory of a wavelet tree that is read first by a rank query at the given position.
+ * \tparam wavelet_tree_t The type of the wavelet tree of the SDSL index.
+ * \param[in] wavelet_tree The wavelet tree to prefetch from.
+ * \param[in] position The position of the rank query.
+ *
+ * \details
+ *
+ * The first level of the wavelet trees of the SDSL covers the complete Burrows-Wheeler transform, i.e. a rank query
+ * at `position` starts by reading the word of the bit vector that stores `position`. The accesses to the deeper levels
+ * depend on the result of the first level and cannot be prefetched.
+ * Does nothing if the wavelet tree does not expose its bit vector.
+ */
+template <typename wavelet_tree_t>
+inline void prefetch_rank(wavelet_tree_t const & wavelet_tree, size_t const position) noexcept
+{
+    if constexpr (requires { wavelet_tree.bv.data(); wavelet_tree.bv.width(); })
+        __builtin_prefetch(wavelet_tree.bv.data() + position * wavelet_tree.bv.width() / 64);
+}
 //!\}
 
 }
@@ -23,7 +23,9 @@
 #include <seqan3/range/views/to_rank.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_construction.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
 
 namespace seqan3::detail
@@ -102,6 +104,33 @@ class reverse_fm_index;
  * \{
  */
 
+/*!\brief An FM Index Configuration using a Wavelet Tree with a configurable suffix array sampling rate.
+ * \tparam sa_sampling_rate The sampling rate of the suffix array; every `sa_sampling_rate`-th suffix array entry is
+ *                          stored.
+ * \tparam rank_support_t   The rank support of the bit vectors of the wavelet tree, e.g. sdsl::rank_support_v<>
+ *                          (25% additional space) or sdsl::rank_support_v5<> (6.25% additional space).
+ *
+ * \details
+ *
+ * The sampling rate trades the time to locate an occurrence against the size of the index: locating an occurrence
+ * takes \f$SAMPLING\_RATE / 2\f$ backward steps on average and the sampled suffix array takes
+ * \f$n \log n / SAMPLING\_RATE\f$ bits. Counting occurrences is not affected by the sampling rate.
+ *
+ * See seqan3::sdsl_wt_index_type for the details of the wavelet tree and seqan3::sdsl_fast_locate_index_type and
+ * seqan3::sdsl_compact_index_type for ready-made configurations.
+ */
+template <uint32_t sa_sampling_rate, typename rank_support_t = sdsl::rank_support_v<>>
+using basic_sdsl_wt_index_type =
+    sdsl::csa_wt<sdsl::wt_blcd<sdsl::bit_vector, // Wavelet tree type
+                               rank_support_t,
+                               sdsl::select_support_scan<>,
+                               sdsl::select_support_scan<0>>,
+                 sa_sampling_rate, // Sampling rate of the suffix array
+                 10'000'000, // Sampling rate of the inverse suffix array
+                 sdsl::sa_order_sa_sampling<>, // How to sample positions in the suffix array (text VS SA sampling)
+                 sdsl::isa_sampling<>, // How to sample positons in the inverse suffix array
+                 sdsl::plain_byte_alphabet>; // How to represent the alphabet
+
 /*!\brief The FM Index Configuration using a Wavelet Tree.
  *
  * \details
@@ -133,11 +162,51 @@ class reverse_fm_index;
  * \if DEV \todo Asymptotic space consumption: \endif
  *
  */
-using sdsl_wt_index_type =
-    sdsl::csa_wt<sdsl::wt_blcd<sdsl::bit_vector, // Wavelet tree type
-                               sdsl::rank_support_v<>,
-                               sdsl::select_support_scan<>,
-                               sdsl::select_support_scan<0>>,
+using sdsl_wt_index_type = basic_sdsl_wt_index_type<16>;
+
+/*!\brief The FM Index Configuration for fast locating of occurrences.
+ *
+ * \details
+ *
+ * Same as seqan3::sdsl_wt_index_type, but every fourth suffix array entry is sampled. Locating an occurrence takes
+ * 2 instead of 8 backward steps on average, while the sampled suffix array takes four times the space, i.e.
+ * \f$n \log n / 4\f$ bits.
+ */
+using sdsl_fast_locate_index_type = basic_sdsl_wt_index_type<4>;
+
+/*!\brief The space-efficient FM Index Configuration.
+ *
+ * \details
+ *
+ * Same as seqan3::sdsl_wt_index_type, but only every 64th suffix array entry is sampled and the rank support of the
+ * wavelet tree takes 6.25% instead of 25% additional space (sdsl::rank_support_v5). Locating an occurrence takes
+ * 32 backward steps on average and every backward step is slightly slower.
+ */
+using sdsl_compact_index_type = basic_sdsl_wt_index_type<64, sdsl::rank_support_v5<>>;
+
+/*!\brief The FM Index Configuration using an EPR dictionary for small alphabets.
+ * \tparam alphabet_t The alphabet type of the indexed text; must model seqan3::semialphabet and have an alphabet
+ *                    size of at most 16.
+ *
+ * \details
+ *
+ * Instead of a wavelet tree, the Burrows-Wheeler transform is stored in an EPR dictionary (sdsl::wt_epr), an
+ * interleaved rank data structure: the text is divided into blocks and every block stores the occurrence counts of
+ * all symbols next to the bit-packed symbols of the block. A rank query, i.e. a backward search step, needs a single
+ * block and thus about one cache miss instead of one per level of the wavelet tree. The bidirectional search
+ * (`lex_count`) needs the same block once more.
+ *
+ * The rank data structure takes \f$O(\Sigma)\f$ counts per block, which is why it is only reasonable for small
+ * alphabets like seqan3::dna4 or seqan3::dna5. The suffix array is sampled like in seqan3::sdsl_wt_index_type.
+ *
+ * \f$T_{BACKWARD\_SEARCH}: O(1)\f$
+ */
+template <semialphabet alphabet_t>
+//!\cond
+    requires (alphabet_size<alphabet_t> <= 16)
+//!\endcond
+using sdsl_epr_index_type =
+    sdsl::csa_wt<sdsl::wt_epr<alphabet_size<alphabet_t> + 2>, // The sentinel, the symbols and the delimiter.
                  16, // Sampling rate of the suffix array
                  10'000'000, // Sampling rate of the inverse suffix array
                  sdsl::sa_order_sa_sampling<>, // How to sample positions in the suffix array (text VS SA sampling)
@@ -182,11 +251,25 @@ using default_sdsl_index_type = sdsl_wt_index_type;
  * ### Choosing an index implementation
  *
  * The underlying implementation of the FM Index (rank data structure, sampling rates, etc.) can be specified by
- * passing a new SDSL index type as second template parameter:
+ * passing a new SDSL index type as third template parameter:
  *
  * \todo Link to SDSL documentation or write our own once SDSL3 documentation is available somewhere....
  *
  * \endif
+ *
+ * ### Index configurations
+ *
+ * The third template parameter selects the trade-off between the time to locate occurrences and the size of the index.
+ * Besides the seqan3::default_sdsl_index_type, the ready-made configurations seqan3::sdsl_fast_locate_index_type and
+ * seqan3::sdsl_compact_index_type are available and seqan3::basic_sdsl_wt_index_type allows to choose the sampling rate
+ * of the suffix array. For small alphabets like seqan3::dna4, seqan3::sdsl_epr_index_type speeds up every search step
+ * by replacing the wavelet tree with an EPR dictionary:
+ *
+ * ```cpp
+ * seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_fast_locate_index_type> index{text};
+ * using epr_index_type = seqan3::sdsl_epr_index_type<seqan3::dna4>;
+ * seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, epr_index_type> bi_index{text};
+ * ```
  */
 template <semialphabet alphabet_t,
           text_layout text_layout_mode_,
@@ -223,6 +306,7 @@ private:
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
      * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options.
      *
      * \details
      * \if DEV
@@ -242,7 +326,7 @@ private:
     //!\cond
         requires (text_layout_mode_ == text_layout::single)
     //!\endcond
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options)
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
@@ -250,7 +334,6 @@ private:
 
         // TODO:
         // * check what happens in sdsl when constructed twice!
-        // * choose between in-memory/external and construction algorithms
         // * sdsl construction currently only works for int_vector, std::string and char *, not ranges in general
         // uint8_t largest_char = 0;
         sdsl::int_vector<8> tmp_text(std::ranges::distance(text));
@@ -271,7 +354,7 @@ private:
                           | std::views::reverse,
                           std::ranges::begin(tmp_text)); // reverse and increase rank by one
 
-        sdsl::construct_im(index, tmp_text, 0);
+        detail::construct_sdsl_index(index, tmp_text, options);
 
         // TODO: would be nice but doesn't work since it's private and the public member references are const
         // index.m_C.resize(largest_char);
@@ -284,7 +367,7 @@ private:
     //!\cond
         requires (text_layout_mode_ == text_layout::collection)
     //!\endcond
-    void construct(text_t && text, bool reverse = false)
+    void construct(text_t && text, fm_index_construction_options const & options, bool reverse = false)
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
@@ -368,7 +451,7 @@ private:
             }
         }
 
-        sdsl::construct_im(index, tmp_text, 0);
+        detail::construct_sdsl_index(index, tmp_text, options);
     }
 
 public:
@@ -436,15 +519,17 @@ public:
     /*!\brief Constructor that immediately constructs the index given a range. The range cannot be empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
      * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options, e.g. the number of threads used to build the
+     *                    suffix array and when the intermediate files are placed on disk.
      *
      * ### Complexity
      *
      * \if DEV \todo \endif At least linear.
      */
     template <std::ranges::bidirectional_range text_t>
-    explicit fm_index(text_t && text)
+    explicit fm_index(text_t && text, fm_index_construction_options const & options = {})
     {
-        construct(std::forward<text_t>(text));
+        construct(std::forward<text_t>(text), options);
     }
     //!\}
 
@@ -578,6 +663,11 @@ public:
 //! \brief Deduces the alphabet and dimensions of the text.
 template <std::ranges::range text_t>
 fm_index(text_t &&) -> fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//! \brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+fm_index(text_t &&, fm_index_construction_options const &)
+    -> fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
 //!\}
 
 //!\}
@@ -607,28 +697,28 @@ class reverse_fm_index : public fm_index<alphabet_t, text_layout_mode, sdsl_inde
 private:
     //!\copydoc seqan3::fm_index::construct()
     template <std::ranges::range text_t>
-    void construct_(text_t && text)
+    void construct_(text_t && text, fm_index_construction_options const & options)
     {
         if constexpr (text_layout_mode == text_layout::single)
         {
             auto reverse_text = text | std::views::reverse;
-            this->construct(reverse_text);
+            this->construct(reverse_text, options);
         }
         else
         {
             auto reverse_text = text | views::deep{std::views::reverse} | std::views::reverse;
-            this->construct(reverse_text, true);
+            this->construct(reverse_text, options, true);
         }
     }
 
 public:
     using fm_index<alphabet_t, text_layout_mode, sdsl_index_type>::fm_index;
 
-    //!\copydoc seqan3::fm_index::fm_index(text_t && text)
+    //!\copydoc seqan3::fm_index::fm_index(text_t && text, fm_index_construction_options const & options)
     template <std::ranges::bidirectional_range text_t>
-    explicit reverse_fm_index(text_t && text)
+    explicit reverse_fm_index(text_t && text, fm_index_construction_options const & options = {})
     {
-        construct_(std::forward<text_t>(text));
+        construct_(std::forward<text_t>(text), options);
     }
 
 };
@@ -0,0 +1,52 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fm_index_construction_options.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/std/filesystem>
+#include <limits>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The options type defines various option members that influence the construction of the seqan3::fm_index
+ *        and the seqan3::bi_fm_index.
+ * \ingroup submodule_fm_index
+ *
+ * \details
+ *
+ * By default the index is constructed in memory with the sequential construction of the SDSL. If more than one thread
+ * is given, the suffix array is built in parallel. If the estimated memory footprint of the construction exceeds
+ * the disk threshold, the intermediate files of the construction (the text, the suffix array and the Burrows-Wheeler
+ * transform) are placed in the temporary directory instead of the RAM file system of the SDSL. The constructed index
+ * is the same for all options.
+ *
+ * \attention The options do not bound the peak memory of the construction. Placing the intermediate files on disk
+ *            only frees the memory of the files themselves; the suffix array is always built in memory. The
+ *            parallel construction keeps the text, two integers per text position and another byte per text
+ *            position in memory, and the sequential construction of the SDSL keeps the text and the suffix array.
+ */
+struct fm_index_construction_options
+{
+    //!\brief The number of threads used to build the suffix array.
+    uint32_t thread_count = 1;
+    /*!\brief The estimated memory footprint in bytes above which the intermediate files of the construction are
+     *        placed on disk; this does not bound the peak memory of the construction.
+     */
+    size_t disk_threshold = std::numeric_limits<size_t>::max();
+    //!\brief The directory for the intermediate files placed on disk; empty means the system temporary directory.
+    std::filesystem::path temporary_directory{};
+};
+
+} // namespace seqan3
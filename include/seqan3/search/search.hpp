@@ -18,10 +18,12 @@
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/range/views/chunk.hpp>
 #include <seqan3/range/views/convert.hpp>
 #include <seqan3/range/views/deep.hpp>
 #include <seqan3/range/views/persist.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
 #include <seqan3/search/configuration/parallel.hpp>
@@ -114,7 +116,27 @@ inline auto search(queries_t && queries,
     detail::search_configuration_validator::validate_query_type<queries_t>();
 
     size_t queries_size = std::ranges::distance(queries);
-    auto indexed_queries = views::zip(std::views::iota(size_t{0}, queries_size), queries);
+
+    // Search the queries one by one or in batches of queries if configured.
+    auto select_indexed_queries = [&] ()
+    {
+        auto indexed_queries = views::zip(std::views::iota(size_t{0}, queries_size), queries);
+
+        if constexpr (decltype(updated_cfg)::template exists<search_cfg::batch>())
+        {
+            size_t const batch_size = get<search_cfg::batch>(updated_cfg).size;
+            if (batch_size == 0)
+                throw std::invalid_argument{"The batch size in seqan3::search_cfg::batch must be greater than 0."};
+
+            return std::move(indexed_queries) | views::chunk(batch_size);
+        }
+        else
+        {
+            return indexed_queries;
+        }
+    };
+
+    auto indexed_queries = select_indexed_queries();
 
     using indexed_queries_t = decltype(indexed_queries);
 
@@ -124,26 +146,38 @@ inline auto search(queries_t && queries,
     using complete_configuration_t = decltype(complete_config);
     using traits_t = detail::search_traits<complete_configuration_t>;
     using algorithm_result_t = typename traits_t::search_result_type;
+    constexpr bool work_stealing = complete_configuration_t::template exists<search_cfg::parallel_work_stealing>();
+    using parallel_t = std::conditional_t<work_stealing, search_cfg::parallel_work_stealing, search_cfg::parallel>;
     using execution_handler_t = std::conditional_t<
-                                    complete_configuration_t::template exists<search_cfg::parallel>(),
-                                    detail::execution_handler_parallel,
-                                    detail::execution_handler_sequential>;
+                                    work_stealing,
+                                    detail::execution_handler_work_stealing,
+                                    std::conditional_t<
+                                        complete_configuration_t::template exists<search_cfg::parallel>(),
+                                        detail::execution_handler_parallel,
+                                        detail::execution_handler_sequential>>;
 
     // Select the execution handler for the search configuration.
     auto select_execution_handler = [&] ()
     {
-        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_sequential>)
+        {
+            return execution_handler_t{};
+        }
+        else
         {
-            auto thread_count = get<search_cfg::parallel>(complete_config).thread_count;
+            auto const & parallel_config = get<parallel_t>(complete_config);
+            if constexpr (work_stealing)
+            {
+                if (parallel_config.pool != nullptr)
+                    return execution_handler_t{*parallel_config.pool};
+            }
+
+            auto thread_count = parallel_config.thread_count;
             if (!thread_count)
                 throw std::runtime_error{"You must configure the number of threads in seqan3::search_cfg::parallel."};
 
             return execution_handler_t{*thread_count};
         }
-        else
-        {
-            return execution_handler_t{};
-        }
     };
 
     // Finally, choose between two way execution returning an algorithm range or calling a user callback on every hit.
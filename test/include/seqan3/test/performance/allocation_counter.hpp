@@ -0,0 +1,104 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides a global heap allocation counter for benchmarks.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ *
+ * \details
+ *
+ * This header replaces the global allocation functions `operator new` and `operator delete` with versions that count
+ * every heap allocation of the program. Since replacement allocation functions must be defined exactly once per
+ * program, this header must only be included by a single translation unit, i.e. the benchmark source file.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::test
+{
+
+//!\brief The number of heap allocations performed since the program started.
+inline std::atomic<size_t> allocation_count{0};
+
+/*!\brief Returns a benchmark counter with the number of heap allocations per alignment.
+ * \param allocations              The number of allocations of the complete benchmark run.
+ * \param alignments_per_iteration The number of alignments computed in one benchmark iteration.
+ * \return Returns a benchmark Counter which represents allocations/alignment.
+ *
+ * \details
+ *
+ * Use it together with seqan3::test::allocation_count, e.g.:
+ *
+ * ```cpp
+ * size_t const allocations_before = seqan3::test::allocation_count;
+ * for (auto _ : state)
+ *     ...
+ * state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+ *                                                                    allocations_before);
+ * ```
+ */
+inline benchmark::Counter allocations_per_alignment(size_t const allocations, size_t const alignments_per_iteration = 1)
+{
+    return benchmark::Counter(static_cast<double>(allocations) / alignments_per_iteration,
+                              benchmark::Counter::kAvgIterations);
+}
+
+} // namespace seqan3::test
+
+//!\cond
+void * operator new(std::size_t size)
+{
+    seqan3::test::allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (void * ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+    seqan3::test::allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    // std::aligned_alloc requires the size to be a multiple of the alignment.
+    size_t const align = static_cast<size_t>(alignment);
+    size_t const aligned_size = ((size == 0 ? 1 : size) + align - 1) / align * align;
+
+    if (void * ptr = std::aligned_alloc(align, aligned_size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+//!\endcond
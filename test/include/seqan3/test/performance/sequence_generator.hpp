@@ -15,6 +15,7 @@
 
 #include <seqan3/std/algorithm>
 #include <random>
+#include <vector>
 
 #include <seqan3/range/concept.hpp>
 #include <seqan3/test/seqan2.hpp>
@@ -141,6 +142,55 @@ auto generate_sequence_pairs(size_t const size,
     return sequence_pairs;
 }
 
+/*!\brief Returns a copy of the given sequence with randomly placed substitutions, insertions and deletions.
+ * \param sequence The sequence to mutate.
+ * \param divergence The fraction of positions to mutate, e.g. `0.05` mutates 5% of the positions.
+ * \param seed The seed of the random engine.
+ *
+ * \details
+ *
+ * Every mutated position is substituted by a different symbol, preceded by an inserted symbol or deleted with equal
+ * probability. The result can be used to generate sequence pairs with a given divergence.
+ */
+template <typename alphabet_t>
+auto mutate_sequence(std::vector<alphabet_t> const & sequence, double const divergence, size_t const seed = 0)
+{
+    std::mt19937_64 random_engine{seed};
+    std::bernoulli_distribution mutate_distribution{divergence};
+    std::uniform_int_distribution<size_t> mutation_type_distribution{0, 2};
+    std::uniform_int_distribution<size_t> rank_distribution{1, seqan3::alphabet_size<alphabet_t> - 1};
+
+    std::vector<alphabet_t> mutated_sequence{};
+    mutated_sequence.reserve(sequence.size() + sequence.size() / 2);
+    for (alphabet_t const symbol : sequence)
+    {
+        if (!mutate_distribution(random_engine))
+        {
+            mutated_sequence.push_back(symbol);
+            continue;
+        }
+
+        // An offset in [1, size) always results in a different symbol.
+        auto const other_rank = (seqan3::to_rank(symbol) + rank_distribution(random_engine)) %
+                                seqan3::alphabet_size<alphabet_t>;
+
+        switch (mutation_type_distribution(random_engine))
+        {
+            case 0: // substitution
+                mutated_sequence.push_back(seqan3::assign_rank_to(other_rank, alphabet_t{}));
+                break;
+            case 1: // insertion
+                mutated_sequence.push_back(seqan3::assign_rank_to(other_rank, alphabet_t{}));
+                mutated_sequence.push_back(symbol);
+                break;
+            default: // deletion
+                break;
+        }
+    }
+
+    return mutated_sequence;
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 auto generate_sequence_seqan2(size_t const len = 500,
@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/query_profile.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/repeat_n.hpp>
+#include <seqan3/range/views/zip.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/std/ranges>
+
+// Compares the scalar, the inter-sequence vectorised and the striped (intra-sequence) vectorised alignment for a
+// single pair of long sequences to find the crossover point from which on the striped mode pays off.
+
+// Range of the sequence lengths.
+inline constexpr size_t sequence_length_begin = 1'000;
+inline constexpr size_t sequence_length_end = 100'000;
+inline constexpr size_t sequence_length_multiplier = 10;
+
+constexpr auto nt_score_scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                   seqan3::mismatch_score{-5}};
+constexpr auto gap_cost = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                             seqan3::align_cfg::extension_score{-1}};
+constexpr auto global_affine_cfg = seqan3::align_cfg::method_global{} |
+                                   gap_cost |
+                                   seqan3::align_cfg::scoring_scheme{nt_score_scheme};
+constexpr auto local_affine_cfg = seqan3::align_cfg::method_local{} |
+                                  gap_cost |
+                                  seqan3::align_cfg::scoring_scheme{nt_score_scheme};
+
+template <typename align_cfg_t, typename ...configs_t>
+void seqan3_affine_single_pair(benchmark::State & state, align_cfg_t base_cfg, configs_t && ...configs)
+{
+    size_t const sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    auto align_cfg = (base_cfg | ... | configs) | seqan3::align_cfg::output_score{} |
+                                                  seqan3::align_cfg::output_end_position{};
+
+    for (auto _ : state)
+    {
+        auto rng = seqan3::align_pairwise(std::tie(seq1, seq2), align_cfg);
+        benchmark::DoNotOptimize((*std::ranges::begin(rng)).score());
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  base_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// ----------------------------------------------------------------------------
+// Global alignment
+// ----------------------------------------------------------------------------
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair, global_scalar, global_affine_cfg)
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair,
+                  global_simd,
+                  global_affine_cfg,
+                  seqan3::align_cfg::vectorised{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair,
+                  global_striped,
+                  global_affine_cfg,
+                  seqan3::align_cfg::vectorised_striped{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair,
+                  global_striped_int16,
+                  global_affine_cfg,
+                  seqan3::align_cfg::vectorised_striped{},
+                  seqan3::align_cfg::score_type<int16_t>{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end / 10)
+    ->Unit(benchmark::kMillisecond);
+
+// ----------------------------------------------------------------------------
+// Local alignment
+// ----------------------------------------------------------------------------
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair, local_scalar, local_affine_cfg)
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair,
+                  local_simd,
+                  local_affine_cfg,
+                  seqan3::align_cfg::vectorised{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair,
+                  local_striped,
+                  local_affine_cfg,
+                  seqan3::align_cfg::vectorised_striped{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_single_pair,
+                  local_striped_int16,
+                  local_affine_cfg,
+                  seqan3::align_cfg::vectorised_striped{},
+                  seqan3::align_cfg::score_type<int16_t>{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+// ----------------------------------------------------------------------------
+// One query against many targets
+// ----------------------------------------------------------------------------
+
+// Scans a protein database with one query and either computes the query profile for every target or uses a
+// precomputed seqan3::query_profile.
+template <bool use_query_profile>
+void seqan3_affine_protein_scan(benchmark::State & state)
+{
+    size_t const query_length = state.range(0);
+    size_t const target_count = 1'000;
+
+    auto query = seqan3::test::generate_sequence<seqan3::aa27>(query_length, 0, 0);
+    std::vector<std::vector<seqan3::aa27>> database{};
+    for (size_t i = 0; i < target_count; ++i)
+        database.push_back(seqan3::test::generate_sequence<seqan3::aa27>(300, 100, i + 1));
+
+    seqan3::aminoacid_scoring_scheme scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62};
+    auto sequence_pairs = seqan3::views::zip(database, seqan3::views::repeat_n(query, target_count));
+    auto base_cfg = seqan3::align_cfg::method_local{} |
+                    gap_cost |
+                    seqan3::align_cfg::scoring_scheme{scheme} |
+                    seqan3::align_cfg::vectorised_striped{} |
+                    seqan3::align_cfg::output_score{};
+
+    int32_t total_score{};
+    auto run = [&] (auto const & align_cfg)
+    {
+        for (auto _ : state)
+        {
+            for (auto && res : seqan3::align_pairwise(sequence_pairs, align_cfg))
+                total_score += res.score();
+        }
+    };
+
+    if constexpr (use_query_profile)
+    {
+        seqan3::query_profile profile{query, scheme};
+        run(base_cfg | seqan3::align_cfg::query_profile{profile});
+    }
+    else
+    {
+        run(base_cfg);
+    }
+
+    benchmark::DoNotOptimize(total_score);
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(sequence_pairs, base_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_protein_scan, false)->RangeMultiplier(4)->Range(64, 1'024);
+BENCHMARK_TEMPLATE(seqan3_affine_protein_scan, true)->RangeMultiplier(4)->Range(64, 1'024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/std/algorithm>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/std/ranges>
+
+// Compares the unbanded with the banded bit-vector edit distance of two similar sequences. The banded algorithm only
+// computes the blocks overlapping the band, such that its runtime grows with the band width instead of the length of
+// the second sequence.
+
+inline constexpr size_t sequence_length = 10'000;
+
+constexpr auto global_cfg = seqan3::align_cfg::method_global{} |
+                            seqan3::align_cfg::edit_scheme |
+                            seqan3::align_cfg::output_score{};
+
+constexpr auto semi_global_cfg = seqan3::align_cfg::method_global{
+                                     seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                     seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+                                 seqan3::align_cfg::edit_scheme |
+                                 seqan3::align_cfg::output_score{} |
+                                 seqan3::align_cfg::output_end_position{};
+
+template <typename align_cfg_t>
+void run_edit_distance(benchmark::State & state, align_cfg_t const & align_cfg, bool const is_banded)
+{
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::mutate_sequence(seq1, 0.01, 1);
+
+    // The band is centred around the diagonals of the first and the last cell.
+    int32_t const size_difference = static_cast<int32_t>(seq1.size()) - static_cast<int32_t>(seq2.size());
+    int32_t const band_width = state.range(0);
+    auto band = seqan3::align_cfg::band_fixed_size{
+                    seqan3::align_cfg::lower_diagonal{std::min(0, size_difference) - band_width},
+                    seqan3::align_cfg::upper_diagonal{std::max(0, size_difference) + band_width}};
+
+    int32_t score = 0;
+    for (auto _ : state)
+    {
+        if (is_banded)
+            score = (*std::ranges::begin(seqan3::align_pairwise(std::tie(seq1, seq2), align_cfg | band))).score();
+        else
+            score = (*std::ranges::begin(seqan3::align_pairwise(std::tie(seq1, seq2), align_cfg))).score();
+
+        benchmark::DoNotOptimize(score);
+    }
+
+    state.counters["score"] = score;
+    state.counters["band_width"] = band_width;
+    auto sequences = std::views::single(std::tie(seq1, seq2));
+    state.counters["cells"] = is_banded ? seqan3::test::pairwise_cell_updates(sequences, align_cfg | band)
+                                        : seqan3::test::pairwise_cell_updates(sequences, align_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+void seqan3_edit_distance_dna4_unbanded(benchmark::State & state)
+{
+    run_edit_distance(state, global_cfg, false);
+}
+
+void seqan3_edit_distance_dna4_banded(benchmark::State & state)
+{
+    run_edit_distance(state, global_cfg, true);
+}
+
+void seqan3_semi_global_edit_distance_dna4_banded(benchmark::State & state)
+{
+    run_edit_distance(state, semi_global_cfg, true);
+}
+
+BENCHMARK(seqan3_edit_distance_dna4_unbanded)->Arg(0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(seqan3_edit_distance_dna4_banded)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(seqan3_semi_global_edit_distance_dna4_banded)->RangeMultiplier(4)->Range(16, 1024)
+                                                       ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
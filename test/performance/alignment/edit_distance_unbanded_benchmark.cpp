@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/zip.hpp>
@@ -166,6 +167,35 @@ void seqan3_edit_distance_dna4_collection_selector(benchmark::State & state)
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
 }
 
+// Aligns short queries against a longer database sequence, which are packed into simd lanes if vectorised.
+template <typename ...configs_t>
+void seqan3_edit_distance_dna4_short_query_collection(benchmark::State & state, configs_t && ...configs)
+{
+    size_t const query_length = state.range(0);
+    size_t const database_length = 150;
+    size_t const set_size = 1'000;
+
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> vec{};
+    for (size_t i = 0; i < set_size; ++i)
+    {
+        vec.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(database_length, 0, i),
+                         seqan3::test::generate_sequence<seqan3::dna4>(query_length, 0, i + set_size));
+    }
+
+    auto align_cfg = (edit_distance_cfg | ... | configs);
+    int score = 0;
+
+    for (auto _ : state)
+    {
+        for (auto && rng : align_pairwise(vec, align_cfg))
+            score += rng.score();
+    }
+
+    state.counters["score"] = score;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, edit_distance_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 void seqan2_edit_distance_dna4_collection(benchmark::State & state)
 {
@@ -224,6 +254,9 @@ BENCHMARK(seqan2_edit_distance_generic_dna4);
 #endif
 BENCHMARK(seqan3_edit_distance_dna4_collection);
 BENCHMARK(seqan3_edit_distance_dna4_collection_selector);
+BENCHMARK_CAPTURE(seqan3_edit_distance_dna4_short_query_collection, scalar)->Arg(16)->Arg(32)->Arg(64);
+BENCHMARK_CAPTURE(seqan3_edit_distance_dna4_short_query_collection, vectorised, seqan3::align_cfg::vectorised{})
+    ->Arg(16)->Arg(32)->Arg(64);
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK(seqan2_edit_distance_dna4_collection);
 BENCHMARK(seqan2_edit_distance_dna4_generic_collection);
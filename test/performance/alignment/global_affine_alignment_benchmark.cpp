@@ -17,6 +17,7 @@
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/test/performance/allocation_counter.hpp>
 #include <seqan3/test/performance/units.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/seqan2.hpp>
@@ -43,6 +44,7 @@ void seqan3_affine_dna4(benchmark::State & state)
     auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
     auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg | seqan3::align_cfg::output_score{});
@@ -51,6 +53,8 @@ void seqan3_affine_dna4(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan3_affine_dna4);
@@ -63,6 +67,7 @@ void seqan2_affine_dna4(benchmark::State & state)
     auto seq1 = seqan3::test::generate_sequence_seqan2<seqan::Dna>(sequence_length, 0, 0);
     auto seq2 = seqan3::test::generate_sequence_seqan2<seqan::Dna>(sequence_length, 0, 1);
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -71,6 +76,8 @@ void seqan2_affine_dna4(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan2_affine_dna4);
@@ -86,6 +93,7 @@ void seqan3_affine_dna4_trace(benchmark::State & state)
     auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
     auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg | seqan3::align_cfg::output_alignment{});
@@ -94,6 +102,8 @@ void seqan3_affine_dna4_trace(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan3_affine_dna4_trace);
@@ -108,6 +118,7 @@ void seqan2_affine_dna4_trace(benchmark::State & state)
 
     seqan::Gaps<decltype(seq1)> gap1{seq1};
     seqan::Gaps<decltype(seq2)> gap2{seq2};
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -116,6 +127,8 @@ void seqan2_affine_dna4_trace(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan2_affine_dna4_trace);
@@ -139,6 +152,7 @@ void seqan3_affine_dna4_collection(benchmark::State & state)
         vec.push_back(std::pair{seq1, seq2});
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         for (auto && rng : align_pairwise(vec, affine_cfg | seqan3::align_cfg::output_score{}))
@@ -147,6 +161,8 @@ void seqan3_affine_dna4_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, set_size);
 }
 
 BENCHMARK(seqan3_affine_dna4_collection);
@@ -169,6 +185,7 @@ void seqan2_affine_dna4_collection(benchmark::State & state)
         appendValue(vec2, seq2);
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -177,6 +194,8 @@ void seqan2_affine_dna4_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, set_size);
 }
 
 BENCHMARK(seqan2_affine_dna4_collection);
@@ -200,6 +219,7 @@ void seqan3_affine_dna4_trace_collection(benchmark::State & state)
         vec.push_back(std::pair{seq1, seq2});
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         for (auto && rng : align_pairwise(vec, affine_cfg | seqan3::align_cfg::output_alignment{}))
@@ -208,6 +228,8 @@ void seqan3_affine_dna4_trace_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, set_size);
 }
 
 BENCHMARK(seqan3_affine_dna4_trace_collection);
@@ -239,6 +261,7 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
         appendValue(gap2, seqan::Gaps<sequence_t>{vec2[i]});
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -247,6 +270,8 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, set_size);
 }
 
 BENCHMARK(seqan2_affine_dna4_trace_collection);
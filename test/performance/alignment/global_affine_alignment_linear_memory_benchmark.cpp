@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/std/ranges>
+
+// Compares the runtime and the allocated memory of the global alignment with the full trace matrix and with the
+// linear memory traceback for a single pair of sequences of growing length.
+
+// ----------------------------------------------------------------------------
+// Allocation counting
+// ----------------------------------------------------------------------------
+
+// All allocations of this benchmark are counted to report the memory needed for a single alignment.
+std::atomic<size_t> allocated_bytes{0};
+
+void * operator new(size_t const size)
+{
+    allocated_bytes += size;
+    if (void * ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void * operator new(size_t const size, std::align_val_t const alignment)
+{
+    allocated_bytes += size;
+    size_t const align = static_cast<size_t>(alignment);
+    // std::aligned_alloc requires the size to be a multiple of the alignment.
+    if (void * ptr = std::aligned_alloc(align, (size + align - 1) / align * align))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+// ----------------------------------------------------------------------------
+// Benchmark
+// ----------------------------------------------------------------------------
+
+// Range of the sequence lengths.
+inline constexpr size_t sequence_length_begin = 1'000;
+inline constexpr size_t sequence_length_end = 16'000;
+inline constexpr size_t sequence_length_multiplier = 4;
+
+constexpr auto nt_score_scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                   seqan3::mismatch_score{-5}};
+constexpr auto affine_cfg = seqan3::align_cfg::method_global{} |
+                            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                               seqan3::align_cfg::extension_score{-1}} |
+                            seqan3::align_cfg::scoring_scheme{nt_score_scheme};
+
+template <typename ...configs_t>
+void seqan3_affine_dna4_trace(benchmark::State & state, configs_t && ...configs)
+{
+    size_t const sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    auto align_cfg = (affine_cfg | ... | configs) | seqan3::align_cfg::output_score{} |
+                                                    seqan3::align_cfg::output_alignment{};
+
+    auto align = [&] ()
+    {
+        auto rng = seqan3::align_pairwise(std::tie(seq1, seq2), align_cfg);
+        benchmark::DoNotOptimize((*std::ranges::begin(rng)).score());
+    };
+
+    // The alignment matrices are cached in thread local storage, so the memory is measured on a fresh thread.
+    size_t const bytes_before = allocated_bytes.load();
+    std::thread{align}.join();
+    state.counters["allocated_bytes"] = allocated_bytes.load() - bytes_before;
+
+    for (auto _ : state)
+        align();
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace, full_trace_matrix)
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace, linear_memory, seqan3::align_cfg::linear_memory_traceback{})
+    ->RangeMultiplier(sequence_length_multiplier)
+    ->Range(sequence_length_begin, sequence_length_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -11,12 +11,15 @@
 #include <iostream>
 #include <memory>
 #include <random>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include <seqan3/alignment/configuration/align_config_unordered_results.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/algorithm/thread_pool.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/range/views/zip.hpp>
 #include <seqan3/test/performance/units.hpp>
@@ -109,6 +112,107 @@ void seqan3_affine_dna4_parallel(benchmark::State & state)
 BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, score)->UseRealTime();
 BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, trace)->UseRealTime();
 
+template <typename result_t>
+void seqan3_affine_dna4_parallel_unordered(benchmark::State & state)
+{
+    auto [vec1, vec2] = generate_data_seqan3<seqan3::dna4>();
+
+    auto data = seqan3::views::zip(vec1, vec2) | seqan3::views::to<std::vector>;
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        for (auto && res : align_pairwise(data, affine_cfg |
+                                                result_t{} |
+                                                seqan3::align_cfg::parallel{std::thread::hardware_concurrency()} |
+                                                seqan3::align_cfg::unordered_results{}))
+        {
+            total += res.score();
+        }
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_unordered, score)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_unordered, trace)->UseRealTime();
+
+// ============================================================================
+//  affine; score; dna4; collection; thread scaling
+// ============================================================================
+
+template <typename result_t, typename parallel_t>
+void seqan3_affine_dna4_parallel_scaling(benchmark::State & state)
+{
+    uint32_t const thread_count = state.range(0);
+    auto [vec1, vec2] = generate_data_seqan3<seqan3::dna4>();
+
+    auto data = seqan3::views::zip(vec1, vec2) | seqan3::views::to<std::vector>;
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        for (auto && res : align_pairwise(data, affine_cfg | result_t{} | parallel_t{thread_count}))
+            total += res.score();
+    }
+
+    state.counters["threads"] = thread_count;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_scaling, score, seqan3::align_cfg::parallel)
+    ->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_scaling, score, seqan3::align_cfg::parallel_work_stealing)
+    ->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_scaling, trace, seqan3::align_cfg::parallel)
+    ->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_scaling, trace, seqan3::align_cfg::parallel_work_stealing)
+    ->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+// ============================================================================
+//  affine; score; dna4; many small batches with and without a shared thread pool
+// ============================================================================
+
+template <bool use_thread_pool>
+void seqan3_affine_dna4_small_batches(benchmark::State & state)
+{
+    size_t const batch_size = state.range(0);
+    auto [vec1, vec2] = generate_data_seqan3<seqan3::dna4>();
+
+    auto data = seqan3::views::zip(vec1, vec2) | seqan3::views::to<std::vector>;
+    seqan3::thread_pool pool{std::thread::hardware_concurrency()};
+
+    auto parallel_cfg = [&] ()
+    {
+        if constexpr (use_thread_pool)
+            return seqan3::align_cfg::parallel_work_stealing{pool};
+        else
+            return seqan3::align_cfg::parallel_work_stealing{std::thread::hardware_concurrency()};
+    };
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        for (size_t batch_begin = 0; batch_begin < data.size(); batch_begin += batch_size)
+        {
+            auto batch = data | std::views::drop(batch_begin) | std::views::take(batch_size);
+            for (auto && res : align_pairwise(batch, affine_cfg | score{} | parallel_cfg()))
+                total += res.score();
+        }
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_small_batches, false)->Arg(4)->Arg(32)->UseRealTime();
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_small_batches, true)->Arg(4)->Arg(32)->UseRealTime();
+
 #if defined(_OPENMP)
 template <typename result_t>
 void seqan3_affine_dna4_omp_for(benchmark::State & state)
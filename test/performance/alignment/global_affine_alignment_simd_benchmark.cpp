@@ -46,6 +46,17 @@ BENCHMARK_CAPTURE(seqan3_affine_accelerated,
                         ->UseRealTime()
                         ->DenseRange(deviation_begin, deviation_end, deviation_step);
 
+BENCHMARK_CAPTURE(seqan3_affine_accelerated,
+                  simd_with_alignment,
+                  seqan3::dna4{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::output_alignment{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
 BENCHMARK_CAPTURE(seqan3_affine_accelerated,
                   simd_parallel_with_score,
                   seqan3::dna4{},
@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/std/ranges>
+
+// Compares the wavefront algorithm with the dynamic programming based affine alignment and with the bit-parallel
+// edit distance for sequence pairs of increasing divergence. The wavefront algorithm is expected to win for
+// similar sequences and to fall behind once the penalty of the optimal alignment becomes large.
+
+// Divergence of the sequence pairs in per mille.
+inline constexpr size_t divergence_begin = 1;
+inline constexpr size_t divergence_end = 256;
+inline constexpr size_t divergence_multiplier = 4;
+
+inline constexpr size_t sequence_length = 10'000;
+
+constexpr auto nt_score_scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                   seqan3::mismatch_score{-5}};
+constexpr auto affine_cfg = seqan3::align_cfg::method_global{} |
+                            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                               seqan3::align_cfg::extension_score{-1}} |
+                            seqan3::align_cfg::scoring_scheme{nt_score_scheme};
+constexpr auto edit_cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+
+template <typename base_config_t, typename ...configs_t>
+void seqan3_global_dna4(benchmark::State & state, base_config_t const & base_config, configs_t && ...configs)
+{
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::mutate_sequence(seq1, state.range(0) / 1000.0, 1);
+
+    auto align_cfg = (base_config | ... | configs) | seqan3::align_cfg::output_score{};
+
+    int32_t score = 0;
+    for (auto _ : state)
+    {
+        auto rng = seqan3::align_pairwise(std::tie(seq1, seq2), align_cfg);
+        score = (*std::ranges::begin(rng)).score();
+        benchmark::DoNotOptimize(score);
+    }
+
+    state.counters["score"] = score;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
+                                                                  base_config);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_CAPTURE(seqan3_global_dna4, affine_dynamic_programming, affine_cfg)
+    ->RangeMultiplier(divergence_multiplier)
+    ->Range(divergence_begin, divergence_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_global_dna4, affine_wavefront, affine_cfg, seqan3::align_cfg::wavefront{})
+    ->RangeMultiplier(divergence_multiplier)
+    ->Range(divergence_begin, divergence_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_global_dna4, edit_bit_parallel, edit_cfg)
+    ->RangeMultiplier(divergence_multiplier)
+    ->Range(divergence_begin, divergence_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(seqan3_global_dna4, edit_wavefront, edit_cfg, seqan3::align_cfg::wavefront{})
+    ->RangeMultiplier(divergence_multiplier)
+    ->Range(divergence_begin, divergence_end)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -18,6 +18,7 @@
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/zip.hpp>
 
+#include <seqan3/test/performance/allocation_counter.hpp>
 #include <seqan3/test/performance/units.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/seqan2.hpp>
@@ -44,6 +45,7 @@ void seqan3_affine_dna4(benchmark::State & state)
     auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(500, 0, 0);
     auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(250, 0, 1);
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         auto rng = align_pairwise(std::tie(seq1, seq2), local_affine_cfg | seqan3::align_cfg::output_score{});
@@ -53,6 +55,8 @@ void seqan3_affine_dna4(benchmark::State & state)
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
                                                                   local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan3_affine_dna4);
@@ -64,6 +68,7 @@ void seqan2_affine_dna4(benchmark::State & state)
     auto seq1 = seqan3::test::generate_sequence_seqan2<seqan::Dna>(500, 0, 0);
     auto seq2 = seqan3::test::generate_sequence_seqan2<seqan::Dna>(250, 0, 1);
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -73,6 +78,8 @@ void seqan2_affine_dna4(benchmark::State & state)
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
                                                                   local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan2_affine_dna4);
@@ -87,6 +94,7 @@ void seqan3_affine_dna4_trace(benchmark::State & state)
     auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(500, 0, 0);
     auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(250, 0, 1);
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         auto rng = align_pairwise(std::tie(seq1, seq2), local_affine_cfg | seqan3::align_cfg::output_alignment{});
@@ -96,6 +104,8 @@ void seqan3_affine_dna4_trace(benchmark::State & state)
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
                                                                   local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan3_affine_dna4_trace);
@@ -109,6 +119,7 @@ void seqan2_affine_dna4_trace(benchmark::State & state)
 
     seqan::Gaps<decltype(seq1)> gap1{seq1};
     seqan::Gaps<decltype(seq2)> gap2{seq2};
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -118,6 +129,8 @@ void seqan2_affine_dna4_trace(benchmark::State & state)
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)),
                                                                   local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before);
 }
 
 BENCHMARK(seqan2_affine_dna4_trace);
@@ -139,6 +152,7 @@ void seqan3_affine_dna4_collection(benchmark::State & state)
         vec.push_back(std::pair{seq1, seq2});
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         for (auto && rng : align_pairwise(vec, local_affine_cfg | seqan3::align_cfg::output_score{}))
@@ -147,6 +161,8 @@ void seqan3_affine_dna4_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, vec.size());
 }
 
 BENCHMARK(seqan3_affine_dna4_collection);
@@ -167,11 +183,14 @@ void seqan2_affine_dna4_collection(benchmark::State & state)
         appendValue(vec2, seq2);
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
         seqan::localAlignmentScore(vec1, vec2, seqan::Score<int>{4, -5, -1, -11});
     }
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, length(vec1));
 }
 
 BENCHMARK(seqan2_affine_dna4_collection);
@@ -193,6 +212,7 @@ void seqan3_affine_dna4_trace_collection(benchmark::State & state)
         vec.push_back(std::pair{seq1, seq2});
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         for (auto && rng : align_pairwise(vec, local_affine_cfg |
@@ -203,6 +223,8 @@ void seqan3_affine_dna4_trace_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, vec.size());
 }
 
 BENCHMARK(seqan3_affine_dna4_trace_collection);
@@ -233,6 +255,7 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
         appendValue(gap2, seqan::Gaps<sequence_t>{vec2[i]});
     }
 
+    size_t const allocations_before = seqan3::test::allocation_count;
     for (auto _ : state)
     {
         // In SeqAn2 the gap open contains already the gap extension costs, that's why we use -11 here.
@@ -241,6 +264,8 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 
     state.counters["cells"] = seqan3::test::pairwise_cell_updates(seqan3::views::zip(vec1, vec2), local_affine_cfg);
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["allocs"] = seqan3::test::allocations_per_alignment(seqan3::test::allocation_count -
+                                                                       allocations_before, length(vec1));
 }
 
 BENCHMARK(seqan2_affine_dna4_trace_collection);
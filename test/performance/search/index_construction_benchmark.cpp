@@ -7,12 +7,19 @@
 
 #include <benchmark/benchmark.h>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <limits>
+
 #include <seqan3/alphabet/aminoacid/aa27.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/persist.hpp>
 #include <seqan3/range/views/rank_to.hpp>
 #include <seqan3/search/fm_index/all.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
 #include <seqan3/test/seqan2.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
 
@@ -40,6 +47,76 @@ static void arguments(benchmark::internal::Benchmark * b)
     b->Args({500, 1'000});
 }
 
+// Arguments: text length, number of threads, whether the construction is disk-backed.
+static void construction_options_arguments(benchmark::internal::Benchmark * b)
+{
+#ifndef NDEBUG
+    for (int32_t length : {5000})
+#else
+    for (int32_t length : {50'000, 1'000'000})
+#endif  // NDEBUG
+    {
+        for (int32_t thread_count : {1, 4})
+            for (int32_t disk_backed : {0, 1})
+                b->Args({length, thread_count, disk_backed});
+    }
+}
+
+//!\brief Returns the value in bytes of the given field of /proc/self/status, e.g. "VmRSS:".
+static size_t read_status_field(std::string const & field)
+{
+    std::ifstream status{"/proc/self/status"};
+    std::string key{};
+    size_t kilobytes{};
+
+    while (status >> key)
+    {
+        if (key == field && status >> kilobytes)
+            return kilobytes * 1024;
+
+        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+
+    return 0;
+}
+
+/*!\brief Returns by how many bytes the resident set size grows at most while `construct` is invoked.
+ * \details
+ *
+ * The construction runs in a forked child process, whose peak resident set size is reset before the construction.
+ * Hence, the returned value neither contains the memory of previous benchmarks nor of the benchmark's own input.
+ */
+template <typename construct_t>
+static size_t peak_resident_set_size_of(construct_t && construct)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return 0;
+
+    pid_t const pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        std::ofstream{"/proc/self/clear_refs"} << '5'; // Resets the peak resident set size to the current one.
+        size_t const baseline = read_status_field("VmRSS:");
+        construct();
+        size_t const peak = read_status_field("VmHWM:");
+        size_t const delta = peak > baseline ? peak - baseline : 0;
+        [[maybe_unused]] auto written = write(fds[1], &delta, sizeof(delta));
+        _exit(0);
+    }
+
+    close(fds[1]);
+    size_t delta{};
+    if (pid < 0 || read(fds[0], &delta, sizeof(delta)) != sizeof(delta))
+        delta = 0;
+    close(fds[0]);
+    if (pid > 0)
+        waitpid(pid, nullptr, 0);
+
+    return delta;
+}
+
 enum class tag
 {
     fm_index,
@@ -73,6 +150,7 @@ void index_benchmark_seqan3(benchmark::State & state)
     else
         inner_sequence = store.char_rng | seqan3::views::take(state.range(0)) | seqan3::views::to<inner_rng_t>;
 
+    size_t text_size = inner_sequence.size();
     if constexpr (seqan3::range_dimension_v<rng_t> == 1)
     {
         sequence = std::move(inner_sequence);
@@ -81,6 +159,8 @@ void index_benchmark_seqan3(benchmark::State & state)
     {
         for (int32_t i = 0; i < state.range(1); ++i)
             sequence.push_back(inner_sequence);
+
+        text_size *= state.range(1);
     }
 
     for (auto _ : state)
@@ -90,6 +170,44 @@ void index_benchmark_seqan3(benchmark::State & state)
         else
             seqan3::bi_fm_index index{sequence};
     }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(text_size);
+    state.counters["peak_rss"] = peak_resident_set_size_of([&] ()
+    {
+        if constexpr (index_tag == tag::fm_index)
+            seqan3::fm_index index{sequence};
+        else
+            seqan3::bi_fm_index index{sequence};
+    });
+}
+
+template <tag index_tag>
+void index_benchmark_seqan3_construction_options(benchmark::State & state)
+{
+    // The texts are longer than max_length, hence they are not taken from the store.
+    std::vector<seqan3::dna4> sequence = seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, seed);
+
+    seqan3::fm_index_construction_options options{};
+    options.thread_count = state.range(1);
+    if (state.range(2))
+        options.disk_threshold = 0;
+
+    for (auto _ : state)
+    {
+        if constexpr (index_tag == tag::fm_index)
+            seqan3::fm_index index{sequence, options};
+        else
+            seqan3::bi_fm_index index{sequence, options};
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size());
+    state.counters["peak_rss"] = peak_resident_set_size_of([&] ()
+    {
+        if constexpr (index_tag == tag::fm_index)
+            seqan3::fm_index index{sequence, options};
+        else
+            seqan3::bi_fm_index index{sequence, options};
+    });
 }
 
 #if SEQAN3_HAS_SEQAN2
@@ -182,6 +300,10 @@ BENCHMARK_TEMPLATE(index_benchmark_seqan3, tag::bi_fm_index, two_dimensional<seq
 BENCHMARK_TEMPLATE(index_benchmark_seqan3, tag::bi_fm_index, one_dimensional<std::string> )->Apply(arguments);
 BENCHMARK_TEMPLATE(index_benchmark_seqan3, tag::bi_fm_index, two_dimensional<std::string> )->Apply(arguments);
 
+BENCHMARK_TEMPLATE(index_benchmark_seqan3_construction_options, tag::fm_index)->Apply(construction_options_arguments);
+BENCHMARK_TEMPLATE(index_benchmark_seqan3_construction_options, tag::bi_fm_index)
+    ->Apply(construction_options_arguments);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename t>
 using one_dimensional2 = seqan::String<t>;
@@ -10,6 +10,8 @@
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/join.hpp>
 #include <seqan3/range/views/to.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
@@ -287,14 +289,100 @@ void bidirectional_search_stratified(benchmark::State & state, options && o)
     benchmark::DoNotOptimize(sum);
 }
 
+//============================================================================
+//  index configurations; trivial_search, single, dna4, all-mapping
+//============================================================================
+
+// Searching reads in a repetitive text locates many occurrences, i.e. both the backward search and the sampling rate of
+// the suffix array of the index configuration are measured.
+
+template <typename index_t>
+void search_index_configuration(benchmark::State & state, options && o)
+{
+    std::vector<seqan3::dna4> ref = (o.has_repeats) ?
+                                    generate_repeating_sequence<seqan3::dna4>(2 * o.sequence_length / o.repeats,
+                                                                              o.repeats, 0.5, 0) :
+                                    seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
+
+    index_t index{ref};
+    std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref, o.number_of_reads, o.read_length,
+                                                                  o.simulated_errors, o.prob_insertion,
+                                                                  o.prob_deletion, o.stddev);
+    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}};
+
+    size_t sum{};
+    for (auto _ : state)
+    {
+        auto results = search(reads, index, cfg);
+        sum += std::ranges::distance(results);
+    }
+    benchmark::DoNotOptimize(sum);
+}
+
+//============================================================================
+//  batched search; single, dna4, all-mapping and all-best-mapping
+//============================================================================
+
+// The text must be much larger than the CPU cache, such that the rank queries of the backward search miss the cache.
+// The batch size is given by the benchmark argument, a batch size of 0 searches without seqan3::search_cfg::batch.
+
+template <typename index_t, typename hit_t>
+void search_batched(benchmark::State & state, options && o)
+{
+    std::vector<seqan3::dna4> ref = seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
+
+    index_t index{ref};
+    std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref, o.number_of_reads, o.read_length,
+                                                                  o.simulated_errors, o.prob_insertion,
+                                                                  o.prob_deletion, o.stddev);
+    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}} |
+                                hit_t{};
+
+    size_t const batch_size = state.range(0);
+    size_t sum{};
+    for (auto _ : state)
+    {
+        if (batch_size == 0)
+        {
+            auto results = search(reads, index, cfg);
+            sum += std::ranges::distance(results);
+        }
+        else
+        {
+            auto results = search(reads, index, cfg | seqan3::search_cfg::batch{batch_size});
+            sum += std::ranges::distance(results);
+        }
+    }
+
+    state.counters["reads_per_second"] = benchmark::Counter(o.number_of_reads * state.iterations(),
+                                                            benchmark::Counter::kIsRate);
+    benchmark::DoNotOptimize(sum);
+}
+
+template <typename sdsl_index_t>
+using dna4_fm_index = seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, sdsl_index_t>;
+template <typename sdsl_index_t>
+using dna4_bi_fm_index = seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, sdsl_index_t>;
+
+using fm_default = dna4_fm_index<seqan3::default_sdsl_index_type>;
+using fm_fast_locate = dna4_fm_index<seqan3::sdsl_fast_locate_index_type>;
+using fm_compact = dna4_fm_index<seqan3::sdsl_compact_index_type>;
+using fm_epr = dna4_fm_index<seqan3::sdsl_epr_index_type<seqan3::dna4>>;
+using bi_fm_default = dna4_bi_fm_index<seqan3::default_sdsl_index_type>;
+using bi_fm_fast_locate = dna4_bi_fm_index<seqan3::sdsl_fast_locate_index_type>;
+using bi_fm_compact = dna4_bi_fm_index<seqan3::sdsl_compact_index_type>;
+using bi_fm_epr = dna4_bi_fm_index<seqan3::sdsl_epr_index_type<seqan3::dna4>>;
+
 #ifndef NDEBUG
 inline constexpr size_t small_size = 1'000;
 inline constexpr size_t medium_size = 5'000;
 inline constexpr size_t big_size = 10'000;
+inline constexpr size_t huge_size = 1'000'000;
 #else
 inline constexpr size_t small_size = 10'000;
 inline constexpr size_t medium_size = 50'000;
 inline constexpr size_t big_size = 100'000;
+inline constexpr size_t huge_size = 20'000'000;
 #endif // NDEBUG
 
 BENCHMARK_CAPTURE(unidirectional_search_all_collection, highErrorReadsSearch0,
@@ -378,8 +466,58 @@ BENCHMARK_CAPTURE(bidirectional_search_stratified, highErrorReadsSearch3Strata2R
 BENCHMARK_CAPTURE(bidirectional_search_stratified, highErrorReadsSearch3Strata2RepLong,
                   options{big_size, true, 50, 50, 0.30, 0.30, 0, 3, 2, 1.75});
 
+BENCHMARK_CAPTURE(search_index_configuration<fm_default>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<fm_default>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<fm_default>, highErrorReadsSearch3,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 3, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<fm_fast_locate>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<fm_fast_locate>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<fm_compact>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<fm_compact>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<fm_epr>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<fm_epr>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<fm_epr>, highErrorReadsSearch3,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 3, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_default>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_default>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_default>, highErrorReadsSearch3,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 3, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_fast_locate>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_fast_locate>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_compact>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_compact>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_epr>, lowErrorReadsSearch0Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 0, 0, 1});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_epr>, highErrorReadsSearch2Rep,
+                  options{big_size, true, 50, 50, 0.18, 0.18, 0, 2, 0, 1.75});
+BENCHMARK_CAPTURE(search_index_configuration<bi_fm_epr>, highErrorReadsSearch3,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 3, 0, 1.75});
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
 
+BENCHMARK_CAPTURE((search_batched<fm_default, seqan3::search_cfg::hit_all>), exactReadsSearch0,
+                  options{huge_size, false, 100'000, 50, 0, 0, 0, 0, 0})->Arg(0)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_CAPTURE((search_batched<fm_default, seqan3::search_cfg::hit_all_best>), lowErrorReadsSearch1Best,
+                  options{huge_size, false, 100'000, 50, 0.18, 0.18, 1, 1, 0})->Arg(0)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_CAPTURE((search_batched<bi_fm_default, seqan3::search_cfg::hit_all>), exactReadsSearch0,
+                  options{huge_size, false, 100'000, 50, 0, 0, 0, 0, 0})->Arg(0)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_CAPTURE((search_batched<bi_fm_default, seqan3::search_cfg::hit_all_best>), lowErrorReadsSearch1Best,
+                  options{huge_size, false, 100'000, 50, 0.18, 0.18, 1, 1, 0})->Arg(0)->Arg(8)->Arg(32)->Arg(128);
+
 BENCHMARK_MAIN();
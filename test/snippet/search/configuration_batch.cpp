@@ -0,0 +1,20 @@
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/configuration/hit.hpp>
+#include <seqan3/search/configuration/parallel.hpp>
+
+int main()
+{
+    // Search the queries in batches of 64 queries and report all best hits.
+    seqan3::configuration cfg1 = seqan3::search_cfg::batch{64} | seqan3::search_cfg::hit_all_best{};
+
+    // Batches can also be distributed to several threads.
+    seqan3::configuration cfg2 = seqan3::search_cfg::batch{64} | seqan3::search_cfg::parallel{8};
+
+    // Alternative solution: assign to the member variable of the batch configuration
+    seqan3::search_cfg::batch batch_cfg{};
+    batch_cfg.size = 64;
+    seqan3::configuration cfg3 = batch_cfg | seqan3::search_cfg::hit_all_best{};
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_all_hits.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_all_hits, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::all_hits>));
+}
+
+TEST(align_config_all_hits, default_value)
+{
+    seqan3::align_cfg::all_hits elem{};
+    EXPECT_FALSE(elem.local_maxima_only);
+}
+
+TEST(align_config_all_hits, configuration)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::min_score{-3} |
+                                seqan3::align_cfg::all_hits{seqan3::align_cfg::local_maxima_only{true}};
+    auto all_hits = std::get<seqan3::align_cfg::all_hits>(cfg);
+
+    EXPECT_TRUE((std::is_same_v<decltype(all_hits.local_maxima_only), bool>));
+    EXPECT_TRUE(all_hits.local_maxima_only);
+}
+
+TEST(align_config_all_hits, combinable)
+{
+    EXPECT_TRUE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::method_global,
+                                                         seqan3::align_cfg::all_hits>));
+    EXPECT_TRUE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::output_end_position,
+                                                         seqan3::align_cfg::all_hits>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::method_local,
+                                                          seqan3::align_cfg::all_hits>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::output_alignment,
+                                                          seqan3::align_cfg::all_hits>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::output_begin_position,
+                                                          seqan3::align_cfg::all_hits>));
+}
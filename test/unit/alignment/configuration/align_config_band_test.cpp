@@ -8,6 +8,8 @@
 #include <gtest/gtest.h>
 
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
@@ -75,3 +77,38 @@ TEST(band_fixed_size, get_and_assign)
     EXPECT_EQ(get<seqan3::align_cfg::band_fixed_size>(config).lower_diagonal, -4);
     EXPECT_EQ(get<seqan3::align_cfg::band_fixed_size>(config).upper_diagonal, 8);
 }
+
+TEST(band_per_sequence_pair, config_element)
+{
+    auto band_selector = [] (size_t const) { return seqan3::align_cfg::band_fixed_size{}; };
+    using band_per_sequence_pair_t = decltype(seqan3::align_cfg::band_per_sequence_pair{band_selector});
+
+    EXPECT_TRUE((seqan3::detail::config_element<band_per_sequence_pair_t>));
+}
+
+TEST(band_per_sequence_pair, invoke)
+{
+    std::vector<std::pair<int32_t, int32_t>> diagonals{{-2, 3}, {-10, 0}, {0, 7}};
+    seqan3::align_cfg::band_per_sequence_pair band_config{[&] (size_t const index)
+    {
+        return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{diagonals[index].first},
+                                                  seqan3::align_cfg::upper_diagonal{diagonals[index].second}};
+    }};
+
+    for (size_t index = 0; index < diagonals.size(); ++index)
+    {
+        EXPECT_EQ(band_config(index).lower_diagonal, diagonals[index].first);
+        EXPECT_EQ(band_config(index).upper_diagonal, diagonals[index].second);
+    }
+}
+
+TEST(band_per_sequence_pair, exists)
+{
+    seqan3::configuration config{seqan3::align_cfg::band_per_sequence_pair{[] (size_t const)
+    {
+        return seqan3::align_cfg::band_fixed_size{};
+    }}};
+
+    EXPECT_TRUE(config.exists<seqan3::align_cfg::band_per_sequence_pair>());
+    EXPECT_FALSE(config.exists<seqan3::align_cfg::band_fixed_size>());
+}
@@ -9,16 +9,25 @@
 
 #include <type_traits>
 
+#include <seqan3/alignment/configuration/align_config_all_hits.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_packed_trace_matrix.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_saturation_check.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_unordered_results.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
 
 template <typename T>
 class alignment_configuration_test : public ::testing::Test
@@ -26,15 +35,24 @@ class alignment_configuration_test : public ::testing::Test
 
 using alignment_result_t = seqan3::alignment_result<seqan3::detail::alignment_result_value_type<int, int, int>>;
 
-using test_types = ::testing::Types<seqan3::align_cfg::band_fixed_size,
+using test_types = ::testing::Types<seqan3::align_cfg::all_hits,
+                                    seqan3::align_cfg::band_fixed_size,
                                     seqan3::align_cfg::gap_cost_affine,
+                                    seqan3::align_cfg::linear_memory_traceback,
                                     seqan3::align_cfg::min_score,
                                     seqan3::align_cfg::method_global,
                                     seqan3::align_cfg::method_local,
+                                    seqan3::align_cfg::packed_trace_matrix,
                                     seqan3::align_cfg::parallel,
+                                    seqan3::align_cfg::query_profile<seqan3::query_profile<seqan3::dna4>>,
                                     seqan3::align_cfg::scoring_scheme<seqan3::nucleotide_scoring_scheme<int8_t>>,
+                                    seqan3::align_cfg::unordered_results,
                                     seqan3::align_cfg::vectorised,
+                                    seqan3::align_cfg::vectorised_striped,
+                                    seqan3::align_cfg::wavefront,
+                                    seqan3::align_cfg::x_drop,
                                     seqan3::align_cfg::detail::result_type<alignment_result_t>,
+                                    seqan3::align_cfg::detail::saturation_check,
                                     seqan3::align_cfg::detail::debug>;
 
 TYPED_TEST_SUITE(alignment_configuration_test, test_types, );
@@ -60,7 +78,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to seqan3::align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 18);
+    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 27);
 }
 
 TYPED_TEST(alignment_configuration_test, config_element)
@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/concepts>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_gap_dual_affine, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::gap_cost_dual_affine>));
+}
+
+TEST(align_config_gap_dual_affine, configuration)
+{
+    using seqan3::get;
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::gap_cost_dual_affine{}}; // default construction
+        EXPECT_EQ((get<seqan3::align_cfg::gap_cost_dual_affine>(cfg).short_gap_cost.open_score), 0);
+        EXPECT_EQ((get<seqan3::align_cfg::gap_cost_dual_affine>(cfg).short_gap_cost.extension_score), -1);
+        EXPECT_EQ((get<seqan3::align_cfg::gap_cost_dual_affine>(cfg).long_gap_cost.open_score), 0);
+        EXPECT_EQ((get<seqan3::align_cfg::gap_cost_dual_affine>(cfg).long_gap_cost.extension_score), -1);
+    }
+
+    {
+        seqan3::align_cfg::gap_cost_dual_affine scheme{
+            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                               seqan3::align_cfg::extension_score{-2}},
+            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-24},
+                                               seqan3::align_cfg::extension_score{-1}}};
+        EXPECT_EQ((scheme.short_gap_cost.open_score), -4);
+        EXPECT_EQ((scheme.short_gap_cost.extension_score), -2);
+        EXPECT_EQ((scheme.long_gap_cost.open_score), -24);
+        EXPECT_EQ((scheme.long_gap_cost.extension_score), -1);
+    }
+}
+
+TEST(align_config_gap_dual_affine, combineable)
+{
+    EXPECT_TRUE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::gap_cost_dual_affine,
+                                                         seqan3::align_cfg::method_global>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::gap_cost_dual_affine,
+                                                          seqan3::align_cfg::gap_cost_affine>));
+}
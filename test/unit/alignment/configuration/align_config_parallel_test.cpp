@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/std/concepts>
 #include <functional>
 #include <optional>
 #include <type_traits>
@@ -19,7 +20,7 @@
 // test template : pipeable_config_element_test
 // ---------------------------------------------------------------------------------------------------------------------
 
-using test_types = ::testing::Types<seqan3::align_cfg::parallel>;
+using test_types = ::testing::Types<seqan3::align_cfg::parallel, seqan3::align_cfg::parallel_work_stealing>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(parallel_elements, pipeable_config_element_test, test_types, );
 
@@ -30,6 +31,7 @@ INSTANTIATE_TYPED_TEST_SUITE_P(parallel_elements, pipeable_config_element_test,
 TEST(align_config_parallel, config_element)
 {
     EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::parallel>));
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::parallel_work_stealing>));
 }
 
 TEST(align_config_parallel, configuration)
@@ -51,3 +53,22 @@ TEST(align_config_parallel, configuration)
         EXPECT_EQ(cfg_value, 2u);
     }
 }
+
+TEST(align_config_parallel, thread_pool)
+{
+    seqan3::thread_pool pool{3};
+    seqan3::configuration cfg{seqan3::align_cfg::parallel_work_stealing{pool}};
+
+    EXPECT_EQ(std::get<seqan3::align_cfg::parallel_work_stealing>(cfg).thread_count, 3u);
+    EXPECT_EQ(std::get<seqan3::align_cfg::parallel_work_stealing>(cfg).pool, &pool);
+    EXPECT_EQ(seqan3::align_cfg::parallel_work_stealing{2}.pool, nullptr);
+
+    // Only the work stealing mode can share a thread pool.
+    EXPECT_FALSE((std::constructible_from<seqan3::align_cfg::parallel, seqan3::thread_pool &>));
+}
+
+TEST(align_config_parallel, exclusive)
+{
+    EXPECT_FALSE((seqan3::detail::is_configuration_valid_v<seqan3::align_cfg::parallel,
+                                                           seqan3::align_cfg::parallel_work_stealing>));
+}
@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/expect_same_type.hpp>
+
+#include "../../core/algorithm/pipeable_config_element_test_template.hpp"
+
+using seqan3::operator""_dna4;
+
+using query_profile_t = seqan3::query_profile<seqan3::dna4>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// test template : pipeable_config_element_test
+// ---------------------------------------------------------------------------------------------------------------------
+
+using test_types = ::testing::Types<seqan3::align_cfg::query_profile<query_profile_t>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(query_profile_elements, pipeable_config_element_test, test_types, );
+
+// ---------------------------------------------------------------------------------------------------------------------
+// individual tests
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(align_config_query_profile, type_deduction)
+{
+    query_profile_t profile{"ACGT"_dna4, seqan3::nucleotide_scoring_scheme{}};
+    seqan3::align_cfg::query_profile elem{profile};
+
+    EXPECT_SAME_TYPE(decltype(elem), seqan3::align_cfg::query_profile<query_profile_t>);
+}
+
+TEST(align_config_query_profile, configuration)
+{
+    query_profile_t profile{"ACGT"_dna4, seqan3::nucleotide_scoring_scheme{}};
+
+    { // from lvalue.
+        seqan3::align_cfg::query_profile elem{profile};
+        seqan3::configuration cfg{elem};
+
+        EXPECT_EQ(seqan3::get<seqan3::align_cfg::query_profile>(cfg).profile, &profile);
+    }
+
+    { // from rvalue.
+        seqan3::configuration cfg{seqan3::align_cfg::query_profile{profile}};
+
+        EXPECT_EQ(seqan3::get<seqan3::align_cfg::query_profile>(cfg).profile, &profile);
+    }
+}
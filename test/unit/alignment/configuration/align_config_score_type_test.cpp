@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
@@ -20,7 +21,7 @@ template <typename test_t>
 struct align_cfg_output_test : public ::testing::Test
 {};
 
-using test_types = ::testing::Types<seqan3::align_cfg::score_type<int32_t>>;
+using test_types = ::testing::Types<seqan3::align_cfg::score_type<int32_t>, seqan3::align_cfg::score_type_adaptive>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(score_type, pipeable_config_element_test, test_types, );
 
@@ -41,3 +42,17 @@ TEST(align_config_score_type, score_type_exists)
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::score_type<double>>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::score_type>());
 }
+
+TEST(align_config_score_type, score_type_adaptive_exists)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::score_type_adaptive{};
+    EXPECT_TRUE(cfg.exists<seqan3::align_cfg::score_type_adaptive>());
+    EXPECT_FALSE(cfg.exists<seqan3::align_cfg::score_type>());
+}
+
+TEST(align_config_score_type, score_type_adaptive_incompatible_with_score_type)
+{
+    EXPECT_FALSE((std::is_invocable_v<std::bit_or<>,
+                                      seqan3::align_cfg::score_type_adaptive,
+                                      seqan3::align_cfg::score_type<int16_t>>));
+}
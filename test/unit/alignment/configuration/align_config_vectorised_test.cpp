@@ -18,3 +18,16 @@ TEST(align_config_vectorised, config_element)
     seqan3::configuration cfg{seqan3::align_cfg::vectorised{}};
     EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised>());
 }
+
+TEST(align_config_vectorised_striped, config_element)
+{
+    seqan3::configuration cfg{seqan3::align_cfg::vectorised_striped{}};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised_striped>());
+}
+
+TEST(align_config_vectorised_striped, incompatible_with_vectorised)
+{
+    EXPECT_FALSE((std::is_invocable_v<std::bit_or<>,
+                                      seqan3::align_cfg::vectorised,
+                                      seqan3::align_cfg::vectorised_striped>));
+}
@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_x_drop, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::x_drop>));
+}
+
+TEST(align_config_x_drop, default_value)
+{
+    seqan3::align_cfg::x_drop elem{};
+    EXPECT_EQ(elem.value, std::numeric_limits<int32_t>::max());
+}
+
+TEST(align_config_x_drop, configuration)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::x_drop{20};
+    auto x_drop = std::get<seqan3::align_cfg::x_drop>(cfg);
+
+    EXPECT_TRUE((std::is_same_v<decltype(x_drop.value), int32_t>));
+    EXPECT_EQ(x_drop.value, 20);
+}
+
+TEST(align_config_x_drop, incompatible_with_local)
+{
+    EXPECT_TRUE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::method_global,
+                                                         seqan3::align_cfg::x_drop>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::method_local,
+                                                          seqan3::align_cfg::x_drop>));
+}
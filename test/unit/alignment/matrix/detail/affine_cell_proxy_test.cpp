@@ -111,6 +111,60 @@ TEST_F(affine_cell_proxy_test, tuple_like_concept)
     EXPECT_TRUE(seqan3::detail::affine_score_cell<cell_type>);
 }
 
+//------------------------------------------------------------------------------
+// dual affine score cell proxy
+//------------------------------------------------------------------------------
+
+struct dual_affine_cell_proxy_test : public affine_cell_proxy_test
+{
+    using dual_score_cell_type = std::tuple<int, int const &, int &, int &, int const &>;
+    using cell_type = seqan3::detail::affine_cell_proxy<dual_score_cell_type>;
+
+    int long_horizontal_score{-3};
+    int long_vertical_score{7};
+
+    cell_type dual_cell{best_score, horizontal_score, vertical_score, long_horizontal_score, long_vertical_score};
+};
+
+TEST_F(dual_affine_cell_proxy_test, score_accessors)
+{
+    EXPECT_EQ(dual_cell.best_score(), best_score);
+    EXPECT_EQ(dual_cell.horizontal_score(), horizontal_score);
+    EXPECT_EQ(dual_cell.vertical_score(), vertical_score);
+    EXPECT_EQ(dual_cell.long_horizontal_score(), long_horizontal_score);
+    EXPECT_EQ(dual_cell.long_vertical_score(), long_vertical_score);
+}
+
+TEST_F(dual_affine_cell_proxy_test, long_horizontal_score)
+{
+    EXPECT_EQ(std::as_const(dual_cell).long_horizontal_score(), long_horizontal_score);
+    EXPECT_EQ(std::move(dual_cell).long_horizontal_score(), long_horizontal_score);
+    EXPECT_EQ(std::move(std::as_const(dual_cell)).long_horizontal_score(), long_horizontal_score);
+    EXPECT_SAME_TYPE(decltype(dual_cell.long_horizontal_score()), int &);
+    EXPECT_SAME_TYPE(decltype(std::as_const(dual_cell).long_horizontal_score()), int &);
+    EXPECT_SAME_TYPE(decltype(std::move(dual_cell).long_horizontal_score()), int &);
+    EXPECT_SAME_TYPE(decltype(std::move(std::as_const(dual_cell)).long_horizontal_score()), int &);
+}
+
+TEST_F(dual_affine_cell_proxy_test, long_vertical_score)
+{
+    EXPECT_EQ(std::as_const(dual_cell).long_vertical_score(), long_vertical_score);
+    EXPECT_EQ(std::move(dual_cell).long_vertical_score(), long_vertical_score);
+    EXPECT_EQ(std::move(std::as_const(dual_cell)).long_vertical_score(), long_vertical_score);
+    EXPECT_SAME_TYPE(decltype(dual_cell.long_vertical_score()), int const &);
+    EXPECT_SAME_TYPE(decltype(std::as_const(dual_cell).long_vertical_score()), int const &);
+    EXPECT_SAME_TYPE(decltype(std::move(dual_cell).long_vertical_score()), int const &);
+    EXPECT_SAME_TYPE(decltype(std::move(std::as_const(dual_cell)).long_vertical_score()), int const &);
+}
+
+TEST_F(dual_affine_cell_proxy_test, tuple_like_concept)
+{
+    EXPECT_EQ(std::tuple_size_v<cell_type>, 5u);
+    EXPECT_TRUE(seqan3::tuple_like<cell_type>);
+    EXPECT_TRUE(seqan3::detail::dual_affine_score_cell<cell_type>);
+    EXPECT_FALSE(seqan3::detail::affine_score_cell<cell_type>);
+}
+
 //------------------------------------------------------------------------------
 // combined score and trace cell proxy
 //------------------------------------------------------------------------------
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+
+using trace_t = seqan3::detail::trace_directions;
+using simd_trace_t = seqan3::simd::simd_type_t<int8_t>;
+using matrix_t = seqan3::detail::trace_matrix_full<simd_trace_t>;
+
+// Stores the given trace direction in the first lane and the other trace direction in all remaining lanes.
+simd_trace_t make_trace(trace_t const first_lane, trace_t const other_lanes)
+{
+    simd_trace_t trace = seqan3::simd::fill<simd_trace_t>(static_cast<int8_t>(other_lanes));
+    trace[0] = static_cast<int8_t>(first_lane);
+    return trace;
+}
+
+TEST(trace_matrix_full_simd_test, lane_iterator_concept)
+{
+    using simd_matrix_t = seqan3::detail::two_dimensional_matrix<simd_trace_t,
+                                                                 seqan3::aligned_allocator<simd_trace_t,
+                                                                                           sizeof(simd_trace_t)>,
+                                                                 seqan3::detail::matrix_major_order::column>;
+    using matrix_iter_t = std::ranges::iterator_t<simd_matrix_t const>;
+    using lane_iter_t = seqan3::detail::simd_trace_lane_iterator<matrix_iter_t>;
+
+    EXPECT_TRUE(seqan3::detail::two_dimensional_matrix_iterator<lane_iter_t>);
+    EXPECT_TRUE((std::same_as<std::iter_value_t<lane_iter_t>, trace_t>));
+}
+
+TEST(trace_matrix_full_simd_test, trace_path)
+{
+    // The first lane stores the same trace as in the scalar trace_matrix_full_test and all other lanes store a
+    // trace that goes along the main diagonal.
+    matrix_t matrix{};
+    matrix.resize(seqan3::detail::column_index_type<size_t>{4}, seqan3::detail::row_index_type<size_t>{3});
+    auto trace_column_it = matrix.begin();
+    auto trace_column = *trace_column_it;
+    simd_trace_t none = seqan3::simd::fill<simd_trace_t>(0);
+
+    // Initialise column 0
+    auto trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{make_trace(trace_t::none, trace_t::none), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::up_open, trace_t::none), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::up, trace_t::none), none, none};
+
+    // Initialise column 1
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{make_trace(trace_t::left_open, trace_t::none), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::diagonal, trace_t::diagonal), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::up_open, trace_t::diagonal), none, none};
+
+    // Initialise column 2
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{make_trace(trace_t::left, trace_t::none), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::diagonal, trace_t::diagonal), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::left_open, trace_t::diagonal), none, none};
+
+    // Initialise column 3
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{make_trace(trace_t::left, trace_t::none), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::up_open, trace_t::diagonal), none, none};
+    *++trace_cell_it = std::tuple{make_trace(trace_t::left, trace_t::diagonal), none, none};
+
+    seqan3::detail::matrix_coordinate trace_begin{seqan3::detail::row_index_type{2u},
+                                                  seqan3::detail::column_index_type{3u}};
+
+    auto trace_path_first_lane = matrix.trace_path(trace_begin, 0u);
+    auto trace_path_it = trace_path_first_lane.begin();
+    EXPECT_EQ(*trace_path_it, trace_t::left);
+    EXPECT_EQ(*++trace_path_it, trace_t::left);
+    EXPECT_EQ(*++trace_path_it, trace_t::up);
+    EXPECT_EQ(*++trace_path_it, trace_t::diagonal);
+    EXPECT_EQ(*++trace_path_it, trace_t::none);
+    EXPECT_TRUE(trace_path_it == trace_path_first_lane.end());
+
+    auto trace_path_last_lane = matrix.trace_path(trace_begin, seqan3::simd_traits<simd_trace_t>::length - 1);
+    trace_path_it = trace_path_last_lane.begin();
+    EXPECT_EQ(*trace_path_it, trace_t::diagonal);
+    EXPECT_EQ(trace_path_it.coordinate().row, 2u);
+    EXPECT_EQ(trace_path_it.coordinate().col, 3u);
+    EXPECT_EQ(*++trace_path_it, trace_t::diagonal);
+    EXPECT_EQ(*++trace_path_it, trace_t::none);
+    EXPECT_EQ(trace_path_it.coordinate().row, 0u);
+    EXPECT_EQ(trace_path_it.coordinate().col, 1u);
+    EXPECT_TRUE(trace_path_it == trace_path_last_lane.end());
+}
+
+TEST(trace_matrix_full_simd_test, invalid_trace_path_coordinate)
+{
+    matrix_t matrix{};
+    matrix.resize(seqan3::detail::column_index_type<size_t>{4}, seqan3::detail::row_index_type<size_t>{3});
+
+    EXPECT_THROW((matrix.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{3u},
+                                                                     seqan3::detail::column_index_type{3u}}, 0u)),
+                 std::invalid_argument);
+    EXPECT_THROW((matrix.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{2u},
+                                                                     seqan3::detail::column_index_type{4u}}, 0u)),
+                 std::invalid_argument);
+}
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_packed_trace_matrix.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct affine_packed_trace_matrix : public ::testing::Test
+{
+    affine_packed_trace_matrix()
+    {
+        sequence_pairs.emplace_back(sequence_t{}, sequence_t{});
+        sequence_pairs.emplace_back(sequence_t{}, seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 1));
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 2), sequence_t{});
+
+        // Odd and even column heights, such that columns start in the middle of a packed byte.
+        for (size_t i = 0; i < 50; ++i)
+        {
+            sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 7) % 80, 0, i),
+                                        seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 13) % 80, 0, i + 50));
+        }
+    }
+
+    // The packed trace matrix must yield exactly the same results as the default one.
+    template <typename config_t>
+    void check_against_trace_matrix(config_t const & cfg)
+    {
+        auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+        auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::packed_trace_matrix{})
+                     | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), expected.size());
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence1_begin_position(), expected[index].sequence1_begin_position())
+                << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence2_begin_position(), expected[index].sequence2_begin_position())
+                << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence1_end_position(), expected[index].sequence1_end_position());
+            EXPECT_EQ(results[index].sequence2_end_position(), expected[index].sequence2_end_position());
+        }
+    }
+
+    static constexpr auto gap_cost(int32_t const open, int32_t const extension)
+    {
+        return seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{open},
+                                                  seqan3::align_cfg::extension_score{extension}};
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+
+    static constexpr auto base_config = seqan3::align_cfg::scoring_scheme{
+                                            seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                              seqan3::mismatch_score{-5}}} |
+                                        seqan3::align_cfg::output_score{} |
+                                        seqan3::align_cfg::output_begin_position{} |
+                                        seqan3::align_cfg::output_end_position{};
+};
+
+TEST_F(affine_packed_trace_matrix, global)
+{
+    check_against_trace_matrix(base_config | seqan3::align_cfg::method_global{} | gap_cost(-10, -1));
+}
+
+TEST_F(affine_packed_trace_matrix, linear_gaps)
+{
+    check_against_trace_matrix(base_config | seqan3::align_cfg::method_global{} | gap_cost(0, -2));
+}
+
+TEST_F(affine_packed_trace_matrix, semi_global)
+{
+    check_against_trace_matrix(base_config |
+                               gap_cost(-10, -1) |
+                               seqan3::align_cfg::method_global{
+                                   seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}});
+}
+
+TEST_F(affine_packed_trace_matrix, unsupported_configuration)
+{
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::packed_trace_matrix,
+                                                          seqan3::align_cfg::vectorised>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::packed_trace_matrix,
+                                                          seqan3::align_cfg::linear_memory_traceback>));
+}
+
+TEST_F(affine_packed_trace_matrix, configuration_without_effect)
+{
+    auto global_cfg = seqan3::align_cfg::method_global{} | gap_cost(-10, -1) | seqan3::align_cfg::packed_trace_matrix{};
+    auto align = [&] (auto const & cfg)
+    {
+        return seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+    };
+
+    // No trace matrix is needed.
+    EXPECT_THROW(align(global_cfg |
+                       seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+                       seqan3::align_cfg::output_score{} |
+                       seqan3::align_cfg::output_end_position{}),
+                 seqan3::invalid_alignment_configuration);
+    // The alignment, the local and the banded alignment are computed with the unpacked trace matrix.
+    EXPECT_THROW(align(global_cfg | base_config | seqan3::align_cfg::output_alignment{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(align(base_config |
+                       gap_cost(-10, -1) |
+                       seqan3::align_cfg::method_local{} |
+                       seqan3::align_cfg::packed_trace_matrix{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(align(global_cfg |
+                       base_config |
+                       seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-100},
+                                                          seqan3::align_cfg::upper_diagonal{100}}),
+                 seqan3::invalid_alignment_configuration);
+    // The edit distance does not use a trace matrix.
+    EXPECT_THROW(align(seqan3::align_cfg::method_global{} |
+                       seqan3::align_cfg::edit_scheme |
+                       seqan3::align_cfg::output_score{} |
+                       seqan3::align_cfg::packed_trace_matrix{}),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,154 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Generates sequence pairs whose lengths cover the value ranges of all score types.
+template <typename alphabet_t>
+auto generate_sequence_pairs()
+{
+    using sequence_t = std::vector<alphabet_t>;
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+    std::vector<size_t> const lengths{5, 20, 300, 10, 1000, 40, 2, 150, 0, 70};
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        size_t const length = lengths[i % lengths.size()];
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<alphabet_t>(length, length / 10, i),
+                                    seqan3::test::generate_sequence<alphabet_t>(length, length / 10, i + 100));
+    }
+
+    return sequence_pairs;
+}
+
+// Generates pairs of identical sequences, whose scores exceed the narrow score types far below the length bound.
+template <typename alphabet_t>
+auto generate_identical_sequence_pairs()
+{
+    using sequence_t = std::vector<alphabet_t>;
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+    std::vector<size_t> const lengths{40, 10, 100, 31, 33, 120, 250, 60, 1};
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        sequence_t sequence = seqan3::test::generate_sequence<alphabet_t>(lengths[i % lengths.size()], 0, i);
+        sequence_pairs.emplace_back(sequence, sequence);
+    }
+
+    return sequence_pairs;
+}
+
+// Compares the adaptive score type against the vectorised alignment with 32 bit scores.
+template <typename sequence_pairs_t, typename config_t>
+void compare_with_fixed_score_type(sequence_pairs_t sequence_pairs, config_t const & base_cfg)
+{
+    auto cfg = base_cfg | seqan3::align_cfg::output_score{} |
+                          seqan3::align_cfg::output_end_position{} |
+                          seqan3::align_cfg::output_sequence1_id{} |
+                          seqan3::align_cfg::vectorised{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::score_type<int32_t>{})
+                  | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::score_type_adaptive{})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].sequence1_id(), expected[i].sequence1_id());
+        EXPECT_EQ(actual[i].score(), expected[i].score()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence1_end_position(), expected[i].sequence1_end_position()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence2_end_position(), expected[i].sequence2_end_position()) << "sequence pair " << i;
+    }
+}
+
+inline constexpr auto gap_cost = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                   seqan3::align_cfg::extension_score{-1}};
+inline constexpr auto dna_scheme = seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}};
+
+TEST(affine_unbanded_collection_simd_adaptive, global_dna4)
+{
+    compare_with_fixed_score_type(generate_sequence_pairs<seqan3::dna4>(),
+                                  seqan3::align_cfg::method_global{} | gap_cost | dna_scheme);
+}
+
+TEST(affine_unbanded_collection_simd_adaptive, local_dna4)
+{
+    compare_with_fixed_score_type(generate_sequence_pairs<seqan3::dna4>(),
+                                  seqan3::align_cfg::method_local{} | gap_cost | dna_scheme);
+}
+
+TEST(affine_unbanded_collection_simd_adaptive, global_aa27)
+{
+    auto aa_scheme = seqan3::align_cfg::scoring_scheme{
+                        seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62}};
+
+    compare_with_fixed_score_type(generate_sequence_pairs<seqan3::aa27>(),
+                                  seqan3::align_cfg::method_global{} | gap_cost | aa_scheme);
+}
+
+TEST(affine_unbanded_collection_simd_adaptive, local_aa27)
+{
+    auto aa_scheme = seqan3::align_cfg::scoring_scheme{
+                        seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62}};
+
+    compare_with_fixed_score_type(generate_sequence_pairs<seqan3::aa27>(),
+                                  seqan3::align_cfg::method_local{} | gap_cost | aa_scheme);
+}
+
+TEST(affine_unbanded_collection_simd_adaptive, saturated_global_dna4)
+{
+    compare_with_fixed_score_type(generate_identical_sequence_pairs<seqan3::dna4>(),
+                                  seqan3::align_cfg::method_global{} | gap_cost | dna_scheme);
+}
+
+TEST(affine_unbanded_collection_simd_adaptive, saturated_local_dna4)
+{
+    compare_with_fixed_score_type(generate_identical_sequence_pairs<seqan3::dna4>(),
+                                  seqan3::align_cfg::method_local{} | gap_cost | dna_scheme);
+}
+
+TEST(affine_unbanded_collection_simd_adaptive, begin_positions)
+{
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>();
+
+    auto cfg = seqan3::align_cfg::method_local{} | gap_cost | dna_scheme |
+               seqan3::align_cfg::output_score{} |
+               seqan3::align_cfg::output_begin_position{} |
+               seqan3::align_cfg::vectorised{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::score_type_adaptive{})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].score(), expected[i].score()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence1_begin_position(), expected[i].sequence1_begin_position()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence2_begin_position(), expected[i].sequence2_begin_position()) << "sequence pair " << i;
+    }
+}
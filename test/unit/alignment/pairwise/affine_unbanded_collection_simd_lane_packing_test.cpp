@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_on_result.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+// Generates sequence pairs of very different lengths, such that the sorted chunks differ from the original order.
+std::vector<std::pair<sequence_t, sequence_t>> generate_sequence_pairs()
+{
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+    std::vector<size_t> const lengths{150, 3, 40, 0, 90, 7, 250, 12, 60, 1};
+
+    for (size_t i = 0; i < 500; ++i)
+    {
+        size_t const length = lengths[(i * 7) % lengths.size()];
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(length, length / 5, i),
+                                    seqan3::test::generate_sequence<seqan3::dna4>(length, length / 5, i + 1000));
+    }
+
+    return sequence_pairs;
+}
+
+inline constexpr auto base_config = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                      seqan3::align_cfg::extension_score{-1}} |
+                                    seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}} |
+                                    seqan3::align_cfg::output_score{} |
+                                    seqan3::align_cfg::output_end_position{} |
+                                    seqan3::align_cfg::output_sequence1_id{} |
+                                    seqan3::align_cfg::output_sequence2_id{};
+
+// Compares the vectorised alignment against the scalar alignment, including the order of the results.
+template <typename config_t>
+void compare_with_scalar(config_t const & cfg)
+{
+    auto sequence_pairs = generate_sequence_pairs();
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::vectorised{})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].sequence1_id(), i);
+        EXPECT_EQ(actual[i].sequence2_id(), i);
+        EXPECT_EQ(actual[i].score(), expected[i].score()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence1_end_position(), expected[i].sequence1_end_position()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence2_end_position(), expected[i].sequence2_end_position()) << "sequence pair " << i;
+    }
+}
+
+TEST(affine_unbanded_collection_simd_lane_packing, global)
+{
+    compare_with_scalar(seqan3::align_cfg::method_global{} | base_config);
+}
+
+TEST(affine_unbanded_collection_simd_lane_packing, local)
+{
+    compare_with_scalar(seqan3::align_cfg::method_local{} | base_config);
+}
+
+TEST(affine_unbanded_collection_simd_lane_packing, parallel)
+{
+    compare_with_scalar(seqan3::align_cfg::method_global{} | base_config | seqan3::align_cfg::parallel{4});
+}
+
+TEST(affine_unbanded_collection_simd_lane_packing, score_type_adaptive)
+{
+    auto sequence_pairs = generate_sequence_pairs();
+    auto cfg = seqan3::align_cfg::method_global{} | base_config | seqan3::align_cfg::vectorised{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::score_type<int32_t>{})
+                  | seqan3::views::to<std::vector>;
+    auto actual = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::score_type_adaptive{})
+                | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(actual.size(), expected.size());
+
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].sequence1_id(), i);
+        EXPECT_EQ(actual[i].score(), expected[i].score()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence1_end_position(), expected[i].sequence1_end_position()) << "sequence pair " << i;
+        EXPECT_EQ(actual[i].sequence2_end_position(), expected[i].sequence2_end_position()) << "sequence pair " << i;
+    }
+}
+
+TEST(affine_unbanded_collection_simd_lane_packing, on_result_order)
+{
+    auto sequence_pairs = generate_sequence_pairs();
+    std::vector<size_t> ids{};
+
+    seqan3::align_pairwise(sequence_pairs, seqan3::align_cfg::method_global{} |
+                                           base_config |
+                                           seqan3::align_cfg::vectorised{} |
+                                           seqan3::align_cfg::on_result{[&] (auto && result)
+                                           {
+                                               ids.push_back(result.sequence1_id());
+                                           }});
+
+    ASSERT_EQ(ids.size(), sequence_pairs.size());
+    for (size_t i = 0; i < ids.size(); ++i)
+        EXPECT_EQ(ids[i], i);
+}
@@ -0,0 +1,268 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/query_profile.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/local_affine_unbanded.hpp"
+
+template <auto _fixture>
+struct pairwise_alignment_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(seqan3::test::alignment::fixture::alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename fixture_t>
+class pairwise_alignment_striped_test : public fixture_t
+{};
+
+TYPED_TEST_SUITE_P(pairwise_alignment_striped_test);
+
+TYPED_TEST_P(pairwise_alignment_striped_test, score)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::vectorised_striped{} |
+                                                       seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+}
+
+TYPED_TEST_P(pairwise_alignment_striped_test, end_positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::vectorised_striped{} |
+                                                       seqan3::align_cfg::output_end_position{} |
+                                                       seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_end_position(), fixture.end_positions.first);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.end_positions.second);
+}
+
+TYPED_TEST_P(pairwise_alignment_striped_test, query_profile)
+{
+    auto const & fixture = this->fixture();
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    using query_profile_t = seqan3::query_profile<std::ranges::range_value_t<decltype(query)>,
+                                                  std::ranges::range_value_t<decltype(database)>>;
+    auto const & scheme = seqan3::get<seqan3::align_cfg::scoring_scheme>(fixture.config).scheme;
+    query_profile_t profile{query, scheme};
+
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::vectorised_striped{} |
+                                                       seqan3::align_cfg::query_profile{profile} |
+                                                       seqan3::align_cfg::output_end_position{} |
+                                                       seqan3::align_cfg::output_score{};
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_end_position(), fixture.end_positions.first);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.end_positions.second);
+}
+
+TYPED_TEST_P(pairwise_alignment_striped_test, begin_positions_not_supported)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::vectorised_striped{} |
+                                                       seqan3::align_cfg::output_begin_position{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(database, query), align_cfg),
+                 seqan3::invalid_alignment_configuration);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(pairwise_alignment_striped_test,
+                            score,
+                            end_positions,
+                            query_profile,
+                            begin_positions_not_supported);
+
+namespace global_fixture = seqan3::test::alignment::fixture::global::affine::unbanded;
+namespace local_fixture = seqan3::test::alignment::fixture::local::affine::unbanded;
+
+using pairwise_global_affine_unbanded_striped_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_part_01>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_part_02>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_part_03>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_part_04>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_part_05>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty>,
+        pairwise_alignment_fixture<&global_fixture::dna4_match_4_mismatch_5_gap_1_open_10_both_empty>,
+        pairwise_alignment_fixture<&global_fixture::aa27_blosum62_gap_1_open_10>,
+        pairwise_alignment_fixture<&global_fixture::aa27_blosum62_gap_1_open_10_small>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_global_affine_unbanded_striped,
+                               pairwise_alignment_striped_test,
+                               pairwise_global_affine_unbanded_striped_testing_types, );
+
+using pairwise_local_affine_unbanded_striped_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&local_fixture::dna4_01>,
+        pairwise_alignment_fixture<&local_fixture::dna4_02>,
+        pairwise_alignment_fixture<&local_fixture::dna4_03>,
+        pairwise_alignment_fixture<&local_fixture::dna4_04>,
+        pairwise_alignment_fixture<&local_fixture::dna4_05>,
+        pairwise_alignment_fixture<&local_fixture::rna5_01>,
+        pairwise_alignment_fixture<&local_fixture::aa27_01>,
+        pairwise_alignment_fixture<&local_fixture::aa27_02>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_local_affine_unbanded_striped,
+                               pairwise_alignment_striped_test,
+                               pairwise_local_affine_unbanded_striped_testing_types, );
+
+// ----------------------------------------------------------------------------
+// Compare against the scalar alignment for sequences spanning many segments.
+// ----------------------------------------------------------------------------
+
+template <typename method_t, typename score_t>
+void compare_with_scalar_alignment()
+{
+    auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(1000, 0, 0);
+    auto sequence2 = seqan3::test::generate_sequence<seqan3::dna4>(1100, 0, 1);
+
+    auto base_cfg = method_t{} |
+                    seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                       seqan3::align_cfg::extension_score{-1}} |
+                    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                        seqan3::mismatch_score{-5}}} |
+                    seqan3::align_cfg::score_type<score_t>{} |
+                    seqan3::align_cfg::output_score{} |
+                    seqan3::align_cfg::output_end_position{};
+
+    auto scalar_rng = seqan3::align_pairwise(std::tie(sequence1, sequence2), base_cfg);
+    auto striped_rng = seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                              base_cfg | seqan3::align_cfg::vectorised_striped{});
+
+    auto scalar_res = *scalar_rng.begin();
+    auto striped_res = *striped_rng.begin();
+
+    EXPECT_EQ(striped_res.score(), scalar_res.score());
+    EXPECT_EQ(striped_res.sequence1_end_position(), scalar_res.sequence1_end_position());
+    EXPECT_EQ(striped_res.sequence2_end_position(), scalar_res.sequence2_end_position());
+}
+
+TEST(pairwise_alignment_striped, global_long_sequences)
+{
+    compare_with_scalar_alignment<seqan3::align_cfg::method_global, int32_t>();
+    compare_with_scalar_alignment<seqan3::align_cfg::method_global, int16_t>();
+}
+
+TEST(pairwise_alignment_striped, local_long_sequences)
+{
+    compare_with_scalar_alignment<seqan3::align_cfg::method_local, int32_t>();
+    compare_with_scalar_alignment<seqan3::align_cfg::method_local, int16_t>();
+}
+
+TEST(pairwise_alignment_striped, free_end_gaps_not_supported)
+{
+    auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(100, 0, 0);
+    auto sequence2 = seqan3::test::generate_sequence<seqan3::dna4>(100, 0, 1);
+
+    auto cfg = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+               seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}} |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+               seqan3::align_cfg::output_score{} |
+               seqan3::align_cfg::vectorised_striped{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg), seqan3::invalid_alignment_configuration);
+}
+
+// ----------------------------------------------------------------------------
+// One query against many targets with a precomputed query profile.
+// ----------------------------------------------------------------------------
+
+TEST(pairwise_alignment_striped, query_profile_one_vs_many)
+{
+    auto scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    auto query = seqan3::test::generate_sequence<seqan3::dna4>(150, 0, 0);
+    auto other_query = seqan3::test::generate_sequence<seqan3::dna4>(150, 0, 1);
+
+    // Every third pair has a different query, for which the profile must be computed as usual.
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+    for (size_t i = 0; i < 30; ++i)
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(100, 50, i + 2),
+                                    (i % 3 == 2) ? other_query : query);
+
+    seqan3::query_profile profile{query, scheme};
+
+    auto base_cfg = seqan3::align_cfg::method_local{} |
+                    seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                       seqan3::align_cfg::extension_score{-1}} |
+                    seqan3::align_cfg::scoring_scheme{scheme} |
+                    seqan3::align_cfg::vectorised_striped{} |
+                    seqan3::align_cfg::output_score{} |
+                    seqan3::align_cfg::output_end_position{};
+
+    auto expected_rng = seqan3::align_pairwise(sequence_pairs, base_cfg);
+    auto profile_rng = seqan3::align_pairwise(sequence_pairs, base_cfg | seqan3::align_cfg::query_profile{profile});
+
+    auto expected_it = expected_rng.begin();
+    for (auto && res : profile_rng)
+    {
+        ASSERT_NE(expected_it, expected_rng.end());
+        EXPECT_EQ(res.score(), (*expected_it).score());
+        EXPECT_EQ(res.sequence1_end_position(), (*expected_it).sequence1_end_position());
+        EXPECT_EQ(res.sequence2_end_position(), (*expected_it).sequence2_end_position());
+        ++expected_it;
+    }
+    EXPECT_EQ(expected_it, expected_rng.end());
+}
+
+TEST(pairwise_alignment_striped, query_profile_requires_striped)
+{
+    auto scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(100, 0, 0);
+    auto sequence2 = seqan3::test::generate_sequence<seqan3::dna4>(100, 0, 1);
+
+    seqan3::query_profile profile{sequence2, scheme};
+
+    auto cfg = seqan3::align_cfg::method_local{} |
+               seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}} |
+               seqan3::align_cfg::scoring_scheme{scheme} |
+               seqan3::align_cfg::query_profile{profile} |
+               seqan3::align_cfg::output_score{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg), seqan3::invalid_alignment_configuration);
+}
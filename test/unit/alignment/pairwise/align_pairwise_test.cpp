@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/std/algorithm>
+#include <cmath>
 #include <seqan3/std/ranges>
 #include <stdexcept>
 #include <type_traits>
@@ -14,9 +16,11 @@
 
 #include <meta/meta.hpp>
 
+#include <seqan3/alignment/configuration/align_config_unordered_results.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/algorithm/thread_pool.hpp>
 #include <seqan3/range/views/to_char.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/test/expect_same_type.hpp>
@@ -37,7 +41,8 @@ struct align_pairwise_test : ::testing::Test
 };
 
 using testing_types = ::testing::Types<void,
-                                       seqan3::align_cfg::parallel>;
+                                       seqan3::align_cfg::parallel,
+                                       seqan3::align_cfg::parallel_work_stealing>;
 
 TYPED_TEST_SUITE(align_pairwise_test, testing_types, );
 
@@ -53,6 +58,11 @@ auto call_alignment(seq_t && seq, cfg_t && cfg)
         auto && config = cfg | seqan3::align_cfg::parallel{4};
         return seqan3::align_pairwise(std::forward<seq_t>(seq), std::forward<decltype(config)>(config));
     }
+    else if constexpr (std::same_as<type_param_t, seqan3::align_cfg::parallel_work_stealing>)
+    {
+        auto && config = cfg | seqan3::align_cfg::parallel_work_stealing{4};
+        return seqan3::align_pairwise(std::forward<seq_t>(seq), std::forward<decltype(config)>(config));
+    }
 }
 
 TYPED_TEST(align_pairwise_test, single_pair)
@@ -305,3 +315,89 @@ TEST(align_pairwise_test, parallel_without_parameter)
 
     EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), cfg), std::runtime_error);
 }
+
+TEST(align_pairwise_test, parallel_unordered_results)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{};
+    for (size_t i = 0; i < 200; ++i)
+        sequences.emplace_back(seqan3::dna4_vector(i % 50, 'A'_dna4), "AAAAAAAAAA"_dna4);
+
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} |
+                                seqan3::align_cfg::edit_scheme |
+                                seqan3::align_cfg::output_score{} |
+                                seqan3::align_cfg::parallel{4} |
+                                seqan3::align_cfg::unordered_results{8};
+
+    std::vector<bool> seen(sequences.size(), false);
+    for (auto && res : seqan3::align_pairwise(sequences, cfg))
+    {
+        // The sequence ids are added automatically to identify the results.
+        EXPECT_EQ(res.sequence1_id(), res.sequence2_id());
+        EXPECT_FALSE(seen[res.sequence1_id()]);
+        seen[res.sequence1_id()] = true;
+
+        int32_t const length = res.sequence1_id() % 50;
+        EXPECT_EQ(res.score(), -std::abs(length - 10));
+    }
+
+    EXPECT_TRUE(std::ranges::all_of(seen, [] (bool const is_seen) { return is_seen; }));
+}
+
+TEST(align_pairwise_test, parallel_thread_pool)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{100, {"ACGTGATG"_dna4,
+                                                                                     "AGTGATACT"_dna4}};
+    seqan3::thread_pool pool{4};
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} |
+                                seqan3::align_cfg::edit_scheme |
+                                seqan3::align_cfg::output_score{} |
+                                seqan3::align_cfg::parallel_work_stealing{pool};
+
+    // Every alignment invocation reuses the threads of the pool.
+    for (size_t i = 0; i < 3; ++i)
+    {
+        size_t count = 0;
+        for (auto && res : seqan3::align_pairwise(sequences, cfg))
+        {
+            EXPECT_EQ(res.score(), -4);
+            ++count;
+        }
+        EXPECT_EQ(count, sequences.size());
+    }
+}
+
+TEST(align_pairwise_test, parallel_thread_pool_interleaved_unordered_results)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{200, {"ACGTGATG"_dna4,
+                                                                                     "AGTGATACT"_dna4}};
+    seqan3::thread_pool pool{4};
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} |
+                                seqan3::align_cfg::edit_scheme |
+                                seqan3::align_cfg::output_score{} |
+                                seqan3::align_cfg::parallel_work_stealing{pool} |
+                                seqan3::align_cfg::unordered_results{2};
+
+    // The ranges share the threads of the pool and are consumed in turns.
+    auto results1 = seqan3::align_pairwise(sequences, cfg);
+    auto results2 = seqan3::align_pairwise(sequences, cfg);
+
+    size_t count = 0;
+    for (auto it1 = results1.begin(), it2 = results2.begin(); it1 != results1.end() || it2 != results2.end();)
+    {
+        if (it1 != results1.end())
+        {
+            EXPECT_EQ((*it1).score(), -4);
+            ++it1;
+            ++count;
+        }
+
+        if (it2 != results2.end())
+        {
+            EXPECT_EQ((*it2).score(), -4);
+            ++it2;
+            ++count;
+        }
+    }
+
+    EXPECT_EQ(count, 2 * sequences.size());
+}
@@ -89,10 +89,23 @@ TEST(alignment_configurator, configure_edit_semi)
 
 TEST(alignment_configurator, configure_edit_banded)
 {
+    EXPECT_EQ(run_test(seqan3::align_cfg::method_global{} |
+                       seqan3::align_cfg::edit_scheme |
+                       seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
+                                                          seqan3::align_cfg::upper_diagonal{1}} |
+                       seqan3::align_cfg::output_score{}).score(), 0);
+
+    // Falls back to the banded dynamic programming if the alignment is requested.
+    EXPECT_EQ(run_test(seqan3::align_cfg::method_global{} |
+                       seqan3::align_cfg::edit_scheme |
+                       seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
+                                                          seqan3::align_cfg::upper_diagonal{1}}).score(), 0);
+
     EXPECT_THROW((run_test(seqan3::align_cfg::method_global{} |
                            seqan3::align_cfg::edit_scheme |
-                           seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
-                                                              seqan3::align_cfg::upper_diagonal{1}})),
+                           seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{1},
+                                                              seqan3::align_cfg::upper_diagonal{2}} |
+                           seqan3::align_cfg::output_score{})),
                  seqan3::invalid_alignment_configuration);
 }
 
@@ -219,6 +232,25 @@ TEST(alignment_configurator, configure_affine_global_semi)
     EXPECT_EQ(run_test(cfg).score(), 0);
 }
 
+TEST(alignment_configurator, configure_affine_global_semi_vectorised_begin_position)
+{
+    auto cfg = seqan3::align_cfg::method_global{
+                   seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+               seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}} |
+               seqan3::align_cfg::output_begin_position{} |
+               seqan3::align_cfg::output_score{} |
+               seqan3::align_cfg::vectorised{};
+
+    // Without the trace matrix the begin positions of the vectorised global alignment are always the origin.
+    EXPECT_THROW(run_test(cfg), seqan3::invalid_alignment_configuration);
+    EXPECT_EQ(run_test(cfg | seqan3::align_cfg::output_alignment{}).score(), 0);
+}
+
 TEST(alignment_configurator, configure_affine_local)
 {
     auto cfg = seqan3::align_cfg::method_local{} |
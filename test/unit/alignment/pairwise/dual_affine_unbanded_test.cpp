@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct dual_affine_unbanded : public ::testing::Test
+{
+    dual_affine_unbanded()
+    {
+        sequence_pairs.emplace_back(sequence_t{}, seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 1));
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 2), sequence_t{});
+
+        // Pairs with strongly differing lengths enforce long gaps.
+        for (size_t i = 0; i < 40; ++i)
+        {
+            sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 7) % 45, 0, i),
+                                        seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 13) % 45, 0, i + 40));
+        }
+    }
+
+    // Scores a gap of the given length with the better of both gap cost functions.
+    int64_t gap_score(size_t const length) const
+    {
+        int64_t const short_score = short_open + static_cast<int64_t>(length) * short_extension;
+        int64_t const long_score = long_open + static_cast<int64_t>(length) * long_extension;
+        return std::max(short_score, long_score);
+    }
+
+    // Computes the optimal score by enumerating the length of every gap explicitly.
+    int64_t expected_score(sequence_t const & sequence1, sequence_t const & sequence2, bool const is_local) const
+    {
+        size_t const columns = sequence1.size() + 1;
+        size_t const rows = sequence2.size() + 1;
+        std::vector<std::vector<int64_t>> matrix(columns, std::vector<int64_t>(rows, 0));
+
+        int64_t best = 0;
+        for (size_t col = 0; col < columns; ++col)
+        {
+            for (size_t row = 0; row < rows; ++row)
+            {
+                if (col == 0 && row == 0)
+                    continue;
+
+                int64_t score = std::numeric_limits<int32_t>::lowest();
+                if (col > 0 && row > 0)
+                    score = matrix[col - 1][row - 1] + ((sequence1[col - 1] == sequence2[row - 1]) ? 4 : -5);
+                for (size_t length = 1; length <= col; ++length)
+                    score = std::max(score, matrix[col - length][row] + gap_score(length));
+                for (size_t length = 1; length <= row; ++length)
+                    score = std::max(score, matrix[col][row - length] + gap_score(length));
+
+                matrix[col][row] = is_local ? std::max<int64_t>(score, 0) : score;
+                best = std::max(best, matrix[col][row]);
+            }
+        }
+
+        return is_local ? best : matrix[columns - 1][rows - 1];
+    }
+
+    auto gap_cost() const
+    {
+        return seqan3::align_cfg::gap_cost_dual_affine{
+            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{short_open},
+                                               seqan3::align_cfg::extension_score{short_extension}},
+            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{long_open},
+                                               seqan3::align_cfg::extension_score{long_extension}}};
+    }
+
+    int32_t short_open{-4};
+    int32_t short_extension{-2};
+    int32_t long_open{-12};
+    int32_t long_extension{-1};
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+
+    static constexpr auto scoring_scheme = seqan3::align_cfg::scoring_scheme{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+};
+
+TEST_F(dual_affine_unbanded, global)
+{
+    auto cfg = seqan3::align_cfg::method_global{} | gap_cost() | scoring_scheme |
+               seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), sequence_pairs.size());
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index];
+        EXPECT_EQ(results[index].score(), expected_score(sequence1, sequence2, false)) << "sequence pair " << index;
+        EXPECT_EQ(results[index].sequence1_end_position(), sequence1.size());
+        EXPECT_EQ(results[index].sequence2_end_position(), sequence2.size());
+    }
+}
+
+TEST_F(dual_affine_unbanded, global_vectorised)
+{
+    auto cfg = seqan3::align_cfg::method_global{} | gap_cost() | scoring_scheme |
+               seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{} |
+               seqan3::align_cfg::vectorised{};
+
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), sequence_pairs.size());
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index];
+        EXPECT_EQ(results[index].score(), expected_score(sequence1, sequence2, false)) << "sequence pair " << index;
+        EXPECT_EQ(results[index].sequence1_end_position(), sequence1.size());
+        EXPECT_EQ(results[index].sequence2_end_position(), sequence2.size());
+    }
+}
+
+TEST_F(dual_affine_unbanded, local_vectorised)
+{
+    auto cfg = seqan3::align_cfg::method_local{} | gap_cost() | scoring_scheme |
+               seqan3::align_cfg::output_score{} | seqan3::align_cfg::vectorised{};
+
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), sequence_pairs.size());
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index];
+        EXPECT_EQ(results[index].score(), expected_score(sequence1, sequence2, true)) << "sequence pair " << index;
+    }
+}
+
+TEST_F(dual_affine_unbanded, same_as_affine_if_both_gap_costs_are_equal)
+{
+    auto affine_gap_cost = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                              seqan3::align_cfg::extension_score{-1}};
+    auto method = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+    auto base_cfg = method | scoring_scheme | seqan3::align_cfg::output_score{} |
+                    seqan3::align_cfg::output_end_position{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, base_cfg | affine_gap_cost)
+                  | seqan3::views::to<std::vector>;
+    auto results = seqan3::align_pairwise(sequence_pairs,
+                                          base_cfg | seqan3::align_cfg::gap_cost_dual_affine{affine_gap_cost,
+                                                                                             affine_gap_cost})
+                 | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+        EXPECT_EQ(results[index].sequence1_end_position(), expected[index].sequence1_end_position());
+        EXPECT_EQ(results[index].sequence2_end_position(), expected[index].sequence2_end_position());
+    }
+}
+
+TEST_F(dual_affine_unbanded, unsupported_configuration)
+{
+    auto cfg = seqan3::align_cfg::method_global{} | gap_cost() | scoring_scheme;
+
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[2], cfg | seqan3::align_cfg::output_alignment{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[2],
+                                        cfg | seqan3::align_cfg::output_score{} |
+                                              seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-4},
+                                                                                 seqan3::align_cfg::upper_diagonal{4}}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[2],
+                                        seqan3::align_cfg::method_local{} | gap_cost() | scoring_scheme |
+                                        seqan3::align_cfg::output_score{}),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,254 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct edit_distance_banded_test : public ::testing::Test
+{
+    edit_distance_banded_test()
+    {
+        sequence_pairs.emplace_back(sequence_t{}, sequence_t{});
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 1), sequence_t{});
+        sequence_pairs.emplace_back(sequence_t{}, seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 2));
+
+        // Sequence pairs of different lengths spanning several machine words.
+        for (size_t i = 0; i < 40; ++i)
+        {
+            sequence_t sequence = seqan3::test::generate_sequence<seqan3::dna4>(20 + i * 7, 0, i);
+            sequence_t mutated_sequence = seqan3::test::mutate_sequence(sequence, 0.02 * (i % 10 + 1), i);
+            sequence_pairs.emplace_back(std::move(sequence), std::move(mutated_sequence));
+        }
+    }
+
+    // Computes the banded edit distance with the dynamic programming recursion.
+    static std::pair<size_t, size_t> banded_edit_distance(sequence_t const & database,
+                                                          sequence_t const & query,
+                                                          int64_t const lower_diagonal,
+                                                          int64_t const upper_diagonal,
+                                                          bool const is_semi_global)
+    {
+        int64_t const column_count = database.size() + 1;
+        int64_t const row_count = query.size() + 1;
+        size_t const infinity = std::numeric_limits<size_t>::max() / 2;
+        auto in_band = [&] (int64_t const row, int64_t const column)
+        {
+            return column - row >= lower_diagonal && column - row <= upper_diagonal;
+        };
+
+        std::vector<std::vector<size_t>> matrix(row_count, std::vector<size_t>(column_count, infinity));
+        for (int64_t row = 0; row < row_count; ++row)
+        {
+            for (int64_t column = 0; column < column_count; ++column)
+            {
+                if (!in_band(row, column))
+                    continue;
+
+                if (row == 0)
+                    matrix[row][column] = is_semi_global ? 0 : column;
+                else if (column == 0)
+                    matrix[row][column] = row;
+                else
+                    matrix[row][column] = std::min({matrix[row - 1][column - 1] +
+                                                        (database[column - 1] != query[row - 1]),
+                                                    matrix[row - 1][column] + 1,
+                                                    matrix[row][column - 1] + 1});
+            }
+        }
+
+        std::pair<size_t, size_t> result{matrix[row_count - 1][column_count - 1], column_count - 1};
+        if (is_semi_global)
+        {
+            result.first = infinity;
+            for (int64_t column = 0; column < column_count; ++column)
+                if (matrix[row_count - 1][column] <= result.first)
+                    result = {matrix[row_count - 1][column], column};
+        }
+        return result;
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+
+    static constexpr auto output_config = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    static constexpr auto semi_global_config =
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+};
+
+TEST_F(edit_distance_banded_test, global)
+{
+    for (int32_t const width : {0, 1, 3, 10, 70, 150})
+    {
+        for (auto const & [database, query] : sequence_pairs)
+        {
+            int32_t const size_difference = static_cast<int32_t>(database.size()) - query.size();
+            int32_t const lower_diagonal = std::min(0, size_difference) - width;
+            int32_t const upper_diagonal = std::max(0, size_difference) + width;
+            auto cfg = seqan3::align_cfg::method_global{} |
+                       seqan3::align_cfg::edit_scheme |
+                       seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower_diagonal},
+                                                          seqan3::align_cfg::upper_diagonal{upper_diagonal}} |
+                       output_config;
+
+            auto results = seqan3::align_pairwise(std::tie(database, query), cfg);
+            auto result = *results.begin();
+            auto [score, end_column] = banded_edit_distance(database, query, lower_diagonal, upper_diagonal, false);
+
+            EXPECT_EQ(result.score(), -static_cast<int32_t>(score)) << "band [" << lower_diagonal << ":"
+                                                                    << upper_diagonal << "]";
+            EXPECT_EQ(result.sequence1_end_position(), end_column);
+            EXPECT_EQ(result.sequence2_end_position(), query.size());
+        }
+    }
+}
+
+TEST_F(edit_distance_banded_test, semi_global)
+{
+    for (auto const & [lower_diagonal, upper_diagonal] : std::vector<std::pair<int32_t, int32_t>>{{-5, 5},
+                                                                                                  {-30, 2},
+                                                                                                  {0, 70},
+                                                                                                  {-100, 200}})
+    {
+        for (auto const & [database, query] : sequence_pairs)
+        {
+            // The band must reach the last row.
+            if (static_cast<int64_t>(query.size()) - static_cast<int64_t>(database.size()) > -lower_diagonal)
+                continue;
+
+            auto cfg = semi_global_config |
+                       seqan3::align_cfg::edit_scheme |
+                       seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower_diagonal},
+                                                          seqan3::align_cfg::upper_diagonal{upper_diagonal}} |
+                       output_config;
+
+            auto results = seqan3::align_pairwise(std::tie(database, query), cfg);
+            auto result = *results.begin();
+            auto [score, end_column] = banded_edit_distance(database, query, lower_diagonal, upper_diagonal, true);
+
+            EXPECT_EQ(result.score(), -static_cast<int32_t>(score)) << "band [" << lower_diagonal << ":"
+                                                                    << upper_diagonal << "]";
+            EXPECT_EQ(result.sequence1_end_position(), end_column);
+            EXPECT_EQ(result.sequence2_end_position(), query.size());
+        }
+    }
+}
+
+TEST_F(edit_distance_banded_test, wide_band_equals_unbanded)
+{
+    auto band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1000},
+                                                   seqan3::align_cfg::upper_diagonal{1000}};
+
+    for (auto const & method : {seqan3::align_cfg::method_global{}, semi_global_config})
+    {
+        auto cfg = method | seqan3::align_cfg::edit_scheme | output_config;
+        auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+        auto results = seqan3::align_pairwise(sequence_pairs, cfg | band) | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), expected.size());
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence1_end_position(), expected[index].sequence1_end_position());
+            EXPECT_EQ(results[index].sequence2_end_position(), expected[index].sequence2_end_position());
+        }
+    }
+}
+
+TEST_F(edit_distance_banded_test, min_score)
+{
+    auto cfg = seqan3::align_cfg::method_global{} |
+               seqan3::align_cfg::edit_scheme |
+               seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-2},
+                                                  seqan3::align_cfg::upper_diagonal{2}} |
+               seqan3::align_cfg::min_score{-1} |
+               output_config;
+
+    auto results = seqan3::align_pairwise(std::tuple{"AACGTT"_dna4, "AAGTT"_dna4}, cfg);
+    EXPECT_EQ((*results.begin()).score(), -1);
+
+    auto results_without_hit = seqan3::align_pairwise(std::tuple{"AACGTT"_dna4, "AGGTA"_dna4}, cfg);
+    auto result = *results_without_hit.begin();
+    EXPECT_EQ(result.score(), seqan3::detail::matrix_inf<int32_t>);
+    EXPECT_EQ(result.sequence1_end_position(), 6u);
+    EXPECT_EQ(result.sequence2_end_position(), 5u);
+}
+
+TEST_F(edit_distance_banded_test, invalid_band)
+{
+    auto band_config = [] (int32_t const lower_diagonal, int32_t const upper_diagonal)
+    {
+        return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower_diagonal},
+                                                  seqan3::align_cfg::upper_diagonal{upper_diagonal}};
+    };
+    auto global_cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | output_config;
+    auto semi_global_cfg = semi_global_config | seqan3::align_cfg::edit_scheme | output_config;
+    auto sequences = std::tuple{"AACGTTAACGTT"_dna4, "ACGTAC"_dna4};
+    // The band is validated when the alignment is computed, hence the results need to be iterated.
+    auto align = [&] (auto const & cfg)
+    {
+        return seqan3::align_pairwise(sequences, cfg) | seqan3::views::to<std::vector>;
+    };
+
+    // The upper diagonal is smaller than the lower diagonal.
+    EXPECT_THROW(align(global_cfg | band_config(2, -2)),
+                 seqan3::invalid_alignment_configuration);
+    // The band does not start in the origin.
+    EXPECT_THROW(align(global_cfg | band_config(1, 8)),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(align(semi_global_cfg | band_config(-8, -1)),
+                 seqan3::invalid_alignment_configuration);
+    // The band does not reach the last cell.
+    EXPECT_THROW(align(global_cfg | band_config(-2, 2)),
+                 seqan3::invalid_alignment_configuration);
+
+    // The first and the last row are free in the semi-global alignment.
+    auto results = align(semi_global_cfg | band_config(1, 3));
+    EXPECT_EQ(results[0].score(), -2);
+    EXPECT_EQ(results[0].sequence1_end_position(), 9u);
+}
+
+TEST(edit_distance_banded, kernel)
+{
+    seqan3::align_cfg::band_fixed_size band{seqan3::align_cfg::lower_diagonal{-3},
+                                            seqan3::align_cfg::upper_diagonal{3}};
+    seqan3::detail::edit_distance_banded<false> global_algorithm{band};
+    seqan3::detail::edit_distance_banded<true> semi_global_algorithm{band};
+
+    global_algorithm.compute("AACCGGTTAA"_dna4, "ACCGGTTA"_dna4);
+    EXPECT_EQ(global_algorithm.score(), 2u);
+    EXPECT_EQ(global_algorithm.end_column(), 10u);
+
+    semi_global_algorithm.compute("AACCGGTTAA"_dna4, "ACCGGTTA"_dna4);
+    EXPECT_EQ(semi_global_algorithm.score(), 0u);
+    EXPECT_EQ(semi_global_algorithm.end_column(), 9u);
+
+    // A band of width one only allows substitutions.
+    seqan3::detail::edit_distance_banded<false> diagonal_algorithm{
+        seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{0}, seqan3::align_cfg::upper_diagonal{0}}};
+    diagonal_algorithm.compute("ACGTACGT"_dna4, "CGTACGTA"_dna4);
+    EXPECT_EQ(diagonal_algorithm.score(), 8u);
+}
@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+
+using seqan3::operator""_dna4;
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct edit_distance_unbanded_simd_test : public ::testing::Test
+{
+    edit_distance_unbanded_simd_test()
+    {
+        // Short queries, which are computed in the lanes, mixed with empty and long queries, which are not.
+        for (size_t i = 0; i < 60; ++i)
+        {
+            size_t const query_size = (i % 13 == 0) ? 0 : (i % 7 == 0) ? 40 + i : 1 + (i * 11) % 32;
+            sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>((i * 17) % 120, 0, i),
+                                        seqan3::test::generate_sequence<seqan3::dna4>(query_size, 0, i + 100));
+        }
+
+        // Queries of up to 64 symbols.
+        for (size_t i = 0; i < 20; ++i)
+        {
+            sequence_t database = seqan3::test::generate_sequence<seqan3::dna4>(200, 0, i + 200);
+            sequence_t query{database.begin() + 50 + i, database.begin() + 90 + i};
+            sequence_pairs.emplace_back(std::move(database), seqan3::test::mutate_sequence(query, 0.1, i));
+        }
+    }
+
+    template <typename config_t>
+    void check_against_scalar(config_t const & cfg, std::vector<std::pair<sequence_t, sequence_t>> & pairs)
+    {
+        auto expected = seqan3::align_pairwise(pairs, cfg) | seqan3::views::to<std::vector>;
+        auto results = seqan3::align_pairwise(pairs, cfg | seqan3::align_cfg::vectorised{})
+                     | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), expected.size());
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index].sequence1_id(), expected[index].sequence1_id());
+            EXPECT_EQ(results[index].sequence2_id(), expected[index].sequence2_id());
+            EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence1_end_position(), expected[index].sequence1_end_position())
+                << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence2_end_position(), expected[index].sequence2_end_position())
+                << "sequence pair " << index;
+        }
+    }
+
+    template <typename config_t>
+    void check_against_scalar(config_t const & cfg)
+    {
+        check_against_scalar(cfg, sequence_pairs);
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+
+    static constexpr auto output_config = seqan3::align_cfg::output_score{} |
+                                          seqan3::align_cfg::output_end_position{} |
+                                          seqan3::align_cfg::output_sequence1_id{} |
+                                          seqan3::align_cfg::output_sequence2_id{};
+
+    static constexpr auto semi_global_config =
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+};
+
+TEST_F(edit_distance_unbanded_simd_test, global)
+{
+    check_against_scalar(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, semi_global)
+{
+    check_against_scalar(semi_global_config | seqan3::align_cfg::edit_scheme | output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, global_min_score)
+{
+    check_against_scalar(seqan3::align_cfg::method_global{} |
+                         seqan3::align_cfg::edit_scheme |
+                         seqan3::align_cfg::min_score{-5} |
+                         output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, semi_global_min_score)
+{
+    check_against_scalar(semi_global_config |
+                         seqan3::align_cfg::edit_scheme |
+                         seqan3::align_cfg::min_score{-5} |
+                         output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, same_database)
+{
+    // Many short reads against the same reference, as in the typical use case.
+    sequence_t database = seqan3::test::generate_sequence<seqan3::dna4>(500, 0, 0);
+    std::vector<std::pair<sequence_t, sequence_t>> pairs{};
+    for (size_t i = 0; i < 45; ++i)
+    {
+        sequence_t read{database.begin() + i * 10, database.begin() + i * 10 + 20 + i % 40};
+        pairs.emplace_back(database, seqan3::test::mutate_sequence(read, 0.05, i));
+    }
+
+    check_against_scalar(semi_global_config | seqan3::align_cfg::edit_scheme | output_config, pairs);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, alignment_falls_back_to_scalar)
+{
+    auto cfg = seqan3::align_cfg::method_global{} |
+               seqan3::align_cfg::edit_scheme |
+               seqan3::align_cfg::output_score{} |
+               seqan3::align_cfg::output_alignment{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::vectorised{})
+                 | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+        EXPECT_EQ(results[index].score(), expected[index].score());
+}
+
+TEST(edit_distance_unbanded_simd, kernel)
+{
+    using word_simd_t = seqan3::simd::simd_type_t<uint64_t>;
+    seqan3::detail::edit_distance_unbanded_simd<word_simd_t, seqan3::dna4, false> global_kernel{};
+    seqan3::detail::edit_distance_unbanded_simd<word_simd_t, seqan3::dna4, true> semi_global_kernel{};
+
+    sequence_t database = "AACCGGTTAACCGGTT"_dna4;
+    sequence_t query = "ACGTACGT"_dna4;
+
+    EXPECT_EQ(global_kernel.add_lane(database, query), 0u);
+    EXPECT_EQ(semi_global_kernel.add_lane(database, "CCGGTT"_dna4), 0u);
+    global_kernel.compute();
+    semi_global_kernel.compute();
+
+    EXPECT_EQ(global_kernel.score(0), 8u);
+    EXPECT_EQ(global_kernel.end_column(0), 16u);
+    EXPECT_EQ(semi_global_kernel.score(0), 0u);
+    EXPECT_EQ(semi_global_kernel.end_column(0), 16u); // The last occurrence is reported.
+
+    semi_global_kernel.clear();
+    EXPECT_FALSE(semi_global_kernel.full());
+    EXPECT_EQ(semi_global_kernel.add_lane(sequence_t{}, "ACG"_dna4), 0u);
+    semi_global_kernel.compute();
+    EXPECT_EQ(semi_global_kernel.score(0), 3u);
+    EXPECT_EQ(semi_global_kernel.end_column(0), 0u);
+}
@@ -0,0 +1,217 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_all_hits.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_on_result.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+
+using sequence_t = std::vector<seqan3::dna4>;
+using hit_t = std::pair<size_t, int32_t>; // (end position in the first sequence, score)
+
+struct semi_global_edit_distance_all_hits_test : public ::testing::Test
+{
+    semi_global_edit_distance_all_hits_test()
+    {
+        // Queries of different lengths spanning several machine words.
+        for (size_t i = 0; i < 30; ++i)
+        {
+            sequence_t database = seqan3::test::generate_sequence<seqan3::dna4>(300, 0, i);
+            sequence_t query = seqan3::test::generate_sequence<seqan3::dna4>(5 + i * 5, 0, 100 + i);
+
+            // Plant a few mutated copies of the query in the database.
+            for (size_t copy = 0; copy < 3; ++copy)
+            {
+                sequence_t mutated_query = seqan3::test::mutate_sequence(query, 0.05 * (copy + 1), i * 3 + copy);
+                size_t const position = std::min(copy * 100, database.size() - mutated_query.size());
+                std::ranges::copy(mutated_query, database.begin() + position);
+            }
+
+            sequence_pairs.emplace_back(std::move(database), std::move(query));
+        }
+    }
+
+    // Computes the hits from the last row of the semi-global dynamic programming matrix.
+    static std::vector<hit_t> expected_hits(sequence_t const & database,
+                                            sequence_t const & query,
+                                            int32_t const min_score,
+                                            bool const local_maxima_only)
+    {
+        std::vector<int32_t> column(query.size() + 1);
+        for (size_t row = 0; row < column.size(); ++row)
+            column[row] = -static_cast<int32_t>(row);
+
+        std::vector<int32_t> last_row{column.back()};
+        for (seqan3::dna4 const symbol : database)
+        {
+            int32_t diagonal = column[0];
+            for (size_t row = 1; row < column.size(); ++row)
+            {
+                int32_t const next_diagonal = column[row];
+                column[row] = std::max({diagonal - (symbol != query[row - 1]), column[row] - 1, column[row - 1] - 1});
+                diagonal = next_diagonal;
+            }
+            last_row.push_back(column.back());
+        }
+
+        int32_t const no_hit = std::numeric_limits<int32_t>::lowest();
+        auto score_at = [&] (int64_t const position)
+        {
+            if (position < 0 || position >= static_cast<int64_t>(last_row.size()) || last_row[position] < min_score)
+                return no_hit;
+            return last_row[position];
+        };
+
+        std::vector<hit_t> hits{};
+        for (int64_t position = 0; position < static_cast<int64_t>(last_row.size()); ++position)
+        {
+            int32_t const score = score_at(position);
+            if (score == no_hit)
+                continue;
+
+            if (!local_maxima_only || (score >= score_at(position - 1) && score > score_at(position + 1)))
+                hits.emplace_back(position, score);
+        }
+        return hits;
+    }
+
+    template <typename config_t>
+    static std::vector<hit_t> compute_hits(sequence_t const & database, sequence_t const & query, config_t const & cfg)
+    {
+        std::vector<hit_t> hits{};
+        seqan3::align_pairwise(std::tie(database, query),
+                               cfg | seqan3::align_cfg::on_result{[&] (auto && result)
+                               {
+                                   EXPECT_EQ(result.sequence2_end_position(), query.size());
+                                   hits.emplace_back(result.sequence1_end_position(), result.score());
+                               }});
+        return hits;
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+
+    static constexpr auto semi_global_config =
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+        seqan3::align_cfg::edit_scheme |
+        seqan3::align_cfg::output_score{} |
+        seqan3::align_cfg::output_end_position{};
+};
+
+TEST_F(semi_global_edit_distance_all_hits_test, all_hits)
+{
+    for (int32_t const min_score : {0, -1, -3, -8, -20})
+    {
+        auto cfg = semi_global_config | seqan3::align_cfg::min_score{min_score} | seqan3::align_cfg::all_hits{};
+
+        for (auto const & [database, query] : sequence_pairs)
+            EXPECT_EQ(compute_hits(database, query, cfg), expected_hits(database, query, min_score, false))
+                << "query size " << query.size() << ", min_score " << min_score;
+    }
+}
+
+TEST_F(semi_global_edit_distance_all_hits_test, local_maxima_only)
+{
+    for (int32_t const min_score : {0, -1, -3, -8, -20})
+    {
+        auto cfg = semi_global_config |
+                   seqan3::align_cfg::min_score{min_score} |
+                   seqan3::align_cfg::all_hits{seqan3::align_cfg::local_maxima_only{true}};
+
+        for (auto const & [database, query] : sequence_pairs)
+            EXPECT_EQ(compute_hits(database, query, cfg), expected_hits(database, query, min_score, true))
+                << "query size " << query.size() << ", min_score " << min_score;
+    }
+}
+
+TEST_F(semi_global_edit_distance_all_hits_test, example)
+{
+    auto cfg = semi_global_config | seqan3::align_cfg::min_score{-1};
+    sequence_t database = "ACGTACGGTTACGT"_dna4;
+    sequence_t query = "ACGT"_dna4;
+
+    std::vector<hit_t> expected{{3, -1}, {4, 0}, {5, -1}, {7, -1}, {8, -1}, {9, -1}, {13, -1}, {14, 0}};
+    EXPECT_EQ(compute_hits(database, query, cfg | seqan3::align_cfg::all_hits{}), expected);
+
+    // Of the equally good neighbouring hits only the last one is reported.
+    expected = {{4, 0}, {9, -1}, {14, 0}};
+    auto local_maxima_cfg = cfg | seqan3::align_cfg::all_hits{seqan3::align_cfg::local_maxima_only{true}};
+    EXPECT_EQ(compute_hits(database, query, local_maxima_cfg), expected);
+}
+
+TEST_F(semi_global_edit_distance_all_hits_test, empty_query)
+{
+    auto cfg = semi_global_config | seqan3::align_cfg::min_score{0} | seqan3::align_cfg::all_hits{};
+    sequence_t database = "ACG"_dna4;
+
+    std::vector<hit_t> expected{{0, 0}, {1, 0}, {2, 0}, {3, 0}};
+    EXPECT_EQ(compute_hits(database, sequence_t{}, cfg), expected);
+}
+
+TEST_F(semi_global_edit_distance_all_hits_test, sequence_ids)
+{
+    std::vector<size_t> ids{};
+    auto cfg = semi_global_config |
+               seqan3::align_cfg::min_score{0} |
+               seqan3::align_cfg::all_hits{} |
+               seqan3::align_cfg::output_sequence1_id{} |
+               seqan3::align_cfg::on_result{[&] (auto && result) { ids.push_back(result.sequence1_id()); }};
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequences{{"ACGTACGT"_dna4, "ACGT"_dna4},
+                                                             {"TTTT"_dna4, "ACGT"_dna4},
+                                                             {"GTGT"_dna4, "GT"_dna4}};
+    seqan3::align_pairwise(sequences, cfg);
+
+    EXPECT_EQ(ids, (std::vector<size_t>{0, 0, 2, 2}));
+}
+
+TEST_F(semi_global_edit_distance_all_hits_test, invalid_configuration)
+{
+    auto sequences = std::tuple{"ACGTACGT"_dna4, "ACGT"_dna4};
+    auto on_result = seqan3::align_cfg::on_result{[] (auto &&) {}};
+    auto output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    // min_score is required.
+    EXPECT_THROW(seqan3::align_pairwise(sequences, semi_global_config | seqan3::align_cfg::all_hits{} | on_result),
+                 seqan3::invalid_alignment_configuration);
+    // The first sequence must have free end gaps.
+    EXPECT_THROW(seqan3::align_pairwise(sequences,
+                                        seqan3::align_cfg::method_global{} |
+                                        seqan3::align_cfg::edit_scheme |
+                                        seqan3::align_cfg::min_score{-1} |
+                                        seqan3::align_cfg::all_hits{} |
+                                        output |
+                                        on_result),
+                 seqan3::invalid_alignment_configuration);
+    // Only the edit distance reports all hits.
+    EXPECT_THROW(seqan3::align_pairwise(sequences,
+                                        seqan3::align_cfg::method_global{} |
+                                        seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+                                        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                           seqan3::align_cfg::extension_score{-1}} |
+                                        seqan3::align_cfg::all_hits{} |
+                                        output |
+                                        on_result),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,144 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct global_affine_banded_per_sequence_pair : public ::testing::Test
+{
+    global_affine_banded_per_sequence_pair()
+    {
+        // Every sequence pair gets its own band around the diagonals of the first and the last cell.
+        for (size_t i = 0; i < 50; ++i)
+        {
+            size_t const sequence1_size = 20 + (i * 7) % 50;
+            size_t const sequence2_size = 20 + (i * 13) % 50;
+            int32_t const size_difference = static_cast<int32_t>(sequence1_size) -
+                                            static_cast<int32_t>(sequence2_size);
+            int32_t const lower_extension = i % 5;
+            int32_t const upper_extension = i % 3;
+
+            sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(sequence1_size, 0, i),
+                                        seqan3::test::generate_sequence<seqan3::dna4>(sequence2_size, 0, i + 50));
+            bands.emplace_back(seqan3::align_cfg::lower_diagonal{std::min(0, size_difference) - lower_extension},
+                               seqan3::align_cfg::upper_diagonal{std::max(0, size_difference) + upper_extension});
+        }
+    }
+
+    auto band_selector() const
+    {
+        return seqan3::align_cfg::band_per_sequence_pair{[this] (size_t const index) { return bands[index]; }};
+    }
+
+    // Computes every sequence pair separately within its own band.
+    template <typename config_t>
+    auto expected_results(config_t const & cfg) const
+    {
+        std::vector<std::pair<int32_t, std::pair<size_t, size_t>>> results{};
+
+        for (size_t index = 0; index < sequence_pairs.size(); ++index)
+        {
+            auto rng = seqan3::align_pairwise(sequence_pairs[index], cfg | bands[index]);
+            auto result = *rng.begin();
+            results.emplace_back(result.score(), std::pair{result.sequence1_end_position(),
+                                                           result.sequence2_end_position()});
+        }
+
+        return results;
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+    std::vector<seqan3::align_cfg::band_fixed_size> bands{};
+
+    static constexpr auto base_config = seqan3::align_cfg::method_global{} |
+                                        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                           seqan3::align_cfg::extension_score{-1}} |
+                                        seqan3::align_cfg::scoring_scheme{
+                                            seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                              seqan3::mismatch_score{-5}}};
+};
+
+TEST_F(global_affine_banded_per_sequence_pair, score_and_end_positions)
+{
+    auto cfg = base_config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+    auto expected = expected_results(cfg);
+
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg | band_selector()) | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        EXPECT_EQ(results[index].score(), expected[index].first) << "sequence pair " << index;
+        EXPECT_EQ(results[index].sequence1_end_position(), expected[index].second.first);
+        EXPECT_EQ(results[index].sequence2_end_position(), expected[index].second.second);
+    }
+}
+
+TEST_F(global_affine_banded_per_sequence_pair, vectorised_score)
+{
+    auto cfg = base_config | seqan3::align_cfg::output_score{};
+    auto expected = expected_results(cfg | seqan3::align_cfg::output_end_position{});
+
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg | band_selector() | seqan3::align_cfg::vectorised{})
+                 | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+        EXPECT_EQ(results[index].score(), expected[index].first) << "sequence pair " << index;
+}
+
+TEST_F(global_affine_banded_per_sequence_pair, vectorised_score_int16)
+{
+    auto cfg = base_config | seqan3::align_cfg::output_score{};
+    auto expected = expected_results(cfg | seqan3::align_cfg::output_end_position{});
+
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg | band_selector() |
+                                                          seqan3::align_cfg::vectorised{} |
+                                                          seqan3::align_cfg::score_type<int16_t>{})
+                 | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+        EXPECT_EQ(results[index].score(), expected[index].first) << "sequence pair " << index;
+}
+
+TEST_F(global_affine_banded_per_sequence_pair, invalid_band)
+{
+    // The band of the second sequence pair does not contain the last cell of the matrix.
+    bands[1] = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{0},
+                                                  seqan3::align_cfg::upper_diagonal{0}};
+    sequence_pairs[1].first.resize(sequence_pairs[1].second.size() + 5);
+
+    auto cfg = base_config | seqan3::align_cfg::output_score{} | band_selector();
+
+    EXPECT_THROW((seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW((seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::vectorised{})
+                  | seqan3::views::to<std::vector>),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST_F(global_affine_banded_per_sequence_pair, unsupported_configuration)
+{
+    auto cfg = base_config | band_selector() | seqan3::align_cfg::output_alignment{};
+
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs, cfg), seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,186 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct global_affine_linear_memory : public ::testing::Test
+{
+    global_affine_linear_memory()
+    {
+        // Sequences of different lengths including empty ones and pairs with many equally good alignments.
+        sequence_pairs.emplace_back(sequence_t{}, sequence_t{});
+        sequence_pairs.emplace_back(sequence_t{}, seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 1));
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 2), sequence_t{});
+        sequence_pairs.emplace_back(sequence_t(20, seqan3::dna4{}), sequence_t(5, seqan3::dna4{}));
+
+        for (size_t i = 0; i < 50; ++i)
+        {
+            sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 7) % 80, 0, i),
+                                        seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 13) % 80, 0, i + 50));
+        }
+    }
+
+    // Recomputes the score of the given alignment to verify that it is optimal.
+    template <typename alignment_t>
+    int32_t alignment_score(alignment_t const & alignment, int32_t const open, int32_t const extension) const
+    {
+        auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+        auto sequence2_it = gapped_sequence2.begin();
+
+        int32_t score = 0;
+        bool gap_in_sequence1 = false;
+        bool gap_in_sequence2 = false;
+        for (auto && symbol1 : gapped_sequence1)
+        {
+            auto symbol2 = *sequence2_it;
+            ++sequence2_it;
+
+            if (symbol1 == seqan3::gap{})
+            {
+                score += extension + (gap_in_sequence1 ? 0 : open);
+                gap_in_sequence1 = true;
+                gap_in_sequence2 = false;
+            }
+            else if (symbol2 == seqan3::gap{})
+            {
+                score += extension + (gap_in_sequence2 ? 0 : open);
+                gap_in_sequence1 = false;
+                gap_in_sequence2 = true;
+            }
+            else
+            {
+                score += (symbol1 == symbol2) ? 4 : -5;
+                gap_in_sequence1 = false;
+                gap_in_sequence2 = false;
+            }
+        }
+
+        return score;
+    }
+
+    template <typename config_t>
+    void check_against_trace_matrix(config_t const & cfg, int32_t const open, int32_t const extension)
+    {
+        auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+        auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::linear_memory_traceback{})
+                     | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), expected.size());
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence1_begin_position(), 0u);
+            EXPECT_EQ(results[index].sequence2_begin_position(), 0u);
+            EXPECT_EQ(results[index].sequence1_end_position(), expected[index].sequence1_end_position());
+            EXPECT_EQ(results[index].sequence2_end_position(), expected[index].sequence2_end_position());
+
+            // The alignment may differ from the one of the trace matrix if several optimal alignments exist.
+            auto const & [gapped_sequence1, gapped_sequence2] = results[index].alignment();
+            EXPECT_RANGE_EQ(gapped_sequence1 | std::views::filter([] (auto c) { return c != seqan3::gap{}; })
+                                             | seqan3::views::to_char,
+                            sequence_pairs[index].first | seqan3::views::to_char);
+            EXPECT_RANGE_EQ(gapped_sequence2 | std::views::filter([] (auto c) { return c != seqan3::gap{}; })
+                                             | seqan3::views::to_char,
+                            sequence_pairs[index].second | seqan3::views::to_char);
+            EXPECT_EQ(alignment_score(results[index].alignment(), open, extension), expected[index].score())
+                << "sequence pair " << index;
+        }
+    }
+
+    static constexpr auto gap_cost(int32_t const open, int32_t const extension)
+    {
+        return seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{open},
+                                                  seqan3::align_cfg::extension_score{extension}};
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+
+    static constexpr auto base_config = seqan3::align_cfg::method_global{} |
+                                        seqan3::align_cfg::scoring_scheme{
+                                            seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                              seqan3::mismatch_score{-5}}} |
+                                        seqan3::align_cfg::output_score{} |
+                                        seqan3::align_cfg::output_begin_position{} |
+                                        seqan3::align_cfg::output_end_position{} |
+                                        seqan3::align_cfg::output_alignment{};
+};
+
+TEST_F(global_affine_linear_memory, affine_gaps)
+{
+    check_against_trace_matrix(base_config | gap_cost(-10, -1), -10, -1);
+}
+
+TEST_F(global_affine_linear_memory, cheap_gap_open)
+{
+    check_against_trace_matrix(base_config | gap_cost(-2, -3), -2, -3);
+}
+
+TEST_F(global_affine_linear_memory, linear_gaps)
+{
+    check_against_trace_matrix(base_config | gap_cost(0, -2), 0, -2);
+}
+
+TEST_F(global_affine_linear_memory, begin_positions_only)
+{
+    auto cfg = seqan3::align_cfg::method_global{} |
+               gap_cost(-10, -1) |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                   seqan3::mismatch_score{-5}}} |
+               seqan3::align_cfg::output_score{} |
+               seqan3::align_cfg::output_begin_position{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::linear_memory_traceback{})
+                 | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        EXPECT_EQ(results[index].score(), expected[index].score());
+        EXPECT_EQ(results[index].sequence1_begin_position(), 0u);
+        EXPECT_EQ(results[index].sequence2_begin_position(), 0u);
+    }
+}
+
+TEST_F(global_affine_linear_memory, unsupported_configuration)
+{
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::linear_memory_traceback,
+                                                          seqan3::align_cfg::method_local>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::linear_memory_traceback,
+                                                          seqan3::align_cfg::band_fixed_size>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::linear_memory_traceback,
+                                                          seqan3::align_cfg::vectorised>));
+
+    auto cfg = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                                seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+               gap_cost(-10, -1) |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+               seqan3::align_cfg::output_alignment{} |
+               seqan3::align_cfg::linear_memory_traceback{};
+
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[4], cfg), seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,237 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_dual_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+struct global_affine_wavefront : public ::testing::Test
+{
+    global_affine_wavefront()
+    {
+        // Sequences of different lengths including empty and identical ones.
+        sequence_pairs.emplace_back(sequence_t{}, sequence_t{});
+        sequence_pairs.emplace_back(sequence_t{}, seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 1));
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(7, 0, 2), sequence_t{});
+        sequence_pairs.emplace_back(sequence_t(20, seqan3::dna4{}), sequence_t(5, seqan3::dna4{}));
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(30, 0, 3),
+                                    seqan3::test::generate_sequence<seqan3::dna4>(30, 0, 3));
+
+        // Unrelated sequences.
+        for (size_t i = 0; i < 30; ++i)
+        {
+            sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 7) % 80, 0, i),
+                                        seqan3::test::generate_sequence<seqan3::dna4>(1 + (i * 13) % 80, 0, i + 50));
+        }
+
+        // Similar sequences, for which the wavefronts stay small.
+        for (size_t i = 0; i < 30; ++i)
+        {
+            sequence_t sequence = seqan3::test::generate_sequence<seqan3::dna4>(50 + i * 10, 0, i + 100);
+            sequence_t mutated_sequence = seqan3::test::mutate_sequence(sequence, 0.01 * (i % 10 + 1), i);
+            sequence_pairs.emplace_back(std::move(sequence), std::move(mutated_sequence));
+        }
+    }
+
+    // Recomputes the score of the given alignment to verify that it is optimal.
+    template <typename alignment_t>
+    int32_t alignment_score(alignment_t const & alignment,
+                            int32_t const match,
+                            int32_t const mismatch,
+                            int32_t const open,
+                            int32_t const extension) const
+    {
+        auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+        auto sequence2_it = gapped_sequence2.begin();
+
+        int32_t score = 0;
+        bool gap_in_sequence1 = false;
+        bool gap_in_sequence2 = false;
+        for (auto && symbol1 : gapped_sequence1)
+        {
+            auto symbol2 = *sequence2_it;
+            ++sequence2_it;
+
+            if (symbol1 == seqan3::gap{})
+            {
+                score += extension + (gap_in_sequence1 ? 0 : open);
+                gap_in_sequence1 = true;
+                gap_in_sequence2 = false;
+            }
+            else if (symbol2 == seqan3::gap{})
+            {
+                score += extension + (gap_in_sequence2 ? 0 : open);
+                gap_in_sequence1 = false;
+                gap_in_sequence2 = true;
+            }
+            else
+            {
+                score += (symbol1 == symbol2) ? match : mismatch;
+                gap_in_sequence1 = false;
+                gap_in_sequence2 = false;
+            }
+        }
+
+        return score;
+    }
+
+    void check_against_dynamic_programming(int32_t const match,
+                                           int32_t const mismatch,
+                                           int32_t const open,
+                                           int32_t const extension)
+    {
+        auto cfg = seqan3::align_cfg::method_global{} |
+                   seqan3::align_cfg::scoring_scheme{
+                       seqan3::nucleotide_scoring_scheme{seqan3::match_score{match},
+                                                         seqan3::mismatch_score{mismatch}}} |
+                   seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{open},
+                                                      seqan3::align_cfg::extension_score{extension}} |
+                   seqan3::align_cfg::output_score{} |
+                   seqan3::align_cfg::output_begin_position{} |
+                   seqan3::align_cfg::output_end_position{} |
+                   seqan3::align_cfg::output_alignment{};
+
+        auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+        auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::wavefront{})
+                     | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), expected.size());
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+            EXPECT_EQ(results[index].sequence1_begin_position(), 0u);
+            EXPECT_EQ(results[index].sequence2_begin_position(), 0u);
+            EXPECT_EQ(results[index].sequence1_end_position(), expected[index].sequence1_end_position());
+            EXPECT_EQ(results[index].sequence2_end_position(), expected[index].sequence2_end_position());
+
+            // The alignment may differ from the one of the trace matrix if several optimal alignments exist.
+            auto const & [gapped_sequence1, gapped_sequence2] = results[index].alignment();
+            EXPECT_RANGE_EQ(gapped_sequence1 | std::views::filter([] (auto c) { return c != seqan3::gap{}; })
+                                             | seqan3::views::to_char,
+                            sequence_pairs[index].first | seqan3::views::to_char);
+            EXPECT_RANGE_EQ(gapped_sequence2 | std::views::filter([] (auto c) { return c != seqan3::gap{}; })
+                                             | seqan3::views::to_char,
+                            sequence_pairs[index].second | seqan3::views::to_char);
+            EXPECT_EQ(alignment_score(results[index].alignment(), match, mismatch, open, extension),
+                      expected[index].score()) << "sequence pair " << index;
+        }
+    }
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+};
+
+TEST_F(global_affine_wavefront, affine_gaps)
+{
+    check_against_dynamic_programming(4, -5, -10, -1);
+}
+
+TEST_F(global_affine_wavefront, cheap_gap_open)
+{
+    check_against_dynamic_programming(4, -5, -2, -3);
+}
+
+TEST_F(global_affine_wavefront, linear_gaps)
+{
+    check_against_dynamic_programming(2, -3, 0, -2);
+}
+
+TEST_F(global_affine_wavefront, edit_distance)
+{
+    check_against_dynamic_programming(0, -1, 0, -1);
+}
+
+TEST_F(global_affine_wavefront, gap_extension_below_match_score)
+{
+    // A gap extension score of -1 together with a match score of 1 still penalises every gap.
+    check_against_dynamic_programming(1, -1, -3, -1);
+}
+
+TEST_F(global_affine_wavefront, score_only)
+{
+    auto cfg = seqan3::align_cfg::method_global{} |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                   seqan3::mismatch_score{-5}}} |
+               seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}} |
+               seqan3::align_cfg::output_score{};
+
+    auto expected = seqan3::align_pairwise(sequence_pairs, cfg) | seqan3::views::to<std::vector>;
+    auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::wavefront{})
+                 | seqan3::views::to<std::vector>;
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t index = 0; index < results.size(); ++index)
+        EXPECT_EQ(results[index].score(), expected[index].score()) << "sequence pair " << index;
+}
+
+TEST_F(global_affine_wavefront, unsupported_configuration)
+{
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::wavefront,
+                                                          seqan3::align_cfg::method_local>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::wavefront,
+                                                          seqan3::align_cfg::band_fixed_size>));
+    EXPECT_FALSE((seqan3::is_config_element_combineable_v<seqan3::align_cfg::wavefront,
+                                                          seqan3::align_cfg::vectorised>));
+
+    auto base_cfg = seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                        seqan3::mismatch_score{-5}}} |
+                    seqan3::align_cfg::output_score{} |
+                    seqan3::align_cfg::wavefront{};
+    auto affine_gap_cost = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                              seqan3::align_cfg::extension_score{-1}};
+
+    // Free end-gaps.
+    auto free_end_gaps_cfg = seqan3::align_cfg::method_global{
+                                 seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[4], free_end_gaps_cfg | affine_gap_cost | base_cfg),
+                 seqan3::invalid_alignment_configuration);
+
+    // Dual affine gap costs.
+    auto dual_gap_cost = seqan3::align_cfg::gap_cost_dual_affine{affine_gap_cost, affine_gap_cost};
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[4],
+                                        seqan3::align_cfg::method_global{} | dual_gap_cost | base_cfg),
+                 seqan3::invalid_alignment_configuration);
+
+    // Gaps that are not penalised.
+    auto free_gap_cost = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                            seqan3::align_cfg::extension_score{2}};
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[4],
+                                        seqan3::align_cfg::method_global{} | free_gap_cost | base_cfg),
+                 seqan3::invalid_alignment_configuration);
+
+    // Scoring scheme with more than one match score.
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    scheme.score(seqan3::dna15{}, seqan3::dna15{}) = 6;
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs[4],
+                                        seqan3::align_cfg::method_global{} |
+                                        affine_gap_cost |
+                                        seqan3::align_cfg::scoring_scheme{scheme} |
+                                        seqan3::align_cfg::output_score{} |
+                                        seqan3::align_cfg::wavefront{}),
+                 seqan3::invalid_alignment_configuration);
+}
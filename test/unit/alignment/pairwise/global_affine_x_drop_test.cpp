@@ -0,0 +1,183 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+
+inline constexpr auto base_config = seqan3::align_cfg::method_global{} |
+                                    seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                       seqan3::align_cfg::extension_score{-1}} |
+                                    seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}} |
+                                    seqan3::align_cfg::output_score{} |
+                                    seqan3::align_cfg::output_end_position{};
+
+// Both sequences share a prefix and a suffix, but differ in between. An extension only reaches the suffix if the
+// score is allowed to drop far enough.
+auto diverging_sequences()
+{
+    auto sequence1 = seqan3::views::char_to<seqan3::dna4>(std::string(10, 'A') + std::string(10, 'T') +
+                                                          std::string(30, 'A')) | seqan3::views::to<std::vector>;
+    auto sequence2 = seqan3::views::char_to<seqan3::dna4>(std::string(10, 'A') + std::string(10, 'G') +
+                                                          std::string(30, 'A')) | seqan3::views::to<std::vector>;
+    return std::pair{sequence1, sequence2};
+}
+
+template <typename config_t>
+auto align(std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>> const & sequence_pair,
+           config_t const & cfg)
+{
+    auto rng = seqan3::align_pairwise(sequence_pair, cfg);
+    return *rng.begin();
+}
+
+TEST(global_affine_x_drop, terminates_before_diverging_region)
+{
+    auto sequences = diverging_sequences();
+
+    for (int32_t x_drop : {0, 5, 20})
+    {
+        auto result = align(sequences, base_config | seqan3::align_cfg::x_drop{x_drop});
+        EXPECT_EQ(result.score(), 40) << "x_drop " << x_drop;
+        EXPECT_EQ(result.sequence1_end_position(), 10u) << "x_drop " << x_drop;
+        EXPECT_EQ(result.sequence2_end_position(), 10u) << "x_drop " << x_drop;
+    }
+}
+
+TEST(global_affine_x_drop, extends_over_diverging_region)
+{
+    auto sequences = diverging_sequences();
+
+    for (int32_t x_drop : {30, 60, std::numeric_limits<int32_t>::max()})
+    {
+        auto result = align(sequences, base_config | seqan3::align_cfg::x_drop{x_drop});
+        EXPECT_EQ(result.score(), 120) << "x_drop " << x_drop;
+        EXPECT_EQ(result.sequence1_end_position(), 50u) << "x_drop " << x_drop;
+        EXPECT_EQ(result.sequence2_end_position(), 50u) << "x_drop " << x_drop;
+    }
+}
+
+TEST(global_affine_x_drop, best_cell_inside_of_the_matrix)
+{
+    std::pair sequences{"ACGTGACCTGATCGATCGTAGCTAGCTTACG"_dna4, "ACGTGACGTGATCGTTCGTAGCAAGCTTTCGATCG"_dna4};
+
+    auto result = align(sequences, base_config | seqan3::align_cfg::x_drop{0});
+    EXPECT_EQ(result.score(), 28);
+    EXPECT_EQ(result.sequence1_end_position(), 7u);
+    EXPECT_EQ(result.sequence2_end_position(), 7u);
+
+    result = align(sequences, base_config | seqan3::align_cfg::x_drop{10});
+    EXPECT_EQ(result.score(), 88);
+    EXPECT_EQ(result.sequence1_end_position(), 31u);
+    EXPECT_EQ(result.sequence2_end_position(), 31u);
+}
+
+TEST(global_affine_x_drop, banded)
+{
+    auto sequences = diverging_sequences();
+    auto band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-5},
+                                                   seqan3::align_cfg::upper_diagonal{5}};
+
+    auto result = align(sequences, base_config | band | seqan3::align_cfg::x_drop{20});
+    EXPECT_EQ(result.score(), 40);
+    EXPECT_EQ(result.sequence1_end_position(), 10u);
+    EXPECT_EQ(result.sequence2_end_position(), 10u);
+
+    // A band covering the entire matrix gives the same result as the unbanded alignment.
+    std::pair sequence_pair{"ACGTGACCTGATCGATCGTAGCTAGCTTACG"_dna4, "ACGTGACGTGATCGTTCGTAGCAAGCTTTCGATCG"_dna4};
+    auto wide_band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-40},
+                                                        seqan3::align_cfg::upper_diagonal{40}};
+
+    for (int32_t x_drop : {0, 10})
+    {
+        auto expected = align(sequence_pair, base_config | seqan3::align_cfg::x_drop{x_drop});
+        auto actual = align(sequence_pair, base_config | wide_band | seqan3::align_cfg::x_drop{x_drop});
+        EXPECT_EQ(actual.score(), expected.score()) << "x_drop " << x_drop;
+        EXPECT_EQ(actual.sequence1_end_position(), expected.sequence1_end_position()) << "x_drop " << x_drop;
+        EXPECT_EQ(actual.sequence2_end_position(), expected.sequence2_end_position()) << "x_drop " << x_drop;
+    }
+}
+
+TEST(global_affine_x_drop, vectorised)
+{
+    // Sequence pairs with a similar prefix of different lengths, such that the lanes terminate in different columns.
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+    for (size_t i = 0; i < 50; ++i)
+    {
+        auto prefix = seqan3::test::generate_sequence<seqan3::dna4>(5 + (i * 7) % 40, 0, i);
+        auto sequence1 = prefix;
+        auto sequence2 = prefix;
+        auto tail1 = seqan3::test::generate_sequence<seqan3::dna4>(10 + (i * 11) % 60, 0, i + 100);
+        auto tail2 = seqan3::test::generate_sequence<seqan3::dna4>(10 + (i * 13) % 60, 0, i + 200);
+        sequence1.insert(sequence1.end(), tail1.begin(), tail1.end());
+        sequence2.insert(sequence2.end(), tail2.begin(), tail2.end());
+        sequence_pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    for (int32_t x_drop : {0, 10, 25, 1000})
+    {
+        auto cfg = base_config | seqan3::align_cfg::x_drop{x_drop};
+
+        std::vector<int32_t> expected_scores{};
+        for (auto const & sequence_pair : sequence_pairs)
+            expected_scores.push_back(align(sequence_pair, cfg).score());
+
+        auto results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::vectorised{})
+                     | seqan3::views::to<std::vector>;
+        auto results_int16 = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::vectorised{} |
+                                                                    seqan3::align_cfg::score_type<int16_t>{})
+                           | seqan3::views::to<std::vector>;
+
+        ASSERT_EQ(results.size(), expected_scores.size());
+        ASSERT_EQ(results_int16.size(), expected_scores.size());
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            EXPECT_EQ(results[index].score(), expected_scores[index]) << "x_drop " << x_drop << " pair " << index;
+            EXPECT_EQ(results_int16[index].score(), expected_scores[index]) << "x_drop " << x_drop
+                                                                            << " pair " << index;
+        }
+    }
+}
+
+TEST(global_affine_x_drop, unsupported_configuration)
+{
+    auto sequences = diverging_sequences();
+    auto cfg = seqan3::align_cfg::method_global{} |
+               seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}} |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                   seqan3::mismatch_score{-5}}} |
+               seqan3::align_cfg::x_drop{20};
+
+    EXPECT_THROW(seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::output_alignment{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::output_begin_position{}),
+                 seqan3::invalid_alignment_configuration);
+
+    // The edit distance does not support the x-drop.
+    auto edit_cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme |
+                    seqan3::align_cfg::output_score{} | seqan3::align_cfg::x_drop{20};
+    EXPECT_THROW(seqan3::align_pairwise(sequences, edit_cfg), seqan3::invalid_alignment_configuration);
+}
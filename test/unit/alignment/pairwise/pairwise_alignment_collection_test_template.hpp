@@ -85,7 +85,7 @@ TYPED_TEST_P(pairwise_alignment_collection_test, begin_positions)
 
     using traits_t = seqan3::detail::alignment_configuration_traits<decltype(align_cfg)>;
 
-    if constexpr (!traits_t::is_vectorised)
+    if constexpr (!(traits_t::is_vectorised && traits_t::is_banded))
     {
         auto [database, query] = fixture.get_sequences();
         auto res_vec = seqan3::align_pairwise(seqan3::views::zip(database, query), align_cfg)
@@ -123,7 +123,7 @@ TYPED_TEST_P(pairwise_alignment_collection_test, alignment)
 
     using traits_t = seqan3::detail::alignment_configuration_traits<decltype(align_cfg)>;
 
-    if constexpr (!traits_t::is_vectorised)
+    if constexpr (!(traits_t::is_vectorised && traits_t::is_banded))
     {
         auto [database, query] = fixture.get_sequences();
         auto res_vec = seqan3::align_pairwise(seqan3::views::zip(database, query), align_cfg)
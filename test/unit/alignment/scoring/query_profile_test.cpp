@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/query_profile.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+
+using seqan3::operator""_aa27;
+using seqan3::operator""_dna4;
+using seqan3::operator""_dna5;
+
+TEST(query_profile, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<seqan3::query_profile<seqan3::dna4>>);
+    EXPECT_TRUE(std::is_copy_constructible_v<seqan3::query_profile<seqan3::dna4>>);
+    EXPECT_TRUE(std::is_move_constructible_v<seqan3::query_profile<seqan3::dna4>>);
+    EXPECT_TRUE(std::is_copy_assignable_v<seqan3::query_profile<seqan3::dna4>>);
+    EXPECT_TRUE(std::is_move_assignable_v<seqan3::query_profile<seqan3::dna4>>);
+    EXPECT_TRUE(std::is_destructible_v<seqan3::query_profile<seqan3::dna4>>);
+}
+
+TEST(query_profile, type_deduction)
+{
+    std::vector query{"ACGT"_dna4};
+    seqan3::query_profile profile{query, seqan3::nucleotide_scoring_scheme{}};
+
+    EXPECT_TRUE((std::is_same_v<decltype(profile), seqan3::query_profile<seqan3::dna4, seqan3::dna4, int32_t>>));
+}
+
+TEST(query_profile, empty_query)
+{
+    std::vector<seqan3::dna4> query{};
+    seqan3::query_profile profile{query, seqan3::nucleotide_scoring_scheme{}};
+
+    EXPECT_EQ(profile.size(), 0u);
+    EXPECT_EQ(profile.segment_length(), 0u);
+    EXPECT_TRUE(profile.scalar_scores('A'_dna4).empty());
+    EXPECT_TRUE(profile.striped_scores('A'_dna4).empty());
+    EXPECT_TRUE(profile.is_profile_of(query));
+}
+
+TEST(query_profile, scalar_layout)
+{
+    std::vector query{"ACGTAC"_dna4};
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    seqan3::query_profile profile{query, scheme};
+
+    EXPECT_EQ(profile.size(), query.size());
+    EXPECT_TRUE(std::ranges::equal(profile.query(), query));
+
+    for (seqan3::dna4 target_symbol : "ACGT"_dna4)
+    {
+        auto scores = profile.scalar_scores(target_symbol);
+        ASSERT_EQ(scores.size(), query.size());
+
+        for (size_t row = 0; row < query.size(); ++row)
+            EXPECT_EQ(scores[row], scheme.score(target_symbol, query[row]));
+    }
+}
+
+TEST(query_profile, striped_layout)
+{
+    using profile_t = seqan3::query_profile<seqan3::aa27>;
+
+    seqan3::aminoacid_scoring_scheme scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62};
+    std::vector query{"ARNDCQEGHILKMFPSTWYVBJZX*"_aa27};
+    profile_t profile{query, scheme};
+
+    size_t const segment_length = (query.size() + profile_t::lane_count - 1) / profile_t::lane_count;
+    EXPECT_EQ(profile.segment_length(), segment_length);
+
+    for (seqan3::aa27 target_symbol : "ACWY*"_aa27)
+    {
+        auto scores = profile.striped_scores(target_symbol);
+        ASSERT_EQ(scores.size(), segment_length);
+
+        // The k-th vector stores the rows k, s + k, ..., (L-1)s + k; rows beyond the query are scored with 0.
+        for (size_t k = 0; k < segment_length; ++k)
+        {
+            for (size_t lane = 0; lane < profile_t::lane_count; ++lane)
+            {
+                size_t const row = lane * segment_length + k;
+                int32_t const expected = (row < query.size()) ? scheme.score(target_symbol, query[row]) : 0;
+                EXPECT_EQ(scores[k][lane], expected);
+            }
+        }
+    }
+}
+
+TEST(query_profile, different_alphabets)
+{
+    std::vector query{"ACGTN"_dna5};
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{2}, seqan3::mismatch_score{-3}};
+    seqan3::query_profile<seqan3::dna5, seqan3::dna4, int16_t> profile{query, scheme};
+
+    auto scores = profile.scalar_scores('C'_dna4);
+    ASSERT_EQ(scores.size(), query.size());
+
+    for (size_t row = 0; row < query.size(); ++row)
+        EXPECT_EQ(scores[row], scheme.score('C'_dna4, query[row]));
+}
+
+TEST(query_profile, is_profile_of)
+{
+    std::vector query{"ACGTAC"_dna4};
+    seqan3::query_profile profile{query, seqan3::nucleotide_scoring_scheme{}};
+
+    EXPECT_TRUE(profile.is_profile_of(query));
+    EXPECT_TRUE(profile.is_profile_of("ACGTAC"_dna4));
+    EXPECT_FALSE(profile.is_profile_of("ACGTAG"_dna4));
+    EXPECT_FALSE(profile.is_profile_of("ACGTA"_dna4));
+    EXPECT_FALSE(profile.is_profile_of("ACGTACA"_dna4));
+}
+
+TEST(query_profile, score_overflow)
+{
+    std::vector query{"ACGT"_dna4};
+    seqan3::nucleotide_scoring_scheme<int32_t> scheme{seqan3::match_score{1000}, seqan3::mismatch_score{-5}};
+
+    EXPECT_THROW((seqan3::query_profile<seqan3::dna4, seqan3::dna4, int8_t>{query, scheme}), std::invalid_argument);
+    EXPECT_NO_THROW((seqan3::query_profile<seqan3::dna4, seqan3::dna4, int16_t>{query, scheme}));
+}
@@ -64,7 +64,8 @@ struct algorithm_executor_blocking_test : public ::testing::Test
 };
 
 using testing_types = testing::Types<seqan3::detail::execution_handler_sequential,
-                                     seqan3::detail::execution_handler_parallel>;
+                                     seqan3::detail::execution_handler_parallel,
+                                     seqan3::detail::execution_handler_work_stealing>;
 TYPED_TEST_SUITE(algorithm_executor_blocking_test, testing_types, );
 
 TYPED_TEST(algorithm_executor_blocking_test, construction)
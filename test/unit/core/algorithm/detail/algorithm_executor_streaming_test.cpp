@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
+
+using callback_t = std::function<void(size_t)>;
+using algorithm_t = std::function<void(size_t &, callback_t)>;
+using executor_t = seqan3::detail::algorithm_executor_streaming<std::vector<size_t> &, algorithm_t, size_t>;
+
+// Values with very different computation times, such that they complete out of order.
+algorithm_t unbalanced_algorithm = [] (size_t & value, callback_t callback)
+{
+    size_t sum = 0;
+    for (size_t i = 0; i < (value % 32) * 1000; ++i)
+        sum += i % 3;
+
+    callback(value + sum - sum);
+};
+
+std::vector<size_t> generate_values(size_t const count)
+{
+    std::vector<size_t> values(count);
+    std::iota(values.begin(), values.end(), 0u);
+    return values;
+}
+
+TEST(algorithm_executor_streaming_test, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_constructible_v<executor_t>);
+    EXPECT_TRUE(std::is_move_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_assignable_v<executor_t>);
+    EXPECT_TRUE(std::is_move_assignable_v<executor_t>);
+}
+
+TEST(algorithm_executor_streaming_test, next_result)
+{
+    std::vector<size_t> values = generate_values(2000);
+    // The buffer is much smaller than the number of results.
+    executor_t exec{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{4u}, 8u};
+
+    std::vector<size_t> results{};
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+
+    EXPECT_FALSE(exec.next_result().has_value());
+
+    std::ranges::sort(results);
+    EXPECT_EQ(results, values);
+}
+
+TEST(algorithm_executor_streaming_test, empty_resource)
+{
+    std::vector<size_t> values{};
+    executor_t exec{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{4u}, 8u};
+
+    EXPECT_FALSE(exec.next_result().has_value());
+}
+
+TEST(algorithm_executor_streaming_test, move_construction)
+{
+    std::vector<size_t> values = generate_values(100);
+    executor_t exec{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{4u}, 8u};
+
+    std::vector<size_t> results{*exec.next_result()};
+
+    executor_t exec_moved{std::move(exec)};
+    for (auto result = exec_moved.next_result(); result.has_value(); result = exec_moved.next_result())
+        results.push_back(*result);
+
+    std::ranges::sort(results);
+    EXPECT_EQ(results, values);
+}
+
+TEST(algorithm_executor_streaming_test, destruction_before_consumption)
+{
+    std::vector<size_t> values = generate_values(10000);
+
+    { // The threads block on the full buffer and must be released by the destructor.
+        executor_t exec{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{4u}, 2u};
+        EXPECT_TRUE(exec.next_result().has_value());
+    }
+
+    SUCCEED();
+}
+
+TEST(algorithm_executor_streaming_test, exception)
+{
+    std::vector<size_t> values = generate_values(100);
+    algorithm_t throwing_algorithm = [] (size_t & value, callback_t callback)
+    {
+        if (value == 42)
+            throw std::runtime_error{"error"};
+
+        callback(value);
+    };
+
+    executor_t exec{values, throwing_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{4u}, 8u};
+
+    EXPECT_THROW(while (exec.next_result().has_value()) {}, std::runtime_error);
+}
+
+TEST(algorithm_executor_streaming_test, interleaved_on_shared_pool)
+{
+    std::vector<size_t> values = generate_values(1000);
+    seqan3::thread_pool pool{4};
+
+    // The buffers are much smaller than the number of results, such that the threads of the pool would wait for the
+    // consumer of one executor while the consumer waits for the other one.
+    executor_t exec1{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{pool}, 2u};
+    executor_t exec2{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{pool}, 2u};
+
+    std::vector<size_t> results1{};
+    std::vector<size_t> results2{};
+    for (bool exec1_done = false, exec2_done = false; !exec1_done || !exec2_done;)
+    {
+        if (auto result = exec1.next_result(); result.has_value())
+            results1.push_back(*result);
+        else
+            exec1_done = true;
+
+        if (auto result = exec2.next_result(); result.has_value())
+            results2.push_back(*result);
+        else
+            exec2_done = true;
+    }
+
+    std::ranges::sort(results1);
+    std::ranges::sort(results2);
+    EXPECT_EQ(results1, values);
+    EXPECT_EQ(results2, values);
+}
+
+TEST(algorithm_executor_streaming_test, blocking_call_on_shared_pool)
+{
+    std::vector<size_t> values = generate_values(1000);
+    seqan3::thread_pool pool{4};
+
+    executor_t exec{values, unbalanced_algorithm, 0u, seqan3::detail::execution_handler_work_stealing{pool}, 2u};
+    std::vector<size_t> results{*exec.next_result()};
+
+    // Another computation on the same pool completes although the executor is not consumed in the meantime.
+    std::vector<size_t> blocking_results(values.size(), 0u);
+    seqan3::detail::execution_handler_work_stealing{pool}.bulk_execute(unbalanced_algorithm, values,
+                                                                       [&] (size_t const result)
+    {
+        blocking_results[result] = result;
+    });
+    EXPECT_EQ(blocking_results, values);
+
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+
+    std::ranges::sort(results);
+    EXPECT_EQ(results, values);
+}
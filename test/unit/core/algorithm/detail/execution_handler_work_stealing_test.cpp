@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
+
+#include "execution_handler_template.hpp"
+
+INSTANTIATE_TYPED_TEST_SUITE_P(execution_handler_work_stealing,
+                               execution_handler,
+                               seqan3::detail::execution_handler_work_stealing, );
+
+// Tasks of very different cost, such that the threads must steal to balance the work.
+auto unbalanced_algorithm = [] (size_t const value, auto && callback)
+{
+    size_t sum = 0;
+    for (size_t i = 0; i < (value % 64) * (value % 64) * 100; ++i)
+        sum += i % 3;
+
+    callback(value + sum - sum);
+};
+
+TEST(execution_handler_work_stealing, reuse_handler)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{4u};
+
+    for (size_t task_count : {0u, 1u, 3u, 100u, 1000u})
+    {
+        std::vector<size_t> results(task_count, 0u);
+
+        for (size_t i = 0; i < task_count; ++i)
+            exec_handler.execute(unbalanced_algorithm, size_t{i}, [&results, i] (size_t const result)
+            {
+                results[i] = result + 1;
+            });
+
+        exec_handler.wait();
+
+        std::vector<size_t> expected(task_count);
+        std::iota(expected.begin(), expected.end(), 1u);
+        EXPECT_EQ(results, expected);
+    }
+}
+
+TEST(execution_handler_work_stealing, more_threads_than_tasks)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{16u};
+    std::vector<size_t> values{3, 1, 2};
+    std::vector<size_t> results(values.size(), 0u);
+
+    exec_handler.bulk_execute(unbalanced_algorithm, values, [&results] (size_t const result)
+    {
+        results[result - 1] = result;
+    });
+
+    EXPECT_EQ(results, (std::vector<size_t>{1, 2, 3}));
+}
+
+TEST(execution_handler_work_stealing, different_algorithms)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{4u};
+    std::vector<size_t> results(4, 0u);
+
+    auto add_one = [] (size_t const value, auto && callback) { callback(value + 1); };
+    auto add_two = [] (size_t const value, auto && callback) { callback(value + 2); };
+
+    // Switching the algorithm computes the tasks of the previous one first.
+    exec_handler.execute(add_one, size_t{0}, [&results] (size_t const result) { results[0] = result; });
+    exec_handler.execute(add_two, size_t{0}, [&results] (size_t const result) { results[1] = result; });
+    exec_handler.execute(add_one, size_t{1}, [&results] (size_t const result) { results[2] = result; });
+    exec_handler.execute(add_one, size_t{2}, [&results] (size_t const result) { results[3] = result; });
+    exec_handler.wait();
+
+    EXPECT_EQ(results, (std::vector<size_t>{1, 2, 2, 3}));
+}
+
+TEST(execution_handler_work_stealing, exception)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{4u};
+
+    auto throwing_algorithm = [] (size_t const value, auto && callback)
+    {
+        if (value == 42)
+            throw std::runtime_error{"error"};
+
+        callback(value);
+    };
+
+    for (size_t i = 0; i < 100; ++i)
+        exec_handler.execute(throwing_algorithm, size_t{i}, [] (size_t const) {});
+
+    EXPECT_THROW(exec_handler.wait(), std::runtime_error);
+
+    // The handler can be used after an exception was thrown.
+    size_t result = 0;
+    exec_handler.execute(throwing_algorithm, size_t{7}, [&result] (size_t const value) { result = value; });
+    EXPECT_NO_THROW(exec_handler.wait());
+    EXPECT_EQ(result, 7u);
+}
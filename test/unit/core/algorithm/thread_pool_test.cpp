@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_work_stealing.hpp>
+#include <seqan3/core/algorithm/thread_pool.hpp>
+
+auto plus_one = [] (size_t const value, auto && callback)
+{
+    callback(value + 1);
+};
+
+// Computes the given number of tasks with a handler using the given pool.
+std::vector<size_t> compute_with_pool(seqan3::thread_pool & pool, size_t const task_count)
+{
+    seqan3::detail::execution_handler_work_stealing exec_handler{pool};
+    std::vector<size_t> values(task_count);
+    std::iota(values.begin(), values.end(), 0u);
+    std::vector<size_t> results(task_count, 0u);
+
+    exec_handler.bulk_execute(plus_one, values, [&results] (size_t const result)
+    {
+        results[result - 1] = result;
+    });
+
+    return results;
+}
+
+std::vector<size_t> expected_results(size_t const task_count)
+{
+    std::vector<size_t> expected(task_count);
+    std::iota(expected.begin(), expected.end(), 1u);
+    return expected;
+}
+
+TEST(thread_pool, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_copy_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_move_constructible_v<seqan3::thread_pool>);
+    EXPECT_TRUE((std::is_constructible_v<seqan3::thread_pool, uint32_t>));
+
+    EXPECT_EQ(seqan3::thread_pool{4}.size(), 4u);
+    EXPECT_EQ(seqan3::thread_pool{0}.size(), 1u);
+}
+
+TEST(thread_pool, reuse_across_handlers)
+{
+    seqan3::thread_pool pool{4};
+
+    for (size_t task_count : {0u, 1u, 10u, 1000u, 10u})
+        EXPECT_EQ(compute_with_pool(pool, task_count), expected_results(task_count));
+}
+
+TEST(thread_pool, concurrent_handlers)
+{
+    seqan3::thread_pool pool{std::min<uint32_t>(4, std::thread::hardware_concurrency())};
+    std::vector<std::vector<size_t>> results(4);
+
+    std::vector<std::thread> producers{};
+    for (size_t producer = 0; producer < results.size(); ++producer)
+    {
+        producers.emplace_back([&pool, &results, producer] ()
+        {
+            for (size_t i = 0; i < 20; ++i)
+                results[producer] = compute_with_pool(pool, 500 + producer);
+        });
+    }
+
+    for (auto & producer : producers)
+        producer.join();
+
+    for (size_t producer = 0; producer < results.size(); ++producer)
+        EXPECT_EQ(results[producer], expected_results(500 + producer));
+}
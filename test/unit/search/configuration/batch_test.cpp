@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/search/configuration/batch.hpp>
+
+#include "../../core/algorithm/pipeable_config_element_test_template.hpp"
+
+// ---------------------------------------------------------------------------------------------------------------------
+// test template : pipeable_config_element_test
+// ---------------------------------------------------------------------------------------------------------------------
+
+using test_types = ::testing::Types<seqan3::search_cfg::batch>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(batch_elements, pipeable_config_element_test, test_types, );
+
+// ---------------------------------------------------------------------------------------------------------------------
+// individual tests
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(search_config_batch, member_variable)
+{
+    {   // default construction
+        seqan3::search_cfg::batch cfg{};
+        EXPECT_EQ(cfg.size, 32u);
+    }
+
+    {   // construct with value
+        seqan3::search_cfg::batch cfg{64};
+        EXPECT_EQ(cfg.size, 64u);
+    }
+
+    {   // assign value
+        seqan3::search_cfg::batch cfg{};
+        cfg.size = 64;
+        EXPECT_EQ(cfg.size, 64u);
+    }
+}
+
+TEST(search_config_batch, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::search_cfg::batch>));
+}
+
+TEST(search_config_batch, configuration)
+{
+    { // from lvalue.
+        seqan3::search_cfg::batch elem{64};
+        seqan3::configuration cfg{elem};
+        EXPECT_EQ(std::get<seqan3::search_cfg::batch>(cfg).size, 64u);
+    }
+
+    { // from rvalue.
+        seqan3::configuration cfg{seqan3::search_cfg::batch{64}};
+        EXPECT_EQ(std::get<seqan3::search_cfg::batch>(cfg).size, 64u);
+    }
+}
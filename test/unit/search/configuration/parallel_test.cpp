@@ -16,7 +16,7 @@
 // test template : pipeable_config_element_test
 // ---------------------------------------------------------------------------------------------------------------------
 
-using test_types = ::testing::Types<seqan3::search_cfg::parallel>;
+using test_types = ::testing::Types<seqan3::search_cfg::parallel, seqan3::search_cfg::parallel_work_stealing>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(parallel_elements, pipeable_config_element_test, test_types, );
 
@@ -10,6 +10,7 @@
 #include <type_traits>
 #include <seqan3/std/ranges>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/test/cereal.hpp>
@@ -156,4 +157,33 @@ TYPED_TEST_P(fm_index_collection_test, serialisation)
     seqan3::test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(fm_index_collection_test, ctr, swap, size, serialisation, concept_check, empty_text);
+TYPED_TEST_P(fm_index_collection_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+    using inner_text_type = std::ranges::range_value_t<text_t>;
+
+    text_t text{inner_text_type(300), inner_text_type(1), inner_text_type(700)};
+    for (inner_text_type & sequence : text)
+        for (size_t i = 0; i < sequence.size(); ++i)
+            seqan3::assign_rank_to((i * i + i / 7) % 3, sequence[i]);
+
+    index_t const expected{text};
+
+    seqan3::fm_index_construction_options options{};
+
+    // parallel construction of the suffix array
+    options.thread_count = 4;
+    EXPECT_EQ((index_t{text, options}), expected);
+
+    // parallel and disk-backed construction
+    options.disk_threshold = 0;
+    EXPECT_EQ((index_t{text, options}), expected);
+
+    // disk-backed construction
+    options.thread_count = 1;
+    EXPECT_EQ((index_t{text, options}), expected);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(fm_index_collection_test, ctr, swap, size, serialisation, concept_check, empty_text,
+                            construction_options);
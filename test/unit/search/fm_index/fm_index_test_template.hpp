@@ -9,6 +9,7 @@
 
 #include <type_traits>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/test/cereal.hpp>
@@ -118,4 +119,31 @@ TYPED_TEST_P(fm_index_test, serialisation)
     seqan3::test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(fm_index_test, ctr, swap, size, concept_check, empty_text, serialisation);
+TYPED_TEST_P(fm_index_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+
+    text_t text(1000);
+    for (size_t i = 0; i < text.size(); ++i)
+        seqan3::assign_rank_to((i * i + i / 7) % 3, text[i]);
+
+    index_t const expected{text};
+
+    seqan3::fm_index_construction_options options{};
+
+    // parallel construction of the suffix array
+    options.thread_count = 4;
+    EXPECT_EQ((index_t{text, options}), expected);
+
+    // parallel and disk-backed construction
+    options.disk_threshold = 0;
+    EXPECT_EQ((index_t{text, options}), expected);
+
+    // disk-backed construction
+    options.thread_count = 1;
+    EXPECT_EQ((index_t{text, options}), expected);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(fm_index_test, ctr, swap, size, concept_check, empty_text, serialisation,
+                            construction_options);
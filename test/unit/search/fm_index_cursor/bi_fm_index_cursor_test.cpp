@@ -43,6 +43,26 @@ struct bi_fm_index_cursor_test : public ::testing::Test
 using it_t1 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna4, bi_fm_index_cursor_test, it_t1, );
 
+using it_t4 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
+                                                             seqan3::text_layout::single,
+                                                             seqan3::sdsl_fast_locate_index_type>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_fast_locate, bi_fm_index_cursor_test, it_t4, );
+
+using it_t5 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
+                                                             seqan3::text_layout::single,
+                                                             seqan3::sdsl_compact_index_type>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_compact, bi_fm_index_cursor_test, it_t5, );
+
+using it_t6 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
+                                                             seqan3::text_layout::single,
+                                                             seqan3::sdsl_epr_index_type<seqan3::dna4>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_epr, bi_fm_index_cursor_test, it_t6, );
+
+using it_t7 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna5,
+                                                             seqan3::text_layout::single,
+                                                             seqan3::sdsl_epr_index_type<seqan3::dna5>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna5_epr, bi_fm_index_cursor_test, it_t7, );
+
 // dna5
 using it_t2 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna5, seqan3::text_layout::single>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna5, bi_fm_index_cursor_test, it_t2, );
@@ -55,6 +55,31 @@ using it_t4 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
                                                              sdsl_byte_index_type>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(bi_byte_alphabet_traits, fm_index_cursor_test, it_t4, );
 
+using it_t7 = seqan3::fm_index_cursor<seqan3::fm_index<seqan3::dna4,
+                                                       seqan3::text_layout::single,
+                                                       seqan3::sdsl_fast_locate_index_type>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(fast_locate_traits, fm_index_cursor_test, it_t7, );
+
+using it_t8 = seqan3::fm_index_cursor<seqan3::fm_index<seqan3::dna4,
+                                                       seqan3::text_layout::single,
+                                                       seqan3::sdsl_compact_index_type>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(compact_traits, fm_index_cursor_test, it_t8, );
+
+using it_t9 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
+                                                             seqan3::text_layout::single,
+                                                             seqan3::sdsl_compact_index_type>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(bi_compact_traits, fm_index_cursor_test, it_t9, );
+
+using it_t10 = seqan3::fm_index_cursor<seqan3::fm_index<seqan3::dna4,
+                                                        seqan3::text_layout::single,
+                                                        seqan3::sdsl_epr_index_type<seqan3::dna4>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(epr_traits, fm_index_cursor_test, it_t10, );
+
+using it_t11 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
+                                                              seqan3::text_layout::single,
+                                                              seqan3::sdsl_epr_index_type<seqan3::dna4>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(bi_epr_traits, fm_index_cursor_test, it_t11, );
+
 // dna5
 using it_t5 = seqan3::fm_index_cursor<seqan3::fm_index<seqan3::dna5, seqan3::text_layout::single>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna5_default_traits, fm_index_cursor_test, it_t5, );
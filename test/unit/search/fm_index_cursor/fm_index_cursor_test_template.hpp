@@ -163,6 +163,26 @@ TYPED_TEST_P(fm_index_cursor_test, extend_right_char)
     EXPECT_EQ(it, it_cpy);
 }
 
+TYPED_TEST_P(fm_index_cursor_test, prefetch_extend_right)
+{
+    typename TypeParam::index_type fm{this->text1}; // "ACGACG"
+
+    // prefetching does not modify the cursor, neither at the root nor at an inner node
+    TypeParam it(fm);
+    TypeParam it_cpy = it;
+    it.prefetch_extend_right();
+    EXPECT_EQ(it, it_cpy);
+
+    EXPECT_TRUE(it.extend_right(this->text1[0]));  // 'A'
+    it_cpy = it;
+    it.prefetch_extend_right();
+    EXPECT_EQ(it, it_cpy);
+
+    EXPECT_TRUE(it.extend_right(this->text1[1]));  // 'C'
+    EXPECT_EQ(seqan3::uniquify(it.locate()), (locate_result_t{{0, 0}, {0, 3}}));
+    EXPECT_EQ(it.query_length(), 2u);
+}
+
 // TODO: doesn't work with the current structure of typed tests
 // TYPED_TEST_P(fm_index_cursor_test, extend_right_convertible_char)
 // {
@@ -357,5 +377,5 @@ TYPED_TEST_P(fm_index_cursor_test, serialisation)
 }
 
 REGISTER_TYPED_TEST_SUITE_P(fm_index_cursor_test, ctr, begin, extend_right_range, extend_right_char,
-                            extend_right_range_and_cycle, extend_right_char_and_cycle, extend_right_and_cycle, query,
-                            last_rank, incomplete_alphabet, lazy_locate, serialisation);
+                            prefetch_extend_right, extend_right_range_and_cycle, extend_right_char_and_cycle,
+                            extend_right_and_cycle, query, last_rank, incomplete_alphabet, lazy_locate, serialisation);
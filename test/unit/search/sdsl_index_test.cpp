@@ -5,7 +5,9 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
 
 #include <gtest/gtest.h>
 
@@ -31,3 +33,10 @@ TYPED_TEST(sdsl_index_test, concepts)
 {
     EXPECT_TRUE(seqan3::detail::sdsl_index<sdsl_index<TypeParam>>);
 }
+
+TEST(sdsl_index_test, index_configurations)
+{
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_fast_locate_index_type>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_compact_index_type>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_epr_index_type<seqan3::dna4>>);
+}
@@ -7,6 +7,7 @@
 
 #include <type_traits>
 
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
@@ -40,6 +41,7 @@ using test_types = ::testing::Types<seqan3::search_cfg::max_error_total,
                                     seqan3::search_cfg::output_reference_begin_position,
                                     seqan3::search_cfg::output_index_cursor,
                                     seqan3::search_cfg::parallel,
+                                    seqan3::search_cfg::batch,
                                     seqan3::search_cfg::detail::result_type<search_result_t>>;
 
 TYPED_TEST_SUITE(search_configuration_test, test_types, );
@@ -13,7 +13,9 @@
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/core/algorithm/thread_pool.hpp>
 #include <seqan3/range/views/persist.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
@@ -144,6 +146,87 @@ TYPED_TEST(search_test, parallel_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | position, std::vector(num_queries, 0));
 }
 
+TYPED_TEST(search_test, parallel_queries_thread_pool)
+{
+    constexpr size_t num_queries{100u};
+    std::vector<std::vector<seqan3::dna4>> const queries{num_queries, {"ACGTACGTACGT"_dna4}};
+
+    seqan3::thread_pool pool{std::min<uint32_t>(2, std::thread::hardware_concurrency())};
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{.0}} |
+                                      seqan3::search_cfg::parallel_work_stealing{pool};
+
+    // Every search reuses the threads of the pool.
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, std::views::iota(0u, num_queries));
+        EXPECT_RANGE_EQ(search(queries, this->index, cfg) | position, std::vector(num_queries, 0));
+    }
+}
+
+TYPED_TEST(search_test, batched_queries)
+{
+    // The batch size does not divide the number of queries.
+    std::vector<std::vector<seqan3::dna4>> const queries{{"GG"_dna4, "ACGTACGTACGT"_dna4, "ACGTA"_dna4,
+                                                          "CGTTCG"_dna4, "TACG"_dna4, "AAAAAA"_dna4, "GTAC"_dna4}};
+
+    auto expect_same_results = [&] (auto const & cfg)
+    {
+        EXPECT_RANGE_EQ(search(queries, this->index, cfg | seqan3::search_cfg::batch{3}) | query_id,
+                        search(queries, this->index, cfg) | query_id);
+        EXPECT_RANGE_EQ(search(queries, this->index, cfg | seqan3::search_cfg::batch{3}) | position,
+                        search(queries, this->index, cfg) | position);
+    };
+
+    seqan3::search_cfg::max_error_total const error_free_cfg{seqan3::search_cfg::error_count{0}};
+    seqan3::search_cfg::max_error_total const error_cfg{seqan3::search_cfg::error_count{1}};
+
+    EXPECT_RANGE_EQ(search(queries, this->index, error_free_cfg | seqan3::search_cfg::batch{3}) | query_id,
+                    (std::vector{1, 2, 2, 4, 4, 6, 6}));
+
+    expect_same_results(seqan3::configuration{error_free_cfg});
+    expect_same_results(error_free_cfg | seqan3::search_cfg::hit_single_best{});
+    expect_same_results(error_cfg | seqan3::search_cfg::hit_all{});
+    expect_same_results(error_cfg | seqan3::search_cfg::hit_all_best{});
+    expect_same_results(error_cfg | seqan3::search_cfg::hit_single_best{});
+    expect_same_results(error_cfg | seqan3::search_cfg::hit_strata{1});
+}
+
+TYPED_TEST(search_test, batched_parallel_queries)
+{
+    constexpr size_t num_queries{100u};
+    std::vector<std::vector<seqan3::dna4>> const queries{num_queries, {"ACGTACGTACGT"_dna4}};
+
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{.0}} |
+                                      seqan3::search_cfg::batch{16} |
+                                      seqan3::search_cfg::parallel{
+                                          std::min<uint32_t>(2, std::thread::hardware_concurrency())};
+
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, std::views::iota(0u, num_queries));
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg) | position, std::vector(num_queries, 0));
+}
+
+TYPED_TEST(search_test, batched_on_result_invocation)
+{
+    std::vector<std::vector<seqan3::dna4>> const queries{{"ACGT"_dna4, "ACGG"_dna4, "TACG"_dna4}};
+
+    std::vector<int> actual_positions{};
+    seqan3::configuration const cfg = seqan3::search_cfg::batch{2} |
+                                      seqan3::search_cfg::on_result{[&] (auto && search_result) -> void
+    {
+        actual_positions.push_back(search_result.reference_begin_position());
+    }};
+
+    search(queries, this->index, cfg);
+    EXPECT_RANGE_EQ(actual_positions, (std::vector{0, 4, 8, 3, 7}));
+}
+
+TYPED_TEST(search_test, batch_size_zero)
+{
+    seqan3::configuration const cfg = seqan3::search_cfg::batch{0};
+
+    EXPECT_THROW(search("AAAA"_dna4, this->index, cfg), std::invalid_argument);
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     seqan3::configuration const cfg1 = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{-0.5}};